@@ -1,5 +1,194 @@
 Import("env")
 
+import gzip
+import hashlib
+import math
+import os
+
+# Web arayüzü dosyaları: (kaynak, C sembolü, içerik tipi)
+WEB_ASSETS = [
+    ("index.html", "WEB_ASSET_INDEX", "text/html; charset=utf-8"),
+    ("wifi.html", "WEB_ASSET_WIFI", "text/html; charset=utf-8"),
+]
+
+def generate_web_assets():
+    project_dir = env.subst("$PROJECT_DIR")
+    web_dir = os.path.join(project_dir, "web")
+    output_path = os.path.join(project_dir, "src", "web_assets_gz.cpp")
+    
+    lines = [
+        "// OTOMATİK ÜRETİLDİ - scripts/pre_build.py (elle düzenlemeyin)",
+        "// Kaynak: web/ klasörü",
+        "",
+        '#include "web_assets.h"',
+        "",
+    ]
+    
+    for file_name, symbol, content_type in WEB_ASSETS:
+        with open(os.path.join(web_dir, file_name), "rb") as source:
+            raw = source.read()
+        
+        # mtime=0: aynı kaynak her derlemede aynı baytları (ve aynı ETag'i) üretir
+        compressed = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha256(raw).hexdigest()[:16]
+        
+        lines.append("static const uint8_t %s_DATA[] PROGMEM = {" % symbol)
+        for offset in range(0, len(compressed), 16):
+            chunk = compressed[offset:offset + 16]
+            lines.append("    " + ", ".join("0x%02x" % b for b in chunk) + ",")
+        lines.append("};")
+        lines.append("")
+        lines.append('const WebAsset %s = { "%s", %s_DATA, sizeof(%s_DATA), "\\"%s\\"" };'
+                     % (symbol, content_type, symbol, symbol, etag))
+        lines.append("")
+        
+        print("Web: %s %d -> %d bayt (gzip), ETag %s" % (file_name, len(raw), len(compressed), etag))
+    
+    content = "\r\n".join(lines)
+    
+    # İçerik değişmediyse dosyaya dokunma (gereksiz yeniden derlemeyi önler)
+    if os.path.exists(output_path):
+        with open(output_path, "r", encoding="utf-8", newline="") as existing:
+            if existing.read() == content:
+                return
+    
+    with open(output_path, "w", encoding="utf-8", newline="") as output:
+        output.write(content)
+
+# Büyük rakam glifleri: her karakter, hücre içinde piksel koordinatlı vuruşlardan
+# (yuvarlak uçlu çizgiler) oluşur. Vuruşlar alt örneklemeyle taranır ve piksel
+# başına 4 bit kaplama (alfa) olarak saklanır; renk karışımı çalışma zamanında
+# ön plan/arka plan rengine göre yapılır.
+GLYPH_HEIGHT = 16
+GLYPH_STROKE = 1.05      # Çizgi yarıçapı (piksel)
+GLYPH_SUPERSAMPLE = 4    # Piksel başına 4x4 örnek
+
+def _arc(cx, cy, rx, ry, start, end, steps=24):
+    # Açılar derece, matematik yönünde (y ekranda aşağı doğru)
+    points = []
+    for i in range(steps + 1):
+        a = math.radians(start + (end - start) * i / steps)
+        points.append((cx + rx * math.cos(a), cy - ry * math.sin(a)))
+    return points
+
+def _ring(cx, cy, rx, ry):
+    return _arc(cx, cy, rx, ry, 0, 360, 32)
+
+# (karakter kodu, hücre genişliği, vuruş listesi); her vuruş bir nokta dizisidir
+GLYPH_STROKES = [
+    (ord(" "), 6, []),
+    (ord("%"), 12, [_ring(3.6, 4.2, 1.7, 1.9), _ring(8.4, 11.8, 1.7, 1.9), [(9.5, 2.0), (2.5, 14.0)]]),
+    (ord("-"), 10, [[(2.0, 8.5), (8.0, 8.5)]]),
+    (ord("."), 6, [[(2.8, 13.3)]]),
+    (ord("/"), 10, [[(7.5, 1.8), (2.5, 14.2)]]),
+    (ord("0"), 12, [_ring(6.0, 8.0, 3.6, 6.3)]),
+    (ord("1"), 12, [[(3.8, 4.0), (6.6, 1.7), (6.6, 14.3)]]),
+    (ord("2"), 12, [_arc(6.0, 5.2, 3.5, 3.5, 160, -35) + [(2.4, 14.3), (9.8, 14.3)]]),
+    (ord("3"), 12, [_arc(5.9, 4.9, 3.3, 3.2, 150, -90), _arc(5.9, 11.1, 3.7, 3.2, 90, -155)]),
+    (ord("4"), 12, [[(8.2, 14.3), (8.2, 1.7), (2.2, 10.6), (10.0, 10.6)]]),
+    (ord("5"), 12, [[(9.3, 1.7), (3.3, 1.7), (2.8, 7.4)] + _arc(5.8, 10.3, 3.8, 4.0, 135, -145)]),
+    (ord("6"), 12, [_ring(6.0, 10.4, 3.6, 3.9), [(8.8, 2.0), (6.4, 1.8), (4.0, 3.3), (2.6, 6.2), (2.4, 10.4)]]),
+    (ord("7"), 12, [[(2.2, 1.7), (9.8, 1.7), (4.8, 14.3)]]),
+    (ord("8"), 12, [_ring(6.0, 4.8, 3.1, 3.1), _ring(6.0, 11.0, 3.6, 3.3)]),
+    (ord("9"), 12, [_ring(6.0, 5.6, 3.6, 3.9), [(9.6, 5.6), (9.4, 9.6), (8.0, 12.7), (5.6, 14.2), (3.2, 14.0)]]),
+    (ord("C"), 12, [_arc(6.4, 8.0, 4.2, 6.3, 45, 315)]),
+    (0xF7, 8, [_ring(3.6, 3.8, 1.9, 1.9)]),   # Derece işareti (GFX klasik yazı tipindeki kod)
+]
+
+def _segment_distance(px, py, ax, ay, bx, by):
+    dx, dy = bx - ax, by - ay
+    length = dx * dx + dy * dy
+    t = 0.0 if length == 0 else max(0.0, min(1.0, ((px - ax) * dx + (py - ay) * dy) / length))
+    qx, qy = ax + t * dx - px, ay + t * dy - py
+    return math.sqrt(qx * qx + qy * qy)
+
+def _rasterize(width, strokes):
+    segments = []
+    for stroke in strokes:
+        if len(stroke) == 1:
+            segments.append(stroke[0] + stroke[0])
+        for a, b in zip(stroke, stroke[1:]):
+            segments.append(a + b)
+    
+    n = GLYPH_SUPERSAMPLE
+    alpha = []
+    for y in range(GLYPH_HEIGHT):
+        for x in range(width):
+            # Yalnızca pikselin yakınındaki parçalar örneklenir
+            near = [s for s in segments
+                    if min(s[0], s[2]) - 2 <= x + 1 and max(s[0], s[2]) + 2 >= x
+                    and min(s[1], s[3]) - 2 <= y + 1 and max(s[1], s[3]) + 2 >= y]
+            hits = 0
+            for sy in range(n):
+                for sx in range(n):
+                    px = x + (sx + 0.5) / n
+                    py = y + (sy + 0.5) / n
+                    for s in near:
+                        if _segment_distance(px, py, *s) <= GLYPH_STROKE:
+                            hits += 1
+                            break
+            alpha.append((hits * 15 + (n * n) // 2) // (n * n))
+    return alpha
+
+def build_glyph_atlas():
+    table = []
+    data = bytearray()
+    for code, width, strokes in GLYPH_STROKES:
+        alpha = _rasterize(width, strokes)
+        table.append((code, width, len(data)))
+        # Satır başına 4 bit/piksel, satırlar bayt sınırına hizalı
+        for y in range(GLYPH_HEIGHT):
+            row = alpha[y * width:(y + 1) * width]
+            if width % 2:
+                row = row + [0]
+            for i in range(0, len(row), 2):
+                data.append((row[i] << 4) | row[i + 1])
+    return table, bytes(data)
+
+def generate_glyph_atlas():
+    project_dir = env.subst("$PROJECT_DIR")
+    output_path = os.path.join(project_dir, "src", "glyph_atlas_data.cpp")
+    
+    table, data = build_glyph_atlas()
+    
+    lines = [
+        "// OTOMATİK ÜRETİLDİ - scripts/pre_build.py (elle düzenlemeyin)",
+        "// Kaynak: GLYPH_STROKES tablosu (kenar yumuşatmalı büyük rakamlar)",
+        "",
+        '#include "glyph_atlas.h"',
+        "",
+        "static const uint8_t GLYPH_ALPHA_LARGE[] PROGMEM = {",
+    ]
+    for offset in range(0, len(data), 16):
+        chunk = data[offset:offset + 16]
+        lines.append("    " + ", ".join("0x%02x" % b for b in chunk) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const GlyphInfo GLYPH_TABLE_LARGE[] = {")
+    for code, width, offset in table:
+        lines.append("    { 0x%02x, %d, %d }," % (code, width, offset))
+    lines.append("};")
+    lines.append("")
+    lines.append("static_assert(GLYPH_LARGE_HEIGHT == %d, \"GLYPH_LARGE_HEIGHT pre_build.py ile uyumsuz\");" % GLYPH_HEIGHT)
+    lines.append("static_assert(GLYPH_LARGE_MAX_WIDTH >= %d, \"GLYPH_LARGE_MAX_WIDTH en geniş glif için yetersiz\");"
+                 % max(width for _, width, _ in table))
+    lines.append("")
+    lines.append("const GlyphAtlas GLYPH_ATLAS_LARGE = { GLYPH_TABLE_LARGE, %d, GLYPH_ALPHA_LARGE };" % len(table))
+    lines.append("")
+    
+    print("Ekran: %d glif, %d bayt (4 bit alfa)" % (len(table), len(data)))
+    
+    content = "\r\n".join(lines)
+    
+    # İçerik değişmediyse dosyaya dokunma (gereksiz yeniden derlemeyi önler)
+    if os.path.exists(output_path):
+        with open(output_path, "r", encoding="utf-8", newline="") as existing:
+            if existing.read() == content:
+                return
+    
+    with open(output_path, "w", encoding="utf-8", newline="") as output:
+        output.write(content)
+
 def before_build(source, target, env):
     print("FRAM Modülü Aktif - 32KB hızlı bellek kullanılacak")
     print("I2C Bus Yönetimi Aktif - Thread-safe erişim sağlanacak")
@@ -11,4 +200,8 @@ def before_build(source, target, env):
     else:
         print("✗ UYARI: FRAM desteği etkin değil!")
 
-env.AddPreAction("buildprog", before_build)
\ No newline at end of file
+# Kaynaklar derlenmeden önce web dosyalarını ve glif atlasını üret
+generate_web_assets()
+generate_glyph_atlas()
+
+env.AddPreAction("buildprog", before_build)
@@ -0,0 +1,1217 @@
+/**
+ * @file async_http_server.cpp
+ * @brief Engellemeyen, çok istemcili HTTP sunucusu uygulaması
+ * @version 1.0
+ */
+
+#include "async_http_server.h"
+#include <lwip/sockets.h>
+
+// Maliyet sınıfı başına kova kapasitesi ve bir jetonun dolma süresi (ms)
+static const uint16_t RATE_BURST[HTTP_COST_CLASS_COUNT] = {
+    WEB_RATE_LIGHT_BURST, WEB_RATE_NORMAL_BURST, WEB_RATE_HEAVY_BURST
+};
+static const uint32_t RATE_REFILL_MS[HTTP_COST_CLASS_COUNT] = {
+    WEB_RATE_LIGHT_REFILL_MS, WEB_RATE_NORMAL_REFILL_MS, WEB_RATE_HEAVY_REFILL_MS
+};
+
+static const char HTTP_CONTINUE[] = "HTTP/1.1 100 Continue\r\n\r\n";
+static const char HTTP_BUSY[] =
+    "HTTP/1.1 503 Service Unavailable\r\n"
+    "Content-Length: 0\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+
+AsyncHttpServer::AsyncHttpServer(uint16_t port) : _server(port) {
+    _running = false;
+    _routeCount = 0;
+    _collectedHeaderCount = 0;
+    _current = nullptr;
+    _uploadOwner = -1;
+    _peakConnections = 0;
+    _servedRequests = 0;
+    _rejectedConnections = 0;
+    _timedOutConnections = 0;
+    _evictedConnections = 0;
+    _rateLimitedRequests = 0;
+    
+    for (uint8_t i = 0; i < WEB_MAX_CLIENTS; i++) {
+        _connections[i].state = CONNECTION_FREE;
+    }
+    
+    for (uint8_t i = 0; i < WEB_RATE_LIMIT_CLIENTS; i++) {
+        _rateClients[i].address = 0;
+    }
+    
+    _overflowClient.address = 0;
+    _overflowClient.lastSeen = 0;
+    for (uint8_t i = 0; i < HTTP_COST_CLASS_COUNT; i++) {
+        _overflowClient.tokens[i] = RATE_BURST[i];
+        _overflowClient.lastRefill[i] = 0;
+    }
+}
+
+AsyncHttpServer::~AsyncHttpServer() {
+    stop();
+}
+
+void AsyncHttpServer::begin() {
+    if (_running) {
+        return;
+    }
+    
+    _server.begin();
+    _server.setNoDelay(true);
+    _running = true;
+}
+
+void AsyncHttpServer::stop() {
+    for (uint8_t i = 0; i < WEB_MAX_CLIENTS; i++) {
+        _close(_connections[i], i);
+    }
+    
+    if (_running) {
+        _server.end();
+        _running = false;
+    }
+}
+
+void AsyncHttpServer::handleClient() {
+    if (!_running) {
+        return;
+    }
+    
+    _acceptClients();
+    
+    for (uint8_t i = 0; i < WEB_MAX_CLIENTS; i++) {
+        Connection& connection = _connections[i];
+        
+        switch (connection.state) {
+            case CONNECTION_FREE:
+                continue;
+                
+            case CONNECTION_READ_HEADERS:
+            case CONNECTION_READ_BODY:
+                // İstemci gitti ve okunacak bayt kalmadıysa bağlantıyı bırak
+                if (!connection.client.connected() && connection.client.available() <= 0) {
+                    _close(connection, i);
+                    continue;
+                }
+                if (connection.state == CONNECTION_READ_HEADERS) {
+                    _readHeaders(connection, i);
+                } else {
+                    _readBody(connection, i);
+                }
+                break;
+                
+            case CONNECTION_WRITE:
+                break;
+        }
+        
+        // Yanıt hazırsa (aynı turda üretilmiş olabilir) soket kabul ettiği kadar gönder
+        if (connection.state == CONNECTION_WRITE) {
+            _flush(connection, i);
+        }
+        
+        if (connection.state != CONNECTION_FREE &&
+            millis() - connection.lastActivity > WEB_REQUEST_TIMEOUT) {
+            _timedOutConnections++;
+            _close(connection, i);
+        }
+        
+        // Başlığını bayt bayt gönderen istemci her baytta etkinlik süresini
+        // yeniler; başlık için kabulden itibaren ayrıca kesin bir süre tanınır
+        if (connection.state == CONNECTION_READ_HEADERS &&
+            millis() - connection.acceptedAt > WEB_HEADER_TIMEOUT) {
+            _timedOutConnections++;
+            _close(connection, i);
+        }
+    }
+}
+
+void AsyncHttpServer::on(const char* uri, HTTPMethod method, HttpHandlerFunction handler) {
+    on(uri, method, handler, nullptr);
+}
+
+void AsyncHttpServer::on(const char* uri, HTTPMethod method, HttpHandlerFunction handler,
+                         HttpHandlerFunction uploadHandler) {
+    if (_routeCount >= WEB_MAX_ROUTES) {
+        Serial.println("HTTP: Rota tablosu dolu, eklenemedi: " + String(uri));
+        return;
+    }
+    
+    Route& route = _routes[_routeCount++];
+    route.uri = uri;
+    route.method = method;
+    route.handler = handler;
+    route.uploadHandler = uploadHandler;
+    route.cost = (method == HTTP_GET) ? HTTP_COST_LIGHT : HTTP_COST_NORMAL;
+    route.calls = 0;
+    route.limited = 0;
+    route.totalMicros = 0;
+    route.maxMicros = 0;
+    route.maxHeapDrop = 0;
+}
+
+void AsyncHttpServer::setRouteCost(const char* uri, HttpRouteCost cost) {
+    for (uint8_t i = 0; i < _routeCount; i++) {
+        if (_routes[i].uri == uri) {
+            _routes[i].cost = cost;
+        }
+    }
+}
+
+void AsyncHttpServer::onNotFound(HttpHandlerFunction handler) {
+    _notFoundHandler = handler;
+}
+
+void AsyncHttpServer::setUploadWindow(HttpUploadWindowFunction window) {
+    _uploadWindow = window;
+}
+
+void AsyncHttpServer::collectHeaders(const char* headerKeys[], const size_t headerKeysCount) {
+    _collectedHeaderCount = 0;
+    for (size_t i = 0; i < headerKeysCount && _collectedHeaderCount < WEB_MAX_COLLECTED_HEADERS; i++) {
+        _collectedHeaders[_collectedHeaderCount++] = headerKeys[i];
+    }
+}
+
+String AsyncHttpServer::arg(const String& name) const {
+    if (_current == nullptr) {
+        return String();
+    }
+    
+    if (name == "plain") {
+        return _current->body;
+    }
+    
+    String value;
+    if (_findArg(_current->query, name, &value)) {
+        return value;
+    }
+    if (_current->contentType.startsWith("application/x-www-form-urlencoded") &&
+        _findArg(_current->body, name, &value)) {
+        return value;
+    }
+    return String();
+}
+
+bool AsyncHttpServer::hasArg(const String& name) const {
+    if (_current == nullptr) {
+        return false;
+    }
+    
+    if (name == "plain") {
+        return _current->body.length() > 0;
+    }
+    
+    return _findArg(_current->query, name, nullptr) ||
+           (_current->contentType.startsWith("application/x-www-form-urlencoded") &&
+            _findArg(_current->body, name, nullptr));
+}
+
+String AsyncHttpServer::header(const String& name) const {
+    if (_current != nullptr) {
+        for (uint8_t i = 0; i < _collectedHeaderCount; i++) {
+            if (_collectedHeaders[i].equalsIgnoreCase(name)) {
+                return _current->headerValues[i];
+            }
+        }
+    }
+    return String();
+}
+
+bool AsyncHttpServer::hasHeader(const String& name) const {
+    if (_current != nullptr) {
+        for (uint8_t i = 0; i < _collectedHeaderCount; i++) {
+            if (_collectedHeaders[i].equalsIgnoreCase(name)) {
+                return _current->headerPresent[i];
+            }
+        }
+    }
+    return false;
+}
+
+String AsyncHttpServer::uri() const {
+    return _current ? _current->path : String();
+}
+
+HTTPMethod AsyncHttpServer::method() const {
+    return _current ? _current->method : HTTP_ANY;
+}
+
+size_t AsyncHttpServer::contentLength() const {
+    return _current ? _current->contentLength : 0;
+}
+
+HTTPUpload& AsyncHttpServer::upload() {
+    return _upload;
+}
+
+void AsyncHttpServer::sendHeader(const String& name, const String& value) {
+    if (_current == nullptr || _current->responded) {
+        return;
+    }
+    
+    _current->extraHeaders += name;
+    _current->extraHeaders += ": ";
+    _current->extraHeaders += value;
+    _current->extraHeaders += "\r\n";
+}
+
+void AsyncHttpServer::send(int code, const char* contentType, const String& content) {
+    _queueResponse(code, contentType, content.c_str(), content.length());
+}
+
+void AsyncHttpServer::send(int code, const String& contentType, const String& content) {
+    _queueResponse(code, contentType.c_str(), content.c_str(), content.length());
+}
+
+void AsyncHttpServer::send_P(int code, const char* contentType, const char* content, size_t contentLength) {
+    // İçerik bağlantının çıkış buffer'ına kopyalanır; çağıranın buffer'ı hemen tekrar kullanılabilir
+    _queueResponse(code, contentType, content, contentLength);
+}
+
+void AsyncHttpServer::sendStatic(int code, const char* contentType, const uint8_t* content, size_t contentLength) {
+    _queueResponse(code, contentType, (const char*)content, contentLength, false);
+}
+
+void AsyncHttpServer::sendBuffer(int code, const char* contentType, const uint8_t* content, size_t contentLength,
+                                 HttpReleaseFunction release) {
+    if (_current == nullptr || _current->responded) {
+        // Yanıt gönderilmeyecek; buffer beklemeden geri verilir
+        if (release) {
+            release();
+        }
+        return;
+    }
+    
+    _queueResponse(code, contentType, (const char*)content, contentLength, false);
+    _current->release = release;
+}
+
+uint8_t AsyncHttpServer::getActiveConnections() const {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < WEB_MAX_CLIENTS; i++) {
+        if (_connections[i].state != CONNECTION_FREE) {
+            count++;
+        }
+    }
+    return count;
+}
+
+uint8_t AsyncHttpServer::getPeakConnections() const {
+    return _peakConnections;
+}
+
+uint32_t AsyncHttpServer::getServedRequests() const {
+    return _servedRequests;
+}
+
+uint32_t AsyncHttpServer::getRejectedConnections() const {
+    return _rejectedConnections;
+}
+
+uint32_t AsyncHttpServer::getTimedOutConnections() const {
+    return _timedOutConnections;
+}
+
+uint32_t AsyncHttpServer::getEvictedConnections() const {
+    return _evictedConnections;
+}
+
+uint32_t AsyncHttpServer::getRateLimitedRequests() const {
+    return _rateLimitedRequests;
+}
+
+uint8_t AsyncHttpServer::getRateLimitClientCount() const {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < WEB_RATE_LIMIT_CLIENTS; i++) {
+        if (_rateClients[i].address != 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
+uint8_t AsyncHttpServer::getRouteCount() const {
+    return _routeCount;
+}
+
+bool AsyncHttpServer::getRouteStats(uint8_t index, HttpRouteStats& stats) const {
+    if (index >= _routeCount) {
+        return false;
+    }
+    
+    const Route& route = _routes[index];
+    stats.uri = route.uri.c_str();
+    stats.method = route.method;
+    stats.cost = route.cost;
+    stats.calls = route.calls;
+    stats.limited = route.limited;
+    stats.totalMicros = route.totalMicros;
+    stats.maxMicros = route.maxMicros;
+    stats.maxHeapDrop = route.maxHeapDrop;
+    return true;
+}
+
+void AsyncHttpServer::_acceptClients() {
+    // Tur başına en fazla slot sayısı kadar yeni bağlantı kabul et
+    for (uint8_t attempt = 0; attempt < WEB_MAX_CLIENTS; attempt++) {
+        WiFiClient client = _server.available();
+        if (!client) {
+            return;
+        }
+        
+        int8_t slot = -1;
+        for (uint8_t i = 0; i < WEB_MAX_CLIENTS; i++) {
+            if (_connections[i].state == CONNECTION_FREE) {
+                slot = i;
+                break;
+            }
+        }
+        
+        // Slotlar doluysa başlığını hâlâ tamamlamamış en eski bağlantı 503 ile
+        // kapatılır; yavaş başlık gönderen istemciler WEB_HEADER_TIMEOUT boyunca
+        // bütün slotları tutamaz
+        if (slot < 0) {
+            slot = _findEvictableConnection();
+            if (slot >= 0) {
+                Connection& victim = _connections[slot];
+                victim.client.write((const uint8_t*)HTTP_BUSY, sizeof(HTTP_BUSY) - 1);
+                _evictedConnections++;
+                _close(victim, slot);
+            }
+        }
+        
+        if (slot >= 0) {
+            Connection& connection = _connections[slot];
+            connection.client = client;
+            connection.remoteAddress = (uint32_t)client.remoteIP();
+            connection.state = CONNECTION_READ_HEADERS;
+            connection.lastActivity = millis();
+            connection.acceptedAt = connection.lastActivity;
+            connection.headLength = 0;
+            connection.method = HTTP_ANY;
+            connection.routeIndex = -1;
+            connection.contentLength = 0;
+            connection.received = 0;
+            connection.multipart = false;
+            connection.partIsFile = false;
+            connection.responded = false;
+            connection.extraHeaders = "";
+            connection.outOffset = 0;
+            connection.staticBody = nullptr;
+            connection.staticLength = 0;
+            connection.staticOffset = 0;
+            
+            uint8_t active = getActiveConnections();
+            if (active > _peakConnections) {
+                _peakConnections = active;
+            }
+        } else {
+            // Tüm slotlar dolu ve boşaltılabilecek bağlantı yok: beklemeden reddet. Okunmamış istek baytıyla
+            // kapatmak RST gönderir ve istemci 503'ü hiç görmeyebilir
+            _rejectedConnections++;
+            client.write((const uint8_t*)HTTP_BUSY, sizeof(HTTP_BUSY) - 1);
+            uint8_t discard[64];
+            size_t drained = 0;
+            while (client.available() > 0 && drained < WEB_READ_BUDGET) {
+                int count = client.read(discard, sizeof(discard));
+                if (count <= 0) {
+                    break;
+                }
+                drained += count;
+            }
+            client.stop();
+        }
+    }
+}
+
+int8_t AsyncHttpServer::_findEvictableConnection() {
+    // Yeni kabul edilmiş bağlantılara başlıklarını okuyabilmeleri için süre tanınır
+    unsigned long now = millis();
+    int8_t oldest = -1;
+    for (uint8_t i = 0; i < WEB_MAX_CLIENTS; i++) {
+        const Connection& connection = _connections[i];
+        if (connection.state != CONNECTION_READ_HEADERS || now - connection.acceptedAt < WEB_HEADER_EVICT_AGE) {
+            continue;
+        }
+        if (oldest < 0 || now - connection.acceptedAt > now - _connections[oldest].acceptedAt) {
+            oldest = i;
+        }
+    }
+    return oldest;
+}
+
+void AsyncHttpServer::_readHeaders(Connection& connection, uint8_t index) {
+    int available = connection.client.available();
+    if (available <= 0) {
+        return;
+    }
+    
+    size_t space = WEB_HEADER_BUFFER_SIZE - 1 - connection.headLength;
+    if (space == 0) {
+        _reject(connection, 431, "Request header too large");
+        return;
+    }
+    
+    int count = connection.client.read((uint8_t*)connection.head + connection.headLength,
+                                       min((size_t)available, space));
+    if (count <= 0) {
+        return;
+    }
+    
+    // Sonlandırıcı iki okuma arasında bölünmüş olabilir
+    size_t searchFrom = (connection.headLength >= 3) ? connection.headLength - 3 : 0;
+    connection.headLength += count;
+    connection.head[connection.headLength] = '\0';
+    connection.lastActivity = millis();
+    
+    char* end = strstr(connection.head + searchFrom, "\r\n\r\n");
+    if (end == nullptr) {
+        if (connection.headLength >= WEB_HEADER_BUFFER_SIZE - 1) {
+            _reject(connection, 431, "Request header too large");
+        }
+        return;
+    }
+    
+    size_t headEnd = end - connection.head;
+    if (!_parseHead(connection, headEnd)) {
+        _reject(connection, 400, "Bad request");
+        return;
+    }
+    
+    // Gövde okunmadan önce istemcinin bu maliyet sınıfındaki kovası denetlenir
+    uint32_t retryAfter = 0;
+    if (!_takeToken(connection, &retryAfter)) {
+        _rateLimitedRequests++;
+        if (connection.routeIndex >= 0) {
+            _routes[connection.routeIndex].limited++;
+        }
+        _reject(connection, 429, "Too many requests", retryAfter);
+        return;
+    }
+    
+    // Başlıkla birlikte gelen gövde baytları
+    size_t bodyStart = headEnd + 4;
+    _startBody(connection, index, (const uint8_t*)connection.head + bodyStart,
+               connection.headLength - bodyStart);
+}
+
+bool AsyncHttpServer::_parseHead(Connection& connection, size_t headEnd) {
+    connection.head[headEnd] = '\0';
+    
+    char* line = connection.head;
+    char* next = strstr(line, "\r\n");
+    if (next != nullptr) {
+        *next = '\0';
+        next += 2;
+    }
+    
+    // İstek satırı: METHOD URI HTTP/1.x
+    char* firstSpace = strchr(line, ' ');
+    if (firstSpace == nullptr) {
+        return false;
+    }
+    char* target = firstSpace + 1;
+    char* secondSpace = strchr(target, ' ');
+    if (secondSpace == nullptr) {
+        return false;
+    }
+    *secondSpace = '\0';
+    
+    connection.method = _parseMethod(line, firstSpace - line);
+    if (connection.method == HTTP_ANY) {
+        return false;
+    }
+    
+    char* question = strchr(target, '?');
+    if (question != nullptr) {
+        *question = '\0';
+        connection.query = question + 1;
+    } else {
+        connection.query = "";
+    }
+    connection.path = _urlDecode(String(target));
+    
+    connection.contentType = "";
+    connection.contentLength = 0;
+    connection.expectContinue = false;
+    for (uint8_t i = 0; i < WEB_MAX_COLLECTED_HEADERS; i++) {
+        connection.headerValues[i] = "";
+        connection.headerPresent[i] = false;
+    }
+    
+    // Başlık satırları
+    while (next != nullptr && *next != '\0') {
+        line = next;
+        next = strstr(line, "\r\n");
+        if (next != nullptr) {
+            *next = '\0';
+            next += 2;
+        }
+        
+        char* colon = strchr(line, ':');
+        if (colon == nullptr) {
+            continue;
+        }
+        *colon = '\0';
+        char* value = colon + 1;
+        while (*value == ' ' || *value == '\t') {
+            value++;
+        }
+        
+        if (strcasecmp(line, "Content-Length") == 0) {
+            connection.contentLength = strtoul(value, nullptr, 10);
+        } else if (strcasecmp(line, "Content-Type") == 0) {
+            connection.contentType = value;
+        } else if (strcasecmp(line, "Expect") == 0) {
+            connection.expectContinue = (strcasecmp(value, "100-continue") == 0);
+        }
+        
+        for (uint8_t i = 0; i < _collectedHeaderCount; i++) {
+            if (_collectedHeaders[i].equalsIgnoreCase(line)) {
+                connection.headerValues[i] = value;
+                connection.headerPresent[i] = true;
+                break;
+            }
+        }
+    }
+    
+    connection.routeIndex = _findRoute(connection.path, connection.method);
+    
+    // Ayrı HEAD rotası yoksa GET handler'ı çalışır; gövde _queueResponse'ta atlanır
+    if (connection.routeIndex < 0 && connection.method == HTTP_HEAD) {
+        connection.routeIndex = _findRoute(connection.path, HTTP_GET);
+    }
+    return true;
+}
+
+void AsyncHttpServer::_startBody(Connection& connection, uint8_t index, const uint8_t* data, size_t length) {
+    connection.state = CONNECTION_READ_BODY;
+    connection.received = 0;
+    connection.body = "";
+    connection.multipart = false;
+    
+    bool hasUpload = (connection.routeIndex >= 0) && (bool)_routes[connection.routeIndex].uploadHandler;
+    
+    if (hasUpload && connection.contentType.startsWith("multipart/form-data")) {
+        int boundaryStart = connection.contentType.indexOf("boundary=");
+        if (boundaryStart < 0) {
+            _reject(connection, 400, "Missing multipart boundary");
+            return;
+        }
+        if (_uploadOwner >= 0) {
+            _reject(connection, 503, "Another upload in progress");
+            return;
+        }
+        
+        String boundary = connection.contentType.substring(boundaryStart + 9);
+        int separator = boundary.indexOf(';');
+        if (separator >= 0) {
+            boundary = boundary.substring(0, separator);
+        }
+        boundary.trim();
+        boundary.replace("\"", "");
+        
+        // Gövdenin başına "\r\n" varmış gibi davranılır; ilk sınır da aynı ayırıcıyla bulunur
+        _uploadOwner = index;
+        connection.multipart = true;
+        connection.multipartState = MULTIPART_PREAMBLE;
+        connection.delimiter = "\r\n--" + boundary;
+        connection.matched = 2;
+        connection.partIsFile = false;
+    } else if (connection.contentLength > WEB_MAX_BODY_SIZE) {
+        _reject(connection, 413, "Request body too large");
+        return;
+    } else if (connection.contentLength > 0) {
+        connection.body.reserve(connection.contentLength);
+    }
+    
+    if (connection.expectContinue && connection.contentLength > length) {
+        connection.client.write((const uint8_t*)HTTP_CONTINUE, sizeof(HTTP_CONTINUE) - 1);
+    }
+    
+    if (length > 0) {
+        _consumeBody(connection, index, data, length);
+    }
+    
+    if (connection.state == CONNECTION_READ_BODY && connection.received >= connection.contentLength) {
+        _dispatch(connection);
+    }
+}
+
+void AsyncHttpServer::_readBody(Connection& connection, uint8_t index) {
+    uint8_t chunk[512];
+    size_t budget = WEB_READ_BUDGET;
+    
+    // Yükleme hedefi (ör. OTA halka tamponu) yetişemiyorsa okumayı kıs
+    if (_uploadWindow && _uploadOwner == index) {
+        budget = min(budget, _uploadWindow());
+        if (budget == 0) {
+            connection.lastActivity = millis(); // Bekleme istemci hatası değil
+        }
+    }
+    
+    // Büyük yüklemeler döngüyü tekelleştirmesin diye tur başına okuma sınırlı
+    while (budget > 0 && connection.state == CONNECTION_READ_BODY &&
+           connection.received < connection.contentLength) {
+        int available = connection.client.available();
+        if (available <= 0) {
+            break;
+        }
+        
+        size_t wanted = min((size_t)available, sizeof(chunk));
+        wanted = min(wanted, connection.contentLength - connection.received);
+        wanted = min(wanted, budget);
+        
+        int count = connection.client.read(chunk, wanted);
+        if (count <= 0) {
+            break;
+        }
+        
+        budget -= count;
+        connection.lastActivity = millis();
+        _consumeBody(connection, index, chunk, count);
+    }
+    
+    if (connection.state == CONNECTION_READ_BODY && connection.received >= connection.contentLength) {
+        _dispatch(connection);
+    }
+}
+
+void AsyncHttpServer::_consumeBody(Connection& connection, uint8_t index, const uint8_t* data, size_t length) {
+    // Content-Length ötesindeki baytlar yok sayılır
+    size_t remaining = connection.contentLength - connection.received;
+    if (length > remaining) {
+        length = remaining;
+    }
+    connection.received += length;
+    
+    if (connection.multipart) {
+        _consumeMultipart(connection, index, data, length);
+    } else {
+        connection.body.concat((const char*)data, length);
+    }
+}
+
+void AsyncHttpServer::_consumeMultipart(Connection& connection, uint8_t index, const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length && connection.state == CONNECTION_READ_BODY; i++) {
+        uint8_t value = data[i];
+        
+        switch (connection.multipartState) {
+            case MULTIPART_PREAMBLE:
+            case MULTIPART_PART_DATA: {
+                bool inData = (connection.multipartState == MULTIPART_PART_DATA);
+                
+                if (value == (uint8_t)connection.delimiter[connection.matched]) {
+                    connection.matched++;
+                    if (connection.matched == connection.delimiter.length()) {
+                        if (inData) {
+                            _endPart(connection, index);
+                        }
+                        connection.multipartState = MULTIPART_AFTER_BOUNDARY;
+                        connection.afterBoundaryLength = 0;
+                        connection.matched = 0;
+                    }
+                    break;
+                }
+                
+                // Eşleşmeyen kısmi ayırıcı veridir. Ayırıcı yalnızca başta '\r' içerdiğinden
+                // eşleşen önekin bir soneki yeni bir eşleşme başlatamaz.
+                if (inData) {
+                    for (size_t k = 0; k < connection.matched; k++) {
+                        _emitUploadByte(connection, index, (uint8_t)connection.delimiter[k]);
+                    }
+                }
+                connection.matched = 0;
+                
+                if (value == '\r') {
+                    connection.matched = 1;
+                } else if (inData) {
+                    _emitUploadByte(connection, index, value);
+                }
+                break;
+            }
+            
+            case MULTIPART_AFTER_BOUNDARY:
+                connection.afterBoundary[connection.afterBoundaryLength++] = value;
+                if (connection.afterBoundaryLength == 2) {
+                    if (connection.afterBoundary[0] == '-' && connection.afterBoundary[1] == '-') {
+                        connection.multipartState = MULTIPART_DONE;
+                    } else if (connection.afterBoundary[0] == '\r' && connection.afterBoundary[1] == '\n') {
+                        connection.multipartState = MULTIPART_PART_HEADERS;
+                        connection.partHeader = "";
+                    } else {
+                        _reject(connection, 400, "Malformed multipart body");
+                    }
+                }
+                break;
+                
+            case MULTIPART_PART_HEADERS:
+                connection.partHeader += (char)value;
+                if (connection.partHeader.length() > WEB_HEADER_BUFFER_SIZE) {
+                    _reject(connection, 431, "Part header too large");
+                } else if (connection.partHeader.endsWith("\r\n\r\n") || connection.partHeader == "\r\n") {
+                    _finishPartHeader(connection, index);
+                }
+                break;
+                
+            case MULTIPART_DONE:
+                // Kapanış sınırından sonraki epilog yok sayılır
+                break;
+        }
+    }
+}
+
+void AsyncHttpServer::_finishPartHeader(Connection& connection, uint8_t index) {
+    String filename = _extractQuoted(connection.partHeader, "filename=\"");
+    
+    connection.multipartState = MULTIPART_PART_DATA;
+    connection.matched = 0;
+    connection.partIsFile = (filename.length() > 0);
+    
+    if (connection.partIsFile) {
+        _upload.filename = filename;
+        _upload.name = _extractQuoted(connection.partHeader, "; name=\"");
+        
+        String type;
+        int typeStart = connection.partHeader.indexOf("Content-Type:");
+        if (typeStart >= 0) {
+            int typeEnd = connection.partHeader.indexOf("\r\n", typeStart);
+            type = connection.partHeader.substring(typeStart + 13, typeEnd);
+            type.trim();
+        }
+        _upload.type = type;
+        _upload.totalSize = 0;
+        _upload.currentSize = 0;
+        
+        _callUpload(connection, index, UPLOAD_FILE_START);
+    }
+    
+    connection.partHeader = "";
+}
+
+void AsyncHttpServer::_endPart(Connection& connection, uint8_t index) {
+    if (!connection.partIsFile) {
+        return;
+    }
+    
+    if (_upload.currentSize > 0) {
+        _callUpload(connection, index, UPLOAD_FILE_WRITE);
+        if (connection.state != CONNECTION_READ_BODY) {
+            return;
+        }
+    }
+    _upload.totalSize += _upload.currentSize;
+    _upload.currentSize = 0;
+    
+    connection.partIsFile = false;
+    _callUpload(connection, index, UPLOAD_FILE_END);
+}
+
+void AsyncHttpServer::_emitUploadByte(Connection& connection, uint8_t index, uint8_t value) {
+    if (!connection.partIsFile || connection.state != CONNECTION_READ_BODY) {
+        return;
+    }
+    
+    if (_upload.currentSize == HTTP_UPLOAD_BUFLEN) {
+        _callUpload(connection, index, UPLOAD_FILE_WRITE);
+        _upload.totalSize += _upload.currentSize;
+        _upload.currentSize = 0;
+        if (connection.state != CONNECTION_READ_BODY) {
+            return;
+        }
+    }
+    
+    _upload.buf[_upload.currentSize++] = value;
+}
+
+void AsyncHttpServer::_callUpload(Connection& connection, uint8_t index, HTTPUploadStatus status) {
+    if (connection.routeIndex < 0 || !_routes[connection.routeIndex].uploadHandler) {
+        return;
+    }
+    
+    _upload.status = status;
+    
+    Connection* previous = _current;
+    _current = &connection;
+    unsigned long startMicros = micros();
+    uint32_t startHeap = ESP.getFreeHeap();
+    _routes[connection.routeIndex].uploadHandler();
+    _account(_routes[connection.routeIndex], startMicros, startHeap, false);
+    _current = previous;
+    
+    // Yükleme handler'ı hata yanıtı verdiyse gövdenin kalanı okunmaz
+    if (connection.responded) {
+        connection.partIsFile = false;
+        if (_uploadOwner == index) {
+            _uploadOwner = -1;
+        }
+    }
+}
+
+void AsyncHttpServer::_dispatch(Connection& connection) {
+    _current = &connection;
+    
+    if (connection.routeIndex >= 0) {
+        Route& route = _routes[connection.routeIndex];
+        unsigned long startMicros = micros();
+        uint32_t startHeap = ESP.getFreeHeap();
+        route.handler();
+        _account(route, startMicros, startHeap, true);
+    } else if (_notFoundHandler) {
+        _notFoundHandler();
+    } else {
+        send(404, "text/plain", "Not found");
+    }
+    
+    if (!connection.responded) {
+        send(500, "text/plain", "No response");
+    }
+    
+    _current = nullptr;
+    _servedRequests++;
+    
+    // Gövde artık gerekmez
+    connection.body = String();
+}
+
+void AsyncHttpServer::_flush(Connection& connection, uint8_t index) {
+    size_t total = connection.out.length();
+    
+    if (connection.outOffset < total) {
+        // Engellemeyen gönderim: soket buffer'ı doluysa bir sonraki turda devam edilir
+        int sent = lwip_send(connection.client.fd(), connection.out.c_str() + connection.outOffset,
+                             total - connection.outOffset, MSG_DONTWAIT);
+        if (sent > 0) {
+            connection.outOffset += sent;
+            connection.lastActivity = millis();
+        } else if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+            _close(connection, index);
+            return;
+        }
+    }
+    
+    // Başlıklar gittikten sonra kalıcı gövde doğrudan kaynağından gönderilir
+    if (connection.outOffset >= total && connection.staticOffset < connection.staticLength) {
+        int sent = lwip_send(connection.client.fd(), connection.staticBody + connection.staticOffset,
+                             connection.staticLength - connection.staticOffset, MSG_DONTWAIT);
+        if (sent > 0) {
+            connection.staticOffset += sent;
+            connection.lastActivity = millis();
+        } else if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+            _close(connection, index);
+            return;
+        }
+    }
+    
+    if (connection.outOffset >= total && connection.staticOffset >= connection.staticLength) {
+        _close(connection, index);
+    }
+}
+
+void AsyncHttpServer::_close(Connection& connection, uint8_t index) {
+    if (connection.state == CONNECTION_FREE) {
+        return;
+    }
+    
+    // Yarım kalan dosya yüklemesini handler'a bildir
+    if (_uploadOwner == index) {
+        if (connection.partIsFile) {
+            connection.partIsFile = false;
+            _callUpload(connection, index, UPLOAD_FILE_ABORTED);
+        }
+        _uploadOwner = -1;
+    }
+    
+    // Okunmamış bayt varken kapatmak RST gönderir; yanıtın ulaşması için kalanı boşalt
+    uint8_t discard[64];
+    size_t drained = 0;
+    while (connection.client.available() > 0 && drained < WEB_READ_BUDGET) {
+        int count = connection.client.read(discard, sizeof(discard));
+        if (count <= 0) {
+            break;
+        }
+        drained += count;
+    }
+    
+    // Ödünç gövde buffer'ı artık okunmayacak
+    if (connection.release) {
+        HttpReleaseFunction release = connection.release;
+        connection.release = nullptr;
+        release();
+    }
+    
+    connection.client.stop();
+    connection.client = WiFiClient();
+    connection.state = CONNECTION_FREE;
+    connection.body = String();
+    connection.out = String();
+    connection.extraHeaders = String();
+    connection.partHeader = String();
+}
+
+void AsyncHttpServer::_reject(Connection& connection, int code, const char* message, uint32_t retryAfter) {
+    Connection* previous = _current;
+    _current = &connection;
+    if (retryAfter > 0) {
+        sendHeader("Retry-After", String(retryAfter));
+    }
+    send(code, "text/plain", message);
+    _current = previous;
+}
+
+int AsyncHttpServer::_findRoute(const String& path, HTTPMethod method) const {
+    for (uint8_t i = 0; i < _routeCount; i++) {
+        const Route& route = _routes[i];
+        if ((route.method == HTTP_ANY || route.method == method) && route.uri == path) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void AsyncHttpServer::_refillTokens(RateLimitClient& client, uint8_t cost, unsigned long now) {
+    // Geçen süre kadar jeton ekle; kısmi süre bir sonraki dolum için korunur
+    uint32_t refillMs = RATE_REFILL_MS[cost];
+    uint32_t earned = (now - client.lastRefill[cost]) / refillMs;
+    if (earned > 0) {
+        uint32_t tokens = client.tokens[cost] + earned;
+        if (tokens >= RATE_BURST[cost]) {
+            client.tokens[cost] = RATE_BURST[cost];
+            client.lastRefill[cost] = now;
+        } else {
+            client.tokens[cost] = tokens;
+            client.lastRefill[cost] += earned * refillMs;
+        }
+    }
+}
+
+bool AsyncHttpServer::_isRefilled(const RateLimitClient& client, unsigned long now) const {
+    // Kovaları dolmuş kayıt silinse de istemci yeni kayıtta aynı jetonlarla başlar
+    for (uint8_t i = 0; i < HTTP_COST_CLASS_COUNT; i++) {
+        uint32_t earned = (now - client.lastRefill[i]) / RATE_REFILL_MS[i];
+        if (client.tokens[i] + earned < RATE_BURST[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool AsyncHttpServer::_takeToken(Connection& connection, uint32_t* retryAfter) {
+    // Adresi bilinmeyen istemci ayırt edilemez; sınırlanmaz
+    if (connection.remoteAddress == 0) {
+        return true;
+    }
+    
+    HttpRouteCost cost = (connection.routeIndex >= 0) ? _routes[connection.routeIndex].cost : HTTP_COST_LIGHT;
+    unsigned long now = millis();
+    
+    // İstemci kaydını bul; yoksa boş ya da kovaları tamamen dolmuş en eski kaydı devral.
+    // Dolmamış bir kaydı silmek, IP değiştiren istemciye her seferinde tam kova verirdi
+    RateLimitClient* client = nullptr;
+    RateLimitClient* reusable = nullptr;
+    for (uint8_t i = 0; i < WEB_RATE_LIMIT_CLIENTS; i++) {
+        RateLimitClient& candidate = _rateClients[i];
+        if (candidate.address == connection.remoteAddress) {
+            client = &candidate;
+            break;
+        }
+        if (reusable != nullptr && reusable->address == 0) {
+            continue;
+        }
+        if (candidate.address == 0) {
+            reusable = &candidate;
+        } else if (_isRefilled(candidate, now) &&
+                   (reusable == nullptr || now - candidate.lastSeen > now - reusable->lastSeen)) {
+            reusable = &candidate;
+        }
+    }
+    
+    if (client == nullptr && reusable != nullptr) {
+        client = reusable;
+        client->address = connection.remoteAddress;
+        for (uint8_t i = 0; i < HTTP_COST_CLASS_COUNT; i++) {
+            client->tokens[i] = RATE_BURST[i];
+            client->lastRefill[i] = now;
+        }
+    }
+    
+    // Tablo doluysa izlenmeyen tüm istemciler ortak taşma kovasını paylaşır
+    if (client == nullptr) {
+        client = &_overflowClient;
+    }
+    client->lastSeen = now;
+    
+    _refillTokens(*client, cost, now);
+    
+    if (client->tokens[cost] > 0) {
+        client->tokens[cost]--;
+        return true;
+    }
+    
+    uint32_t waitMs = RATE_REFILL_MS[cost] - (now - client->lastRefill[cost]);
+    *retryAfter = (waitMs + 999) / 1000;
+    return false;
+}
+
+void AsyncHttpServer::_account(Route& route, unsigned long startMicros, uint32_t startHeap, bool countCall) {
+    uint32_t elapsed = micros() - startMicros;
+    uint32_t heap = ESP.getFreeHeap();
+    
+    if (countCall) {
+        route.calls++;
+    }
+    route.totalMicros += elapsed;
+    if (elapsed > route.maxMicros) {
+        route.maxMicros = elapsed;
+    }
+    if (heap < startHeap && startHeap - heap > route.maxHeapDrop) {
+        route.maxHeapDrop = startHeap - heap;
+    }
+}
+
+void AsyncHttpServer::_queueResponse(int code, const char* contentType, const char* content, size_t contentLength,
+                                     bool copyContent) {
+    if (_current == nullptr || _current->responded) {
+        return;
+    }
+    
+    Connection& connection = *_current;
+    
+    // HEAD yanıtı GET ile aynı başlıkları (Content-Length dahil) taşır, gövdesi yoktur
+    if (connection.method == HTTP_HEAD) {
+        copyContent = true;
+        content = nullptr;
+    }
+    bool sendBody = content != nullptr && contentLength > 0;
+    
+    connection.out = "";
+    connection.out.reserve(128 + connection.extraHeaders.length() + (copyContent && sendBody ? contentLength : 0));
+    connection.out += "HTTP/1.1 ";
+    connection.out += code;
+    connection.out += ' ';
+    connection.out += _statusText(code);
+    connection.out += "\r\n";
+    if (contentType != nullptr) {
+        connection.out += "Content-Type: ";
+        connection.out += contentType;
+        connection.out += "\r\n";
+    }
+    connection.out += "Content-Length: ";
+    connection.out += (unsigned long)contentLength;
+    connection.out += "\r\n";
+    connection.out += connection.extraHeaders;
+    connection.out += "Connection: close\r\n\r\n";
+    if (copyContent && sendBody) {
+        connection.out.concat(content, contentLength);
+    }
+    
+    connection.staticBody = (copyContent || !sendBody) ? nullptr : (const uint8_t*)content;
+    connection.staticLength = (copyContent || !sendBody) ? 0 : contentLength;
+    connection.staticOffset = 0;
+    connection.outOffset = 0;
+    connection.responded = true;
+    connection.extraHeaders = "";
+    connection.state = CONNECTION_WRITE;
+}
+
+HTTPMethod AsyncHttpServer::_parseMethod(const char* method, size_t length) {
+    struct MethodName {
+        const char* name;
+        HTTPMethod method;
+    };
+    static const MethodName methods[] = {
+        { "GET", HTTP_GET },
+        { "POST", HTTP_POST },
+        { "PUT", HTTP_PUT },
+        { "DELETE", HTTP_DELETE },
+        { "PATCH", HTTP_PATCH },
+        { "OPTIONS", HTTP_OPTIONS },
+        { "HEAD", HTTP_HEAD }
+    };
+    
+    for (size_t i = 0; i < sizeof(methods) / sizeof(methods[0]); i++) {
+        if (strlen(methods[i].name) == length && strncmp(methods[i].name, method, length) == 0) {
+            return methods[i].method;
+        }
+    }
+    return HTTP_ANY;
+}
+
+const char* AsyncHttpServer::_statusText(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 413: return "Payload Too Large";
+        case 429: return "Too Many Requests";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        case 503: return "Service Unavailable";
+        default:  return "Unknown";
+    }
+}
+
+bool AsyncHttpServer::_findArg(const String& source, const String& name, String* value) {
+    int start = 0;
+    int length = source.length();
+    
+    while (start < length) {
+        int end = source.indexOf('&', start);
+        if (end < 0) {
+            end = length;
+        }
+        
+        int equals = source.indexOf('=', start);
+        bool hasValue = (equals >= 0 && equals < end);
+        String key = _urlDecode(source.substring(start, hasValue ? equals : end));
+        
+        if (key == name) {
+            if (value != nullptr) {
+                *value = hasValue ? _urlDecode(source.substring(equals + 1, end)) : String();
+            }
+            return true;
+        }
+        
+        start = end + 1;
+    }
+    return false;
+}
+
+String AsyncHttpServer::_urlDecode(const String& text) {
+    String decoded;
+    decoded.reserve(text.length());
+    
+    for (unsigned int i = 0; i < text.length(); i++) {
+        char c = text[i];
+        if (c == '+') {
+            decoded += ' ';
+        } else if (c == '%' && i + 2 < text.length()) {
+            char hex[3] = { text[i + 1], text[i + 2], '\0' };
+            decoded += (char)strtol(hex, nullptr, 16);
+            i += 2;
+        } else {
+            decoded += c;
+        }
+    }
+    return decoded;
+}
+
+String AsyncHttpServer::_extractQuoted(const String& line, const char* key) {
+    int start = line.indexOf(key);
+    if (start < 0) {
+        return String();
+    }
+    
+    start += strlen(key);
+    int end = line.indexOf('"', start);
+    if (end < 0) {
+        return String();
+    }
+    return line.substring(start, end);
+}
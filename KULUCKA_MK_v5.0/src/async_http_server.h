@@ -0,0 +1,260 @@
+/**
+ * @file async_http_server.h
+ * @brief Engellemeyen, çok istemcili HTTP sunucusu
+ * @version 1.0
+ */
+
+#ifndef ASYNC_HTTP_SERVER_H
+#define ASYNC_HTTP_SERVER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WebServer.h>   // HTTPMethod ve HTTPUpload tipleri için
+#include <functional>
+#include "config.h"
+
+typedef std::function<void(void)> HttpHandlerFunction;
+
+// Dosya yüklemesi akış denetimi: şu an kabul edilebilecek en fazla bayt
+typedef std::function<size_t(void)> HttpUploadWindowFunction;
+
+// Ödünç verilen yanıt buffer'ı gönderim bitince (ya da bağlantı kapanınca) geri verilir
+typedef std::function<void(void)> HttpReleaseFunction;
+
+// Rota maliyet sınıfları; her sınıfın istemci başına ayrı hız sınırı kovası vardır
+enum HttpRouteCost : uint8_t {
+    HTTP_COST_LIGHT = 0,        // Hafif okumalar (durum, sayfalar)
+    HTTP_COST_NORMAL,           // Ayar değişiklikleri
+    HTTP_COST_HEAVY,            // Tarama, doğrulama, OTA, kalıcı kayıt
+    HTTP_COST_CLASS_COUNT
+};
+
+// Rota başına süre ve heap muhasebesi
+struct HttpRouteStats {
+    const char* uri;
+    HTTPMethod method;
+    HttpRouteCost cost;
+    uint32_t calls;             // Handler çağrı sayısı
+    uint32_t limited;           // Hız sınırına takılan istek sayısı
+    uint64_t totalMicros;       // Handler'larda geçen toplam süre (yükleme dahil)
+    uint32_t maxMicros;         // En uzun tek handler çağrısı
+    uint32_t maxHeapDrop;       // Bir çağrıda serbest heap'teki en büyük düşüş
+};
+
+// WebServer ile aynı handler arayüzünü sunan, olay güdümlü HTTP sunucusu.
+// Her bağlantı kendi durum makinesinde ilerler: istek baytları geldikçe
+// okunur, yanıt soket kabul ettikçe gönderilir. Yavaş ya da takılan bir
+// istemci diğer istemcileri ve ana döngüyü bekletmez. Handler'lar ana
+// döngüden çağrılır; kontrol kodunun durumuna kilitsiz erişebilirler.
+class AsyncHttpServer {
+public:
+    // Yapılandırıcı
+    AsyncHttpServer(uint16_t port = 80);
+    ~AsyncHttpServer();
+    
+    // Sunucuyu başlat / durdur
+    void begin();
+    void stop();
+    
+    // Bağlantıları ilerlet (ana döngüden sık çağrılmalı, hiç beklemez)
+    void handleClient();
+    
+    // Rota tanımlama
+    void on(const char* uri, HTTPMethod method, HttpHandlerFunction handler);
+    void on(const char* uri, HTTPMethod method, HttpHandlerFunction handler,
+            HttpHandlerFunction uploadHandler);
+    void onNotFound(HttpHandlerFunction handler);
+    
+    // Dosya yüklemesi sürerken tur başına okunacak baytı sınırla. Pencere
+    // sıfırsa o tur okunmaz; TCP penceresi dolar ve gönderen yavaşlar.
+    void setUploadWindow(HttpUploadWindowFunction window);
+    
+    // Rota maliyet sınıfı (varsayılan: GET hafif, diğer metotlar normal)
+    void setRouteCost(const char* uri, HttpRouteCost cost);
+    void collectHeaders(const char* headerKeys[], const size_t headerKeysCount);
+    
+    // İstek bilgileri (yalnızca handler içinde geçerli)
+    String arg(const String& name) const;
+    bool hasArg(const String& name) const;
+    String header(const String& name) const;
+    bool hasHeader(const String& name) const;
+    String uri() const;
+    HTTPMethod method() const;
+    size_t contentLength() const;   // İstek gövdesinin Content-Length'i (multipart'ta zarf dahil)
+    HTTPUpload& upload();
+    
+    // Yanıt
+    void sendHeader(const String& name, const String& value);
+    void send(int code, const char* contentType = nullptr, const String& content = String(""));
+    void send(int code, const String& contentType, const String& content);
+    void send_P(int code, const char* contentType, const char* content, size_t contentLength);
+    
+    // Kalıcı (flash'taki) içeriği kopyalamadan gönder; buffer bağlantı kapanana kadar geçerli olmalı
+    void sendStatic(int code, const char* contentType, const uint8_t* content, size_t contentLength);
+    
+    // Havuzdan ödünç alınan buffer'ı kopyalamadan gönder. release, gövde gönderildikten ya da
+    // bağlantı kapandıktan sonra tam bir kez çağrılır (yanıt kuyruğa alınamazsa hemen).
+    void sendBuffer(int code, const char* contentType, const uint8_t* content, size_t contentLength,
+                    HttpReleaseFunction release);
+    
+    // İstatistikler
+    uint8_t getActiveConnections() const;
+    uint8_t getPeakConnections() const;
+    uint32_t getServedRequests() const;
+    uint32_t getRejectedConnections() const;
+    uint32_t getTimedOutConnections() const;
+    uint32_t getEvictedConnections() const;
+    uint32_t getRateLimitedRequests() const;
+    uint8_t getRateLimitClientCount() const;
+    uint8_t getRouteCount() const;
+    bool getRouteStats(uint8_t index, HttpRouteStats& stats) const;
+
+private:
+    enum ConnectionState {
+        CONNECTION_FREE,
+        CONNECTION_READ_HEADERS,
+        CONNECTION_READ_BODY,
+        CONNECTION_WRITE
+    };
+    
+    enum MultipartState {
+        MULTIPART_PREAMBLE,
+        MULTIPART_AFTER_BOUNDARY,
+        MULTIPART_PART_HEADERS,
+        MULTIPART_PART_DATA,
+        MULTIPART_DONE
+    };
+    
+    struct Route {
+        String uri;
+        HTTPMethod method;
+        HttpHandlerFunction handler;
+        HttpHandlerFunction uploadHandler;
+        HttpRouteCost cost;
+        
+        // Muhasebe
+        uint32_t calls;
+        uint32_t limited;
+        uint64_t totalMicros;
+        uint32_t maxMicros;
+        uint32_t maxHeapDrop;
+    };
+    
+    // İstemci (IP) başına maliyet sınıfı kovaları
+    struct RateLimitClient {
+        uint32_t address;           // 0 = boş kayıt
+        unsigned long lastSeen;
+        uint16_t tokens[HTTP_COST_CLASS_COUNT];
+        unsigned long lastRefill[HTTP_COST_CLASS_COUNT];
+    };
+    
+    struct Connection {
+        WiFiClient client;
+        uint32_t remoteAddress;
+        ConnectionState state;
+        unsigned long lastActivity;
+        unsigned long acceptedAt;   // Başlık süresi sınırı için kabul anı
+        
+        // İstek başlığı
+        char head[WEB_HEADER_BUFFER_SIZE];
+        size_t headLength;
+        HTTPMethod method;
+        String path;
+        String query;
+        String contentType;
+        String headerValues[WEB_MAX_COLLECTED_HEADERS];
+        bool headerPresent[WEB_MAX_COLLECTED_HEADERS];
+        int routeIndex;
+        bool expectContinue;
+        
+        // İstek gövdesi
+        size_t contentLength;
+        size_t received;
+        String body;
+        
+        // Multipart yükleme ayrıştırıcısı
+        bool multipart;
+        MultipartState multipartState;
+        String delimiter;           // "\r\n--" + boundary
+        size_t matched;
+        String partHeader;
+        bool partIsFile;
+        uint8_t afterBoundary[2];
+        uint8_t afterBoundaryLength;
+        
+        // Yanıt
+        bool responded;
+        String extraHeaders;
+        String out;
+        size_t outOffset;
+        const uint8_t* staticBody;  // Kopyalanmadan gönderilen gövde (sendStatic / sendBuffer)
+        size_t staticLength;
+        size_t staticOffset;
+        HttpReleaseFunction release; // sendBuffer: gövde buffer'ını havuza geri ver
+    };
+    
+    WiFiServer _server;
+
+    bool _running;
+    
+    Route _routes[WEB_MAX_ROUTES];
+    uint8_t _routeCount;
+    HttpHandlerFunction _notFoundHandler;
+    HttpUploadWindowFunction _uploadWindow;
+    
+    String _collectedHeaders[WEB_MAX_COLLECTED_HEADERS];
+    uint8_t _collectedHeaderCount;
+    
+    Connection _connections[WEB_MAX_CLIENTS];
+    Connection* _current;           // Handler çalışırken işlenen bağlantı
+    
+    RateLimitClient _rateClients[WEB_RATE_LIMIT_CLIENTS];
+    RateLimitClient _overflowClient;    // Tablo doluyken yeni istemcilerin ortak kovası
+    uint32_t _rateLimitedRequests;
+    
+    // Aynı anda tek dosya yüklemesi (HTTPUpload buffer'ı büyük)
+    HTTPUpload _upload;
+    int8_t _uploadOwner;
+    
+    uint8_t _peakConnections;
+    uint32_t _servedRequests;
+    uint32_t _rejectedConnections;
+    uint32_t _timedOutConnections;
+    uint32_t _evictedConnections;
+    
+    // Bağlantı durum makinesi
+    void _acceptClients();
+    int8_t _findEvictableConnection();
+    void _readHeaders(Connection& connection, uint8_t index);
+    bool _parseHead(Connection& connection, size_t headEnd);
+    void _startBody(Connection& connection, uint8_t index, const uint8_t* data, size_t length);
+    void _readBody(Connection& connection, uint8_t index);
+    void _consumeBody(Connection& connection, uint8_t index, const uint8_t* data, size_t length);
+    void _consumeMultipart(Connection& connection, uint8_t index, const uint8_t* data, size_t length);
+    void _finishPartHeader(Connection& connection, uint8_t index);
+    void _endPart(Connection& connection, uint8_t index);
+    void _emitUploadByte(Connection& connection, uint8_t index, uint8_t value);
+    void _callUpload(Connection& connection, uint8_t index, HTTPUploadStatus status);
+    void _dispatch(Connection& connection);
+    void _flush(Connection& connection, uint8_t index);
+    void _close(Connection& connection, uint8_t index);
+    void _reject(Connection& connection, int code, const char* message, uint32_t retryAfter = 0);
+    int _findRoute(const String& path, HTTPMethod method) const;
+    
+    // Hız sınırı ve muhasebe
+    bool _takeToken(Connection& connection, uint32_t* retryAfter);
+    void _refillTokens(RateLimitClient& client, uint8_t cost, unsigned long now);
+    bool _isRefilled(const RateLimitClient& client, unsigned long now) const;
+    void _account(Route& route, unsigned long startMicros, uint32_t startHeap, bool countCall);
+    
+    // Yardımcılar
+    void _queueResponse(int code, const char* contentType, const char* content, size_t contentLength,
+                        bool copyContent = true);
+    static HTTPMethod _parseMethod(const char* method, size_t length);
+    static const char* _statusText(int code);
+    static bool _findArg(const String& source, const String& name, String* value);
+    static String _urlDecode(const String& text);
+    static String _extractQuoted(const String& line, const char* key);
+};
+
+#endif // ASYNC_HTTP_SERVER_H
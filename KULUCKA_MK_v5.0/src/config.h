@@ -56,11 +56,26 @@
 #define AP_PASS "12345678"
 #define WIFI_PORT 80
 
+// Canlı Telemetri Akışı (Server-Sent Events)
+#define SSE_PORT 81                       // SSE akış portu (ana web sunucudan ayrı)
+#define SSE_MAX_CLIENTS 4                 // Aynı anda izleyebilecek istemci sayısı
+#define SSE_FRAME_SIZE 512                // Tek bir olay çerçevesi için buffer boyutu
+#define SSE_MIN_INTERVAL 500              // Çerçeveler arası minimum süre (ms)
+#define SSE_KEEPALIVE_INTERVAL 15000      // Bağlantı canlı tutma aralığı (ms)
+#define SSE_HANDSHAKE_TIMEOUT 2000        // HTTP isteğinin tamamlanma süresi (ms)
+#define SSE_MAX_DROPPED_FRAMES 10         // Art arda düşen çerçeve sınırı (aşılırsa bağlantı kesilir)
+
 // WiFi Bağlantı Zaman Aşımları
 #define WIFI_CONNECTION_TIMEOUT 15000  // 15 saniye bağlantı zaman aşımı
 #define WIFI_RETRY_INTERVAL 30000     // 30 saniye tekrar deneme aralığı
 #define WIFI_MAX_RETRY_COUNT 3        // Maksimum tekrar deneme sayısı
 
+// WiFi Tarama Servisi
+#define WIFI_SCAN_MAX_RESULTS 20          // Önbellekte tutulan en fazla ağ
+#define WIFI_SCAN_MIN_INTERVAL 15000      // İki tarama arasındaki en kısa süre (ms)
+#define WIFI_SCAN_CACHE_MAX_AGE 60000     // Bu süreden eski önbellek istekte yenilenir (ms)
+#define WIFI_SCAN_TIMEOUT 15000           // Takılan taramanın bırakılma süresi (ms)
+
 // EEPROM Ayarları
 #define EEPROM_SIZE 512
 
@@ -92,6 +107,41 @@
 #define PID_KD_MIN 0.1
 #define PID_KD_MAX 100.0
 
+// PID Kazanç Tablosu (Gain Scheduling) Ayarları
+#define PID_SCHEDULE_STAGE_COUNT 2       // Kuluçka aşaması sayısı (Gelişim / Çıkım)
+#define PID_SCHEDULE_BAND_COUNT 3        // Hata bandı sayısı (Yakın / Orta / Uzak)
+#define PID_SCHEDULE_BAND_NEAR 0.3       // |hata| bu değerin altındaysa yakın bant (°C)
+#define PID_SCHEDULE_BAND_FAR 1.0        // |hata| bu değerin üstündeyse uzak bant (°C)
+#define PID_SCHEDULE_BLEND_TIME 60000    // Kazanç geçişi için darbesiz karışım süresi (ms)
+
+// Isıtıcı İleri Besleme (Feed-Forward) Ayarları
+#define FF_ENABLED_DEFAULT true          // Başlangıçta ileri besleme etkin mi
+#define FF_HUMID_INITIAL_BIAS 0.0        // Nemlendirici için başlangıç ısıtıcı katkısı (0-1)
+#define FF_MOTOR_INITIAL_BIAS 0.0        // Motor için başlangıç ısıtıcı katkısı (0-1)
+#define FF_MAX_BIAS 0.5                  // Maksimum ısıtıcı katkısı
+#define FF_MAX_STEP 0.1                  // Bir olay sonrası maksimum katkı değişimi
+#define FF_LEARN_RATE 0.2                // Model tanımlanana kadar katkı/°C adım katsayısı
+#define FF_FORGETTING 0.9                // En küçük kareler unutma katsayısı
+#define FF_MIN_SENSITIVITY 0.05          // Modelin geçerli sayılacağı min. hassasiyet (°C/katkı)
+#define FF_OBSERVE_WINDOW 120000         // Röle kapandıktan sonra düşüş izleme süresi (ms)
+#define FF_MAX_EPISODE_TIME 600000       // Bu süreden uzun olaylar öğrenmeye alınmaz (ms)
+
+// Proses Tanımlama (RLS) ve Sapma Tespiti Ayarları
+#define IDENT_SAMPLE_TIME 10000          // Tanımlama örnekleme süresi (ms)
+#define IDENT_DELAY_CANDIDATES 8         // Denenecek ölü zaman adayı sayısı (0..N-1 örnek)
+#define IDENT_FORGETTING 0.995           // RLS unutma katsayısı
+#define IDENT_COVARIANCE_LIMIT 10000.0   // Kovaryans izi üst sınırı (uyarım yokken)
+#define IDENT_MIN_SAMPLES 60             // Yakınsama için minimum örnek sayısı
+#define IDENT_DRIFT_BAND 0.3             // Referansa göre izin verilen bağıl sapma (%30)
+#define IDENT_DRIFT_PERSIST 30           // Uyarı için sapmanın sürmesi gereken örnek sayısı
+#define IDENT_APPLY_TO_HUMID_MPC true    // Nem modeli tahminini öngörülü kontrolcüye uygula
+#define IDENT_MPC_APPLY_INTERVAL 1800000 // Öngörülü kontrolcü modelinin en sık güncellenme aralığı (ms, 30 dk)
+#define IDENT_MPC_MIN_CHANGE 0.10        // Uygulama için gereken en küçük bağıl model değişimi (%10)
+#define IDENT_HUMID_GAIN_MIN 2.0         // Fiziksel sınır: nemlendirici kalıcı nem artışı alt (%RH)
+#define IDENT_HUMID_GAIN_MAX 60.0        // Fiziksel sınır: nemlendirici kalıcı nem artışı üst (%RH)
+#define IDENT_HUMID_TAU_MIN 30000        // Fiziksel sınır: nem zaman sabiti alt (ms)
+#define IDENT_HUMID_TAU_MAX 3600000      // Fiziksel sınır: nem zaman sabiti üst (ms)
+
 // PID Otomatik Ayarlama Ayarları
 #define PID_AUTOTUNE_TIMEOUT 1800000  // 30 dakika maksimum süre
 #define PID_AUTOTUNE_TEMP_TOLERANCE 2.0  // ±2°C güvenlik sınırı
@@ -109,8 +159,16 @@
 // Ekran Yenileme Gecikmesi (ms) - 3000'den 1000'e düşürüldü
 #define DISPLAY_REFRESH_DELAY 1000
 
-// Joystick okuma gecikmesi (ms)
-#define JOYSTICK_READ_DELAY 100
+// Joystick örnekleme ve olay ayarları
+#define JOYSTICK_SAMPLE_INTERVAL_MS 2      // Eksen/buton örnekleme periyodu (esp_timer)
+#define JOYSTICK_DEADZONE 1800             // Merkezden yön algılama eşiği (ADC birimi)
+#define JOYSTICK_RELEASE_ZONE 900          // Merkeze dönüş eşiği (histerezis)
+#define JOYSTICK_AXIS_DEBOUNCE_SAMPLES 3   // Yön için art arda gereken örnek sayısı
+#define JOYSTICK_DEBOUNCE_MS 20            // Buton debounce süresi
+#define JOYSTICK_REPEAT_DELAY_MS 400       // Otomatik tekrar başlamadan önceki bekleme
+#define JOYSTICK_REPEAT_INTERVAL_MS 150    // Otomatik tekrar aralığı
+#define JOYSTICK_LONG_PRESS_MS 1000        // Uzun basma süresi
+#define JOYSTICK_EVENT_QUEUE_SIZE 16       // Olay kuyruğu boyutu (2'nin kuvveti)
 
 // Varsayılan Motor Ayarları
 #define DEFAULT_MOTOR_WAIT_TIME 120  // Dakika
@@ -149,6 +207,33 @@
 // Ekran Ayarları
 #define SCREEN_WIDTH 160
 #define SCREEN_HEIGHT 128
+#define TFT_SPI_HOST SPI3_HOST            // Panel SPI hattı (VSPI, IOMUX pinleri 18/23/5)
+#define TFT_SPI_FREQUENCY 40000000        // Panel SPI saati (40 MHz)
+#define DISPLAY_MAX_DIRTY_RECTS 16        // Tur başına gönderilen en fazla kirli dikdörtgen
+#define DISPLAY_DMA_CHUNK_SIZE 4096       // DMA aktarım tamponu (x2, dahili RAM)
+#define DISPLAY_DMA_QUEUE_SIZE 8          // Kuyruktaki en fazla SPI aktarımı
+#define DISPLAY_FLUSH_TIMEOUT 200         // Bekleyen gönderim için en uzun bekleme (ms)
+#define WIDGET_TEXT_LENGTH 24             // Etiket metni için en fazla karakter (sonlandırıcı dahil)
+#define WIDGET_SCREEN_CAPACITY 24         // Bir ekrandaki en fazla öğe sayısı
+
+// Ekran Güç Yönetimi (arka ışık PWM + yenileme temposu)
+#define BACKLIGHT_LEDC_TIMER 3            // Arka ışık LEDC zamanlayıcısı (tone() 0'ı kullanır)
+#define BACKLIGHT_LEDC_CHANNEL 7          // Arka ışık LEDC kanalı
+#define BACKLIGHT_PWM_FREQUENCY 5000      // PWM frekansı (Hz)
+#define BACKLIGHT_PWM_RESOLUTION 8        // PWM çözünürlüğü (bit)
+#define BACKLIGHT_FULL 255                // Etkin parlaklık
+#define BACKLIGHT_DIM 24                  // Kısık parlaklık
+#define BACKLIGHT_FADE_MS 400             // Kısılma geçiş süresi (donanım fade)
+#define DISPLAY_DIM_TIMEOUT 60000         // Etkileşimsiz bu süreden sonra kısık mod (ms)
+#define DISPLAY_OFF_TIMEOUT 300000        // Etkileşimsiz bu süreden sonra ekran kapalı (ms)
+#define DISPLAY_IDLE_REFRESH_DELAY 10000  // Kısık modda ana ekran yenileme aralığı (ms)
+
+// Sensör Geçmişi ve Trend Grafiği
+#define HISTORY_BUCKET_SECONDS 60         // Geçmiş kaydı süresi (saniye)
+#define HISTORY_BUCKET_COUNT 1440         // Halkadaki kayıt sayısı (24 saat)
+#define TREND_COLUMNS 120                 // Grafik genişliği (piksel sütunu)
+#define TREND_TEMP_MIN_RANGE 10           // Sıcaklık ekseninin en dar aralığı (0.1 °C)
+#define TREND_HUMID_MIN_RANGE 50          // Nem ekseninin en dar aralığı (0.1 %)
 
 // Renk Tanımları
 #define COLOR_BACKGROUND 0x0000  // Siyah
@@ -161,6 +246,17 @@
 #define COLOR_TARGET 0xFFE0      // Sarı
 #define COLOR_PID_ACTIVE 0x07FF  // Cyan (PID aktif)
 #define COLOR_PID_INACTIVE 0x8410 // Koyu gri (PID inaktif)
+#define COLOR_TREND_TEMP_BAND 0x7800  // Koyu kırmızı (sıcaklık min/max zarfı)
+#define COLOR_TREND_HUMID_BAND 0x0010 // Koyu mavi (nem min/max zarfı)
+
+// Menü Görünüm Ayarları
+#define MENU_VISIBLE_ITEMS 6         // Ekranda aynı anda görünen en fazla menü satırı
+#define MENU_MAX_ITEMS 12            // Bir menüdeki en fazla öğe (koşullu öğeler dahil)
+#define MENU_ROW_TEXT_LENGTH 28      // Menü satırı önbelleğindeki en fazla karakter (sonlandırıcı dahil)
+
+// Değer ayarlama hızlandırması (basılı tutarken otomatik tekrar sayısına göre)
+#define ADJUST_ACCEL_X5_REPEATS 6    // Bu kadar tekrardan sonra adım 5 katı
+#define ADJUST_ACCEL_X10_REPEATS 14  // Bu kadar tekrardan sonra adım 10 katı
 
 // Menü Zaman Aşımı Ayarları
 #define MENU_TIMEOUT 30000       // 30 saniye menü zaman aşımı
@@ -172,7 +268,36 @@
 
 // Web Sunucu Ayarları
 #define WEB_REQUEST_TIMEOUT 5000         // 5 saniye istek zaman aşımı
+#define WEB_HEADER_TIMEOUT 3000          // İstek başlığı en geç 3 saniyede tamamlanmalı (bayt bayt gönderen istemci)
+#define WEB_HEADER_EVICT_AGE 250         // Slotlar doluyken başlığı bu süreden uzun süren bağlantı yeni istemciye yer açar (ms)
 #define WEB_MAX_CLIENTS 4                // Maksimum eş zamanlı istemci sayısı
+#define WEB_MAX_ROUTES 48                // Rota tablosu kapasitesi
+#define WEB_HEADER_BUFFER_SIZE 1024      // Bağlantı başına istek başlığı buffer'ı
+#define WEB_MAX_COLLECTED_HEADERS 4      // Handler'lara sunulan en fazla başlık
+#define WEB_MAX_BODY_SIZE 4096           // Bellekte tutulan en büyük istek gövdesi
+#define WEB_READ_BUDGET 4096             // Döngü başına bağlantı başına okunan en fazla bayt
+#define WEB_BATCH_MAX_PARAMS 24          // /api/settings/batch başına en fazla parametre
+#define WEB_ASSET_CACHE_CONTROL "public, max-age=604800" // Web arayüzü önbellek süresi (7 gün)
+#define WEB_RATE_LIMIT_CLIENTS 8         // Hız sınırı için izlenen istemci (IP) sayısı
+#define WEB_RATE_LIGHT_BURST 30          // Hafif istek kovası kapasitesi
+#define WEB_RATE_LIGHT_REFILL_MS 100     // Hafif istek jetonu dolum süresi (10/sn)
+#define WEB_RATE_NORMAL_BURST 10         // Ayar isteği kovası kapasitesi
+#define WEB_RATE_NORMAL_REFILL_MS 500    // Ayar isteği jetonu dolum süresi (2/sn)
+#define WEB_RATE_HEAVY_BURST 3           // Ağır istek kovası kapasitesi
+#define WEB_RATE_HEAVY_REFILL_MS 10000   // Ağır istek jetonu dolum süresi (6/dk)
+#define WEB_HEALTH_ROUTE_LIMIT 12        // /api/system/health'te raporlanan en pahalı rota sayısı
+#define STATE_HASH_MEASUREMENT_SCALE 10.0f // Durum sürümünde ölçüm çözünürlüğü (0.1, arayüzde gösterilen)
+#define STATE_HASH_SETTING_SCALE 100.0f  // Durum sürümünde ayar çözünürlüğü (0.01, ikili çerçeve)
+#define STATE_HASH_GAIN_SCALE 1000.0f    // Durum sürümünde PID kazanç çözünürlüğü (0.001, JSON)
+
+// OTA Ayarları (boru hattı: ağ -> halka tampon -> yazıcı görev -> flash)
+#define OTA_BLOCK_SIZE 4096              // Flash'a tek seferde yazılan blok (sektör boyu)
+#define OTA_RING_BUFFER_SIZE 32768       // Alım halka tamponu (OTA_BLOCK_SIZE katı)
+#define OTA_WRITER_STACK_SIZE 4096       // Yazıcı görev yığını
+#define OTA_WRITER_PRIORITY 2            // Yazıcı görev önceliği (loop: 1)
+#define OTA_WRITER_CORE 0                // Yazıcı görev çekirdeği (loop çekirdek 1'de)
+#define OTA_RING_WAIT_MS 2000            // Tampon dolu kaldığında en uzun bekleme
+#define OTA_FINISH_TIMEOUT 10000         // Son blokların yazılması için en uzun bekleme
 
 // JSON Buffer Boyutları
 #define JSON_BUFFER_SIZE_SMALL 256       // Küçük JSON buffer
@@ -189,6 +314,27 @@
 #define HYSTERESIS_LOW_THRESHOLD 5.0     // Varsayılan düşük eşik (%5)
 #define HYSTERESIS_HIGH_THRESHOLD 2.0    // Varsayılan yüksek eşik (%2)
 
+// Nem Kontrol Modları
+#define HUMID_CONTROL_HYSTERESIS 0       // Yüzde bantlı histerezis (yedek mod)
+#define HUMID_CONTROL_PREDICTIVE 1       // Model tabanlı öngörülü kontrol
+#define HUMID_CONTROL_MODE_DEFAULT HUMID_CONTROL_HYSTERESIS  // Öngörülü mod ancak tanımlanmış modelle devreye girer
+
+// Öngörülü Nem Kontrolü (Birinci derece + ölü zaman modeli)
+#define HUMID_MODEL_GAIN 25.0            // Nemlendirici sürekli açıkken kalıcı nem artışı (%RH)
+#define HUMID_MODEL_TAU 300000           // Model zaman sabiti (ms)
+#define HUMID_MODEL_DELAY 30000          // Buharlaşma ölü zamanı (ms)
+#define HUMID_MPC_STEP 10000             // Tahmin adımı ve açık kalma çözünürlüğü (ms)
+#define HUMID_MPC_HORIZON 300000         // Tahmin ufku (ms)
+#define HUMID_MPC_MAX_DELAY_STEPS 30     // Saklanan giriş geçmişi (adım)
+#define HUMID_MPC_ENERGY_WEIGHT 0.05     // Açık kalınan her adım için maliyet
+#define HUMID_MPC_BASE_GAIN 0.01         // Nemlendirici kapalı denge nemi tahmin kazancı
+#define HUMID_MIN_ON_TIME 10000          // Nemlendirici minimum açık kalma süresi (ms)
+#define HUMID_MIN_OFF_TIME 30000         // Nemlendirici minimum kapalı kalma süresi (ms)
+
+// Kontrol Döngüsü Gecikme Ölçümü
+#define PERF_HISTOGRAM_BUCKETS 104       // Logaritmik kova sayısı (oktav başına 4 kova, ~67 sn'ye kadar)
+#define PERF_HEATER_LATENCY_BUDGET_US 100000  // Örnekten ısıtıcı rölesine izin verilen gecikme (µs)
+
 // Sistem Durum LED'i (varsa)
 #define STATUS_LED_PIN -1                // Durum LED pini (-1 = kullanılmıyor)
 
@@ -7,11 +7,24 @@
 #include "display.h"
 #include "menu.h"  // MenuManager için gerekli include
 
-Display::Display() : _tft(TFT_CS, TFT_DC, TFT_MOSI, TFT_SCLK, TFT_RST) {
+Display::Display() : _tft(&SPI, TFT_CS, TFT_DC, TFT_RST) {
     // Yapılandırıcı
+    _gfx = &_tft;
     _currentMode = DISPLAY_NONE;
+    _layoutMainScreen();
+    _adjustValueLabel.configure(0, SCREEN_HEIGHT / 2 - 16, SCREEN_WIDTH, 2, WIDGET_ALIGN_CENTER, COLOR_HIGHLIGHT);
+    _adjustScreenDrawn = false;
+    _trendDrawnData = nullptr;
+    _trendDrawnVersion = 0;
     _menuChanged = false;
     _lastSelectedItem = -1;
+    _menuVisibleRows = 0;
+    _menuItemHeight = 0;
+    _menuDrawnOffset = 0;
+    _menuArrows = 0;
+    for (int i = 0; i < MENU_VISIBLE_ITEMS; i++) {
+        _menuRows[i].valid = false;
+    }
 }
 
 bool Display::begin() {
@@ -23,37 +36,97 @@ bool Display::begin() {
     pinMode(TFT_LED, OUTPUT);
     digitalWrite(TFT_LED, HIGH);
     
-    // Ekranı başlat
+    // Ekranı başlat (donanım SPI)
     _tft.initR(INITR_BLACKTAB);
+    _tft.setSPISpeed(TFT_SPI_FREQUENCY);
     _tft.setRotation(1); // Rotasyon 3'ten 1'e değiştirildi
     _tft.fillScreen(COLOR_BACKGROUND);
     
+    // YENİ: Ekran tamponu + DMA. Panel başlatıldıktan sonra SPI hattı
+    // Arduino SPI'dan alınıp DMA sürücüsüne devredilir; BLACKTAB panelde
+    // adres ofseti olmadığı için pencere koordinatları doğrudan kullanılır.
+    if (_frame.begin()) {
+        SPI.end();
+        if (_frame.attachSpi(TFT_SCLK, TFT_MOSI, TFT_CS, TFT_DC, TFT_SPI_FREQUENCY)) {
+            _gfx = &_frame;
+            _frame.fillScreen(COLOR_BACKGROUND);
+            Serial.println("Ekran: tampon + DMA gönderimi etkin");
+        } else {
+            // DMA hattı kurulamadı: doğrudan çizime geri dön
+            SPI.begin(TFT_SCLK, -1, TFT_MOSI, TFT_CS);
+            Serial.println("Ekran: DMA kurulamadı, doğrudan çizim kullanılıyor");
+        }
+    }
+    
     return true;
 }
 
+void Display::service() {
+    if (_gfx == &_frame) {
+        _frame.service();
+    }
+}
+
+bool Display::isBuffered() const {
+    return _gfx == &_frame;
+}
+
+uint32_t Display::getFlushCount() const {
+    return _frame.getFlushCount();
+}
+
+uint32_t Display::getFlushedPixels() const {
+    return _frame.getFlushedPixels();
+}
+
+void Display::blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels) {
+    if (_gfx == &_frame) {
+        _frame.writeRect(x, y, w, h, pixels);
+    } else {
+        // Tek adres penceresi + ardışık piksel yazımı
+        _tft.drawRGBBitmap(x, y, const_cast<uint16_t*>(pixels), w, h);
+    }
+}
+
+void Display::_present() {
+    // Değişen bölgeler arka planda gönderilir; çağıran beklemez
+    if (_gfx == &_frame) {
+        _frame.flush();
+    }
+}
+
+void Display::_presentNow() {
+    // Ardından gecikme gelen ekranlar için: içerik panele ulaşana kadar bekle
+    if (_gfx == &_frame) {
+        _frame.flushBlocking();
+    }
+}
+
 void Display::showSplashScreen() {
     _currentMode = DISPLAY_SPLASH;
-    _tft.fillScreen(COLOR_BACKGROUND);
+    _gfx->fillScreen(COLOR_BACKGROUND);
     
     // Watchdog besleme
     esp_task_wdt_reset();
     
     // Üstteki "KULUÇKA" yazısı
-    _tft.setTextSize(2);
-    _tft.setTextColor(COLOR_TEXT);
+    _gfx->setTextSize(2);
+    _gfx->setTextColor(COLOR_TEXT);
     
     int16_t x1, y1;
     uint16_t w, h;
     
     // "KULUÇKA" yazısının boyutlarını ölç
-    _tft.getTextBounds("KULUCKA", 0, 0, &x1, &y1, &w, &h);
-    _tft.setCursor((SCREEN_WIDTH - w) / 2, SCREEN_HEIGHT / 2 - h - 5);
-    _tft.print("KULUCKA");
+    _gfx->getTextBounds("KULUCKA", 0, 0, &x1, &y1, &w, &h);
+    _gfx->setCursor((SCREEN_WIDTH - w) / 2, SCREEN_HEIGHT / 2 - h - 5);
+    _gfx->print("KULUCKA");
     
     // Alttaki "MK v5.0" yazısı
-    _tft.getTextBounds("MK v5.0", 0, 0, &x1, &y1, &w, &h);
-    _tft.setCursor((SCREEN_WIDTH - w) / 2, SCREEN_HEIGHT / 2 + 5);
-    _tft.print("MK v5.0");
+    _gfx->getTextBounds("MK v5.0", 0, 0, &x1, &y1, &w, &h);
+    _gfx->setCursor((SCREEN_WIDTH - w) / 2, SCREEN_HEIGHT / 2 + 5);
+    _gfx->print("MK v5.0");
+    
+    _presentNow();
     
     // Watchdog besleme
     esp_task_wdt_reset();
@@ -66,210 +139,29 @@ void Display::showSplashScreen() {
 
 void Display::setupMainScreen() {
     _currentMode = DISPLAY_MAIN;
-    _tft.fillScreen(COLOR_BACKGROUND);
-    _drawDividers();
+    _drawMainBackground();
+    _needsFullRedraw = false;
+    
+    // Son bilinen değerler hemen çizilir, sonraki güncelleme yalnızca farkları çizer
+    _mainScreen.render(*_gfx);
     
-    // Bölüm başlıklarını göster
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    
-    // Sıcaklık bölmesi başlığı
-    _tft.setCursor(16, 20);
-    _tft.print("SICAKLIK");
-    
-    // Nem bölmesi başlığı
-    _tft.setCursor(103, 20);
-    _tft.print("NEM");
-    
-    // Motor bölmesi başlığı
-    _tft.setCursor(19, 74);
-    _tft.print("MOTOR");
-    
-    // Kuluçka bölmesi başlığı
-    _tft.setCursor(95, 74);
-    _tft.print("KULUCKA");
-    
-    // Son değerleri sıfırla (zorunlu güncelleme)
-    _lastTemp = -999;
-    _lastTargetTemp = -999;
-    _lastHumid = -999;
-    _lastTargetHumid = -999;
-    _lastMotorMin = -1;
-    _lastMotorSec = -1;
-    _lastDay = -1;
-    _lastTotalDays = -1;
-    _lastHeatingActive = false;
-    _lastHumidActive = false;
-    _lastMotorActive = false;
-    _lastTimeStr = "";
-    _lastDateStr = "";
-    _lastType = "";
+    _present();
 }
 
 void Display::clear() {
-    _tft.fillScreen(COLOR_BACKGROUND);
+    _gfx->fillScreen(COLOR_BACKGROUND);
+    _adjustScreenDrawn = false;
 }
 
 void Display::_drawDividers() {
     // Üst bilgi satırı bölücüsü
-    _tft.drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
+    _gfx->drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
     
     // Dikey orta çizgi
-    _tft.drawFastVLine(SCREEN_WIDTH / 2, 15, SCREEN_HEIGHT - 15, COLOR_DIVISION);
+    _gfx->drawFastVLine(SCREEN_WIDTH / 2, 15, SCREEN_HEIGHT - 15, COLOR_DIVISION);
     
     // Yatay orta çizgi
-    _tft.drawFastHLine(0, (SCREEN_HEIGHT - 15) / 2 + 15, SCREEN_WIDTH, COLOR_DIVISION);
-}
-
-void Display::_updateInfoBar(String timeStr, String dateStr) {
-    // Sadece saat veya tarih değiştiyse güncelle
-    if (timeStr != _lastTimeStr || dateStr != _lastDateStr) {
-        // Saat, MK v5.0 metni, tarih bilgilerini güncelle
-        _tft.fillRect(0, 0, SCREEN_WIDTH, 15, COLOR_BACKGROUND);
-        
-        _tft.setTextSize(1);
-        _tft.setTextColor(COLOR_TEXT);
-        
-        // Saat
-        _tft.setCursor(2, 5);
-        _tft.print(timeStr);
-        
-        // Tarih - ekranın üst kısmında sağ tarafa hizalama
-        int16_t x1, y1;
-        uint16_t w, h;
-        _tft.getTextBounds(dateStr, 0, 0, &x1, &y1, &w, &h);
-        _tft.setCursor(SCREEN_WIDTH - w - 3, 5);
-        _tft.print(dateStr);
-        
-        // MK v5.0 - saat ve tarih arasında ortala
-        uint16_t timeWidth, dateWidth;
-        _tft.getTextBounds(timeStr, 0, 0, &x1, &y1, &timeWidth, &h);
-        _tft.getTextBounds(dateStr, 0, 0, &x1, &y1, &dateWidth, &h);
-        
-        _tft.getTextBounds("MK v5.0", 0, 0, &x1, &y1, &w, &h);
-        int centerX = (SCREEN_WIDTH - (dateWidth + timeWidth + 6)) / 2 + timeWidth + 3;
-        _tft.setCursor(centerX - w/2, 5);
-        _tft.print("MK v5.0");
-        
-        // Son değerleri güncelle
-        _lastTimeStr = timeStr;
-        _lastDateStr = dateStr;
-    }
-}
-
-void Display::_updateTempSection(float currentTemp, float targetTemp, bool heatingActive) {
-    // Sıcaklık değeri değiştiyse güncelle
-    bool shouldUpdate = abs(currentTemp - _lastTemp) >= 0.1 || 
-                         targetTemp != _lastTargetTemp || 
-                         heatingActive != _lastHeatingActive;
-    
-    if (shouldUpdate) {
-        // Sıcaklık bölmesini temizle
-        _tft.fillRect(1, 16, SCREEN_WIDTH / 2 - 1, (SCREEN_HEIGHT - 15) / 2 - 1, COLOR_BACKGROUND);
-        
-        _tft.setTextSize(1);
-        
-        // SICAKLIK başlığı - DÜZELTME: Yanıp sönme yerine sabit renk
-        if (heatingActive) {
-            _tft.setTextColor(COLOR_TEMP); // Kırmızı
-        } else {
-            _tft.setTextColor(COLOR_TEXT); // Beyaz
-        }
-        
-        _tft.setCursor(16, 20);
-        _tft.print("SICAKLIK");
-        
-        // Hedef sıcaklık - aşağı kaydırıldı, alt çizgiye yakın ama değmiyor
-        _tft.setTextColor(COLOR_TARGET);
-        _tft.setCursor(5, 60);  // Y pozisyonu
-        _tft.print("Hedef:");
-        _tft.print(targetTemp, 1);
-        _tft.print("C");
-        _tft.write(247); // Derece sembolü
-        
-        // Mevcut sıcaklık
-        _tft.setTextSize(2);
-        _tft.setTextColor(COLOR_TEMP);
-        
-        char tempStr[7];
-        sprintf(tempStr, "%4.1f", currentTemp);
-        
-        // Mevcut sıcaklığın boyutlarını ölç ve tamamen ortala
-        int16_t x1, y1;
-        uint16_t w, h;
-        String fullStr = String(tempStr) + "C" + char(247);
-        _tft.getTextBounds(fullStr, 0, 0, &x1, &y1, &w, &h);
-        
-        // Yatay ve dikey olarak ortala, orta çizgiden biraz uzakta
-        _tft.setCursor((SCREEN_WIDTH / 2 - w) / 2 - 2, 37);
-        _tft.print(tempStr);
-        
-        // Derece sembolü
-        _tft.setCursor(_tft.getCursorX(), 37);
-        _tft.print("C");
-        _tft.write(247); // Derece sembolü
-        
-        // Son değerleri güncelle
-        _lastTemp = currentTemp;
-        _lastTargetTemp = targetTemp;
-        _lastHeatingActive = heatingActive;
-    }
-}
-
-void Display::_updateHumidSection(float currentHumid, float targetHumid, bool humidActive) {
-    // Nem değeri değiştiyse güncelle
-    bool shouldUpdate = abs(currentHumid - _lastHumid) >= 0.5 || 
-                         targetHumid != _lastTargetHumid || 
-                         humidActive != _lastHumidActive;
-    
-    if (shouldUpdate) {
-        // Nem bölmesini temizle
-        _tft.fillRect(SCREEN_WIDTH / 2 + 1, 16, SCREEN_WIDTH / 2 - 1, (SCREEN_HEIGHT - 15) / 2 - 1, COLOR_BACKGROUND);
-        
-        _tft.setTextSize(1);
-        
-        // NEM başlığı - DÜZELTME: Yanıp sönme yerine sabit renk
-        if (humidActive) {
-            _tft.setTextColor(COLOR_HUMID); // Mavi
-        } else {
-            _tft.setTextColor(COLOR_TEXT); // Beyaz
-        }
-        
-        _tft.setCursor(103, 20);
-        _tft.print("NEM");
-        
-        // Hedef nem - aşağı kaydırıldı, alt çizgiye yakın ama değmiyor
-        _tft.setTextColor(COLOR_TARGET);
-        _tft.setCursor(85, 60);  // Y pozisyonu
-        _tft.print("Hedef:%");
-        _tft.print(targetHumid, 0);
-        
-        // Mevcut nem
-        _tft.setTextSize(2);
-        _tft.setTextColor(COLOR_HUMID);
-        
-        char humidStr[6];
-        sprintf(humidStr, "%3.0f", currentHumid);
-        
-        // Mevcut nemin boyutlarını ölç ve sıcaklık göstergesiyle aynı hizaya getir
-        int16_t x1, y1;
-        uint16_t w, h;
-        String fullStr = String(humidStr) + "%";
-        _tft.getTextBounds(fullStr, 0, 0, &x1, &y1, &w, &h);
-        
-        // Sıcaklıkla aynı yükseklikte ve kendi bölgesinde ortala
-        _tft.setCursor(SCREEN_WIDTH / 2 + (SCREEN_WIDTH / 2 - w) / 2, 37);
-        _tft.print(humidStr);
-        
-        // Yüzde sembolü
-        _tft.setCursor(_tft.getCursorX(), 37);
-        _tft.print("%");
-        
-        // Son değerleri güncelle
-        _lastHumid = currentHumid;
-        _lastTargetHumid = targetHumid;
-        _lastHumidActive = humidActive;
-    }
+    _gfx->drawFastHLine(0, (SCREEN_HEIGHT - 15) / 2 + 15, SCREEN_WIDTH, COLOR_DIVISION);
 }
 
 // Özel saat ayarlama ekranı gösterimi için showValueAdjustScreen'i genişlet
@@ -280,14 +172,14 @@ void Display::showTimeAdjustScreen(String title, String timeString, int selected
     clear();
     
     // Başlık
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, 5);
-    _tft.print(title);
-    _tft.drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, 5);
+    _gfx->print(title);
+    _gfx->drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
     
     // Saat gösterimi - büyük ve merkeze
-    _tft.setTextSize(3);
+    _gfx->setTextSize(3);
     
     // Saat ve dakikayı ayrı ayrı göster, seçili alanı vurgula
     String hourStr = timeString.substring(0, 2);
@@ -298,35 +190,36 @@ void Display::showTimeAdjustScreen(String title, String timeString, int selected
     
     // Saat kısmı
     if (selectedField == 0) {
-        _tft.setTextColor(COLOR_HIGHLIGHT); // Seçili alan vurgulanır
+        _gfx->setTextColor(COLOR_HIGHLIGHT); // Seçili alan vurgulanır
     } else {
-        _tft.setTextColor(COLOR_TEXT);
+        _gfx->setTextColor(COLOR_TEXT);
     }
-    _tft.setCursor(30, SCREEN_HEIGHT / 2 - 10);
-    _tft.print(hourStr);
+    _gfx->setCursor(30, SCREEN_HEIGHT / 2 - 10);
+    _gfx->print(hourStr);
     
     // İki nokta
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(66, SCREEN_HEIGHT / 2 - 10);
-    _tft.print(":");
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(66, SCREEN_HEIGHT / 2 - 10);
+    _gfx->print(":");
     
     // Dakika kısmı
     if (selectedField == 1) {
-        _tft.setTextColor(COLOR_HIGHLIGHT); // Seçili alan vurgulanır
+        _gfx->setTextColor(COLOR_HIGHLIGHT); // Seçili alan vurgulanır
     } else {
-        _tft.setTextColor(COLOR_TEXT);
+        _gfx->setTextColor(COLOR_TEXT);
     }
-    _tft.setCursor(84, SCREEN_HEIGHT / 2 - 10);
-    _tft.print(minuteStr);
+    _gfx->setCursor(84, SCREEN_HEIGHT / 2 - 10);
+    _gfx->print(minuteStr);
     
     // Yönergeler
-    _tft.fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, SCREEN_HEIGHT - 13);
-    _tft.print("^v:Deger <>:Alan *:Kaydet");
+    _gfx->fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, SCREEN_HEIGHT - 13);
+    _gfx->print("^v:Deger <>:Alan *:Kaydet");
     
     _needsFullRedraw = false;
+    _present();
 }
 
 void Display::showDateAdjustScreen(String title, String dateString, int selectedField) {
@@ -336,14 +229,14 @@ void Display::showDateAdjustScreen(String title, String dateString, int selected
     clear();
     
     // Başlık
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, 5);
-    _tft.print(title);
-    _tft.drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, 5);
+    _gfx->print(title);
+    _gfx->drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
     
     // Tarih gösterimi - büyük ve merkeze
-    _tft.setTextSize(2);
+    _gfx->setTextSize(2);
     
     // Gün, ay, yılı ayrı ayrı göster, seçili alanı vurgula
     String dayStr = dateString.substring(0, 2);
@@ -352,166 +245,112 @@ void Display::showDateAdjustScreen(String title, String dateString, int selected
     
     // Gün kısmı
     if (selectedField == 0) {
-        _tft.setTextColor(COLOR_HIGHLIGHT);
+        _gfx->setTextColor(COLOR_HIGHLIGHT);
     } else {
-        _tft.setTextColor(COLOR_TEXT);
+        _gfx->setTextColor(COLOR_TEXT);
     }
-    _tft.setCursor(10, SCREEN_HEIGHT / 2 - 10);
-    _tft.print(dayStr);
+    _gfx->setCursor(10, SCREEN_HEIGHT / 2 - 10);
+    _gfx->print(dayStr);
     
     // Nokta
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(34, SCREEN_HEIGHT / 2 - 10);
-    _tft.print(".");
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(34, SCREEN_HEIGHT / 2 - 10);
+    _gfx->print(".");
     
     // Ay kısmı
     if (selectedField == 1) {
-        _tft.setTextColor(COLOR_HIGHLIGHT);
+        _gfx->setTextColor(COLOR_HIGHLIGHT);
     } else {
-        _tft.setTextColor(COLOR_TEXT);
+        _gfx->setTextColor(COLOR_TEXT);
     }
-    _tft.setCursor(42, SCREEN_HEIGHT / 2 - 10);
-    _tft.print(monthStr);
+    _gfx->setCursor(42, SCREEN_HEIGHT / 2 - 10);
+    _gfx->print(monthStr);
     
     // Nokta
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(66, SCREEN_HEIGHT / 2 - 10);
-    _tft.print(".");
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(66, SCREEN_HEIGHT / 2 - 10);
+    _gfx->print(".");
     
     // Yıl kısmı
     if (selectedField == 2) {
-        _tft.setTextColor(COLOR_HIGHLIGHT);
+        _gfx->setTextColor(COLOR_HIGHLIGHT);
     } else {
-        _tft.setTextColor(COLOR_TEXT);
+        _gfx->setTextColor(COLOR_TEXT);
     }
-    _tft.setCursor(74, SCREEN_HEIGHT / 2 - 10);
-    _tft.print(yearStr);
+    _gfx->setCursor(74, SCREEN_HEIGHT / 2 - 10);
+    _gfx->print(yearStr);
     
     // Yönergeler
-    _tft.fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, SCREEN_HEIGHT - 13);
-    _tft.print("^v:Deger <>:Alan *:Kaydet");
+    _gfx->fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, SCREEN_HEIGHT - 13);
+    _gfx->print("^v:Deger <>:Alan *:Kaydet");
     
     _needsFullRedraw = false;
+    _present();
 }
 
-void Display::_updateMotorSection(int minutesLeft, int secondsLeft, bool motorActive) {
-    // Motor durumu veya zamanlaması değiştiyse güncelle
-    static unsigned long lastBlinkMillis = 0;
-    bool shouldUpdate = (minutesLeft != _lastMotorMin) || 
-                        (secondsLeft != _lastMotorSec) || 
-                        (motorActive != _lastMotorActive);
-    
-    // Yanıp sönme için düzenli güncelleme
-    if (motorActive) {
-        unsigned long currentMillis = millis();
-        if (currentMillis - lastBlinkMillis >= 500) {
-            shouldUpdate = true;
-            lastBlinkMillis = currentMillis;
-        }
-    }
-    
-    if (shouldUpdate) {
-        // Motor bölmesini temizle
-        _tft.fillRect(1, (SCREEN_HEIGHT - 15) / 2 + 16, SCREEN_WIDTH / 2 - 1, (SCREEN_HEIGHT - 15) / 2 - 1, COLOR_BACKGROUND);
-        
-        _tft.setTextSize(1);
-        
-        // MOTOR başlığı (yanıp sönme efekti için)
-        if (motorActive) {
-            if ((millis() / 500) % 2 == 0) {
-                _tft.setTextColor(COLOR_HIGHLIGHT);
-            } else {
-                _tft.setTextColor(COLOR_BACKGROUND);
-            }
-        } else {
-            _tft.setTextColor(COLOR_TEXT);
-        }
-        
-        _tft.setCursor(19, 74);
-        _tft.print("MOTOR");
-        
-        _tft.setTextColor(COLOR_TEXT);
-        
-        // Dakika ve saniye gösterimi
-        _tft.setTextSize(1);
-        
-        // Dakika gösterimi - büyük rakamlar
-        _tft.setCursor(5, 90);
-        _tft.print("Dk:");
-        
-        _tft.setTextSize(2);
-        _tft.setCursor(25, 88);
-        _tft.print(minutesLeft);
-        
-        // Saniye gösterimi
-        _tft.setTextSize(1);
-        _tft.setCursor(5, 110);
-        _tft.print("Sn:");
-        
-        _tft.setTextSize(2);
-        _tft.setCursor(25, 108);
-        
-        // Saniye değerini göster - motor aktif veya pasif olsun her durumda
-        _tft.print(secondsLeft);
-        
-        // Son değerleri güncelle
-        _lastMotorMin = minutesLeft;
-        _lastMotorSec = secondsLeft;
-        _lastMotorActive = motorActive;
+void Display::_layoutMainScreen() {
+    const int16_t half = SCREEN_WIDTH / 2;
+    const int16_t top = 16;                              // Bilgi satırı altı
+    const int16_t bottom = (SCREEN_HEIGHT - 15) / 2 + 16; // Yatay orta çizgi altı
+    
+    // Bilgi satırı: saat solda, tarih sağda, sürüm ortada
+    _timeLabel.configure(2, 5, 32, 1, WIDGET_ALIGN_LEFT, COLOR_TEXT);
+    _logoLabel.configure(35, 5, 60, 1, WIDGET_ALIGN_CENTER, COLOR_TEXT);
+    _logoLabel.setText("MK v5.0");
+    _dateLabel.configure(SCREEN_WIDTH - 63, 5, 60, 1, WIDGET_ALIGN_RIGHT, COLOR_TEXT);
+    
+    // Sıcaklık bölmesi (başlık ısıtıcı çalışırken kırmızı)
+    _tempTitle.configure(16, top + 4, 48, 1, WIDGET_ALIGN_LEFT, COLOR_TEXT);
+    _tempTitle.setText("SICAKLIK");
+    _tempValue.configure(this, 0, 37, half - 4, WIDGET_ALIGN_CENTER, COLOR_TEMP);
+    _tempTarget.configure(5, 60, half - 6, 1, WIDGET_ALIGN_LEFT, COLOR_TARGET);
+    
+    // Nem bölmesi (başlık nemlendirici çalışırken mavi)
+    _humidTitle.configure(103, top + 4, 18, 1, WIDGET_ALIGN_LEFT, COLOR_TEXT);
+    _humidTitle.setText("NEM");
+    _humidValue.configure(this, half + 1, 37, half - 2, WIDGET_ALIGN_CENTER, COLOR_HUMID);
+    _humidTarget.configure(85, 60, half - 8, 1, WIDGET_ALIGN_LEFT, COLOR_TARGET);
+    
+    // Motor bölmesi (başlık motor dönerken yanıp söner)
+    _motorTitle.configure(19, bottom + 2, 30, 1, WIDGET_ALIGN_LEFT, COLOR_TEXT);
+    _motorTitle.setText("MOTOR");
+    _motorMinLabel.configure(5, 90, 18, 1, WIDGET_ALIGN_LEFT, COLOR_TEXT);
+    _motorMinLabel.setText("Dk:");
+    _motorMinValue.configure(this, 25, 88, half - 26, WIDGET_ALIGN_LEFT, COLOR_TEXT);
+    _motorSecLabel.configure(5, 110, 18, 1, WIDGET_ALIGN_LEFT, COLOR_TEXT);
+    _motorSecLabel.setText("Sn:");
+    _motorSecValue.configure(this, 25, 108, half - 26, WIDGET_ALIGN_LEFT, COLOR_TEXT);
+    
+    // Kuluçka bölmesi
+    _incubationTitle.configure(95, bottom + 2, 42, 1, WIDGET_ALIGN_LEFT, COLOR_TEXT);
+    _incubationTitle.setText("KULUCKA");
+    _dayValue.configure(this, half + 1, 90, half - 2, WIDGET_ALIGN_CENTER, COLOR_HIGHLIGHT);
+    _typeLabel.configure(85, 115, half - 8, 1, WIDGET_ALIGN_LEFT, COLOR_TARGET);
+    
+    Widget* widgets[] = {
+        &_timeLabel, &_logoLabel, &_dateLabel,
+        &_tempTitle, &_tempValue, &_tempTarget,
+        &_humidTitle, &_humidValue, &_humidTarget,
+        &_motorTitle, &_motorMinLabel, &_motorMinValue, &_motorSecLabel, &_motorSecValue,
+        &_incubationTitle, &_dayValue, &_typeLabel
+    };
+    for (size_t i = 0; i < sizeof(widgets) / sizeof(widgets[0]); i++) {
+        _mainScreen.add(widgets[i]);
     }
 }
 
-void Display::_updateIncubationSection(int currentDay, int totalDays, const char* incubationType) {
-    // Kuluçka bilgisi değiştiyse güncelle - String yerine strcmp kullan
-    static char lastTypeBuffer[20] = "";
-    
-    if (currentDay != _lastDay || totalDays != _lastTotalDays || strcmp(incubationType, lastTypeBuffer) != 0) {
-        // Kuluçka bölmesini temizle
-        _tft.fillRect(SCREEN_WIDTH / 2 + 1, (SCREEN_HEIGHT - 15) / 2 + 16, SCREEN_WIDTH / 2 - 1, (SCREEN_HEIGHT - 15) / 2 - 1, COLOR_BACKGROUND);
-        
-        _tft.setTextSize(1);
-        _tft.setTextColor(COLOR_TEXT);
-        
-        // KULUCKA başlığı
-        _tft.setCursor(95, 74);
-        _tft.print("KULUCKA");
-        
-        // Kuluçka tipi - konumu aşağı kaydırıldı ve rengi sarı yapıldı
-        _tft.setTextColor(COLOR_TARGET);  // Sarı renk
-        _tft.setCursor(85, 115);  // Y pozisyonu 105'ten 115'e kaydırıldı
-        _tft.print(incubationType);
-        
-        // Gün bilgisi (1/21 formatında)
-        char dayStr[10];
-        sprintf(dayStr, "%d/%d", currentDay, totalDays);
-        
-        _tft.setTextSize(2);
-        _tft.setTextColor(COLOR_HIGHLIGHT);
-        
-        // Gün bilgisinin boyutlarını ölç
-        int16_t x1, y1;
-        uint16_t w, h;
-        _tft.getTextBounds(dayStr, 0, 0, &x1, &y1, &w, &h);
-        _tft.setCursor(SCREEN_WIDTH / 2 + (SCREEN_WIDTH / 2 - w) / 2, 90);
-        _tft.print(dayStr);
-        
-        // Son değerleri güncelle
-        _lastDay = currentDay;
-        _lastTotalDays = totalDays;
-        strncpy(lastTypeBuffer, incubationType, sizeof(lastTypeBuffer) - 1);
-        lastTypeBuffer[sizeof(lastTypeBuffer) - 1] = '\0';
-    }
+void Display::_drawMainBackground() {
+    // Tek tam ekran temizliği: bölücüler çizilir, tüm öğeler yeniden çizilecek
+    _gfx->fillScreen(COLOR_BACKGROUND);
+    _drawDividers();
+    _mainScreen.invalidateAll();
 }
 
 // Ana ekranı güncelle
-void Display::updateMainScreen(float currentTemp, float targetTemp, float currentHumid, 
-                               float targetHumid, int motorMinutesLeft, int motorSecondsLeft, 
-                               int currentDay, int totalDays, String incubationType,
-                               bool heatingActive, bool humidActive, bool motorActive,
-                               String timeStr, String dateStr) {
+void Display::updateMainScreen(const MainScreenData& data) {
     
     // Ana ekranda değilsek hiçbir şey yapma
     if (_currentMode != DISPLAY_MAIN) {
@@ -521,67 +360,61 @@ void Display::updateMainScreen(float currentTemp, float targetTemp, float curren
     // Watchdog besleme
     esp_task_wdt_reset();
     
-    // String parametrelerini başta char buffer'a çevir - PERFORMANS İYİLEŞTİRMESİ
-    static char typeBuffer[20];
-    static char timeBuffer[10];
-    static char dateBuffer[12];
+    // Ana ekranın üzerine başka bir şey çizildiyse (alarm vb.) zemini yeniden kur
+    if (_needsFullRedraw) {
+        _drawMainBackground();
+        _needsFullRedraw = false;
+    }
     
-    incubationType.toCharArray(typeBuffer, sizeof(typeBuffer));
-    timeStr.toCharArray(timeBuffer, sizeof(timeBuffer));
-    dateStr.toCharArray(dateBuffer, sizeof(dateBuffer));
+    // Değerler biçimlendirilip öğelere verilir; biçimlenmiş metni değişmeyen
+    // öğe kirlenmez ve panele hiçbir şey gönderilmez
+    char text[WIDGET_TEXT_LENGTH];
     
-    // Menüden dönüşte ilk ekran çizimini zorla
-    static unsigned long lastDrawTime = 0;
-    static bool forceDraw = false;
+    _timeLabel.setText(data.timeStr);
+    _dateLabel.setText(data.dateStr);
     
-    if (millis() - lastDrawTime > 2000) { // 2 saniye güncellemeden sonra
-        forceDraw = true;
-    }
-    lastDrawTime = millis();
+    _tempTitle.setColor(data.heatingActive ? COLOR_TEMP : COLOR_TEXT);
+    snprintf(text, sizeof(text), "%4.1fC\xF7", data.currentTemp);
+    _tempValue.setText(text);
+    snprintf(text, sizeof(text), "Hedef:%.1fC\xF7", data.targetTemp);
+    _tempTarget.setText(text);
     
-    // İlk seferde veya ekranın yeniden oluşturulması gerektiğinde tam çizim yap
-    if (_needsFullRedraw || forceDraw) {
-        _tft.fillScreen(COLOR_BACKGROUND);
-        _drawDividers();
-        _needsFullRedraw = false;
-        forceDraw = false;
-        
-        // Son değerleri sıfırla (zorunlu güncelleme)
-        _lastTemp = -999;
-        _lastTargetTemp = -999;
-        _lastHumid = -999;
-        _lastTargetHumid = -999;
-        _lastMotorMin = -1;
-        _lastMotorSec = -1;
-        _lastDay = -1;
-        _lastTotalDays = -1;
-        _lastHeatingActive = !heatingActive; // Zorunlu güncelleme
-        _lastHumidActive = !humidActive;    // Zorunlu güncelleme
-        _lastMotorActive = !motorActive;    // Zorunlu güncelleme
-        _lastTimeStr = "";                 // Zorunlu güncelleme
-        _lastDateStr = "";                 // Zorunlu güncelleme
-        _lastType = "";                    // Zorunlu güncelleme
-    }
-    
-    // Sadece bilgi çubuğunu güncelle (saat her zaman değişir)
-    _updateInfoBar(timeStr, dateStr);
-    
-    // Her bölümü ayrı ayrı güncelle - sadece değişen veya yanıp sönen bölümleri güncelle
-    _updateTempSection(currentTemp, targetTemp, heatingActive);
-    _updateHumidSection(currentHumid, targetHumid, humidActive);
-    _updateMotorSection(motorMinutesLeft, motorSecondsLeft, motorActive);
-    _updateIncubationSection(currentDay, totalDays, typeBuffer); // String yerine char buffer kullan
+    _humidTitle.setColor(data.humidActive ? COLOR_HUMID : COLOR_TEXT);
+    snprintf(text, sizeof(text), "%3.0f%%", data.currentHumid);
+    _humidValue.setText(text);
+    snprintf(text, sizeof(text), "Hedef:%%%.0f", data.targetHumid);
+    _humidTarget.setText(text);
+    
+    // Motor dönerken başlık 500 ms aralıkla yanıp söner
+    if (data.motorActive) {
+        _motorTitle.setColor((millis() / 500) % 2 == 0 ? COLOR_HIGHLIGHT : COLOR_BACKGROUND);
+    } else {
+        _motorTitle.setColor(COLOR_TEXT);
+    }
+    snprintf(text, sizeof(text), "%d", data.motorMinutesLeft);
+    _motorMinValue.setText(text);
+    snprintf(text, sizeof(text), "%d", data.motorSecondsLeft);
+    _motorSecValue.setText(text);
+    
+    snprintf(text, sizeof(text), "%d/%d", data.currentDay, data.totalDays);
+    _dayValue.setText(text);
+    _typeLabel.setText(data.incubationType);
+    
+    // Yalnızca değişen öğeler çizilir ve gönderilir
+    if (_mainScreen.render(*_gfx) > 0) {
+        _present();
+    }
     
     // Watchdog besleme
     esp_task_wdt_reset();
 }
 
-void Display::showMenu(String menuItems[], int itemCount, int selectedItem) {
-    // Ekran modu değişti
-    _currentMode = DISPLAY_MENU;
+void Display::showMenu(const MenuView& menuItems, int selectedItem) {
+    int itemCount = menuItems.size();
     
     // İTEM SAYISI SIFIR ISE HİÇBİR ŞEY YAPMA - KRİTİK DÜZELTME
     if (itemCount <= 0) {
+        _currentMode = DISPLAY_MENU;
         Serial.println("Boş menü tespit edildi, menü gösterilmiyor");
         return;
     }
@@ -590,86 +423,156 @@ void Display::showMenu(String menuItems[], int itemCount, int selectedItem) {
     extern MenuManager menuManager;
     int menuOffset = menuManager.getMenuOffset();
     
-    // Menüyü her zaman yenile - bu satır kritik düzeltme
-    clear();
-    
     // Watchdog besleme - menü gösterimi başlangıcında
     esp_task_wdt_reset();
     
-    // Üst menü başlığı
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, 5);
-    _tft.print("MENU");
-    _tft.drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
-    
     // Menü listesi için uygun alan hesaplama
-    int menuStartY = 16;
-    int menuEndY = SCREEN_HEIGHT - 16;
-    int menuHeight = menuEndY - menuStartY;
-    
-    // Maksimum görünebilir öğe sayısı
-    const int maxVisibleItems = 6;
-    int visibleItemCount = min(itemCount, maxVisibleItems);
-    
-    // Menü öğesi başına düşen yükseklik
-    int itemHeight = menuHeight / visibleItemCount;
-    
-    // Menü öğesi için static buffer - bellek fragmentasyonunu önler
-    static char menuItemBuffer[64];
+    const int menuStartY = 16;
+    const int menuEndY = SCREEN_HEIGHT - 16;
+    int visibleItemCount = min(itemCount, MENU_VISIBLE_ITEMS);
+    int itemHeight = (menuEndY - menuStartY) / visibleItemCount;
+    
+    // Başka ekrandan gelindiyse ya da satır düzeni değiştiyse çerçeve baştan
+    // çizilir; aksi halde yalnızca önbellekten farklı satırlar çizilir
+    bool fullRedraw = _currentMode != DISPLAY_MENU || _menuChanged ||
+                      visibleItemCount != _menuVisibleRows;
+    _currentMode = DISPLAY_MENU;
     
-    // Sadece görünür aralıktaki öğeleri göster
-    for (int i = 0; i < visibleItemCount; i++) {
-        int actualIndex = i + menuOffset;
+    if (fullRedraw) {
+        clear();
         
-        // Dizin sınırlarını kontrol et
-        if (actualIndex >= itemCount) break;
+        // Üst menü başlığı
+        _gfx->setTextSize(1);
+        _gfx->setTextColor(COLOR_TEXT);
+        _gfx->setCursor(5, 5);
+        _gfx->print("MENU");
+        _gfx->drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
         
-        if (actualIndex == selectedItem) {
-            // Seçili menü öğesi için çerçeve çiz
-            _tft.drawRect(0, menuStartY + i * itemHeight, SCREEN_WIDTH, itemHeight, COLOR_HIGHLIGHT);
-            _tft.setTextColor(COLOR_HIGHLIGHT);
-        } else {
-            _tft.setTextColor(COLOR_TEXT);
-        }
+        // Kontrol ipuçları - alt kısımda
+        _gfx->fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
+        _gfx->setCursor(5, SCREEN_HEIGHT - 13);
+        _gfx->setTextColor(COLOR_TEXT);
+        _gfx->print("^v:Sec <:Geri >:Giris");
         
-        // Menü öğesini yazdır - String'i char buffer'a kopyala
-        menuItems[actualIndex].toCharArray(menuItemBuffer, sizeof(menuItemBuffer));
-        _tft.setCursor(5, menuStartY + i * itemHeight + 2);
-        _tft.print(menuItemBuffer);
+        for (int i = 0; i < MENU_VISIBLE_ITEMS; i++) {
+            _menuRows[i].valid = false;
+        }
+        _menuVisibleRows = visibleItemCount;
+        _menuItemHeight = itemHeight;
+        _menuDrawnOffset = menuOffset;
+        _menuArrows = 0;
+    } else if (menuOffset != _menuDrawnOffset) {
+        _scrollMenuRows(menuOffset - _menuDrawnOffset);
+        _menuDrawnOffset = menuOffset;
+    }
+    
+    // Satırlar: öğe adları kopyalanmadan önbellekle karşılaştırılır
+    for (int i = 0; i < visibleItemCount; i++) {
+        int actualIndex = i + menuOffset;
+        const char* text = actualIndex < itemCount ? menuItems[actualIndex].label : "";
+        _drawMenuRow(i, text, actualIndex == selectedItem);
     }
     
-    // Kaydırma göstergesi
-    if (itemCount > maxVisibleItems) {
-        // Yukarı ok (yukarıda daha fazla öğe varsa)
+    // Kaydırma göstergesi (başlık satırının sağında)
+    uint8_t arrows = 0;
+    if (itemCount > MENU_VISIBLE_ITEMS) {
         if (menuOffset > 0) {
-            _tft.setTextColor(COLOR_HIGHLIGHT);
-            _tft.setCursor(SCREEN_WIDTH - 10, menuStartY - 5);
-            _tft.print("^");
+            arrows |= 0x01; // Yukarıda daha fazla öğe var
         }
-        
-        // Aşağı ok (aşağıda daha fazla öğe varsa)
-        if (menuOffset + maxVisibleItems < itemCount) {
-            _tft.setTextColor(COLOR_HIGHLIGHT);
-            _tft.setCursor(SCREEN_WIDTH - 10, menuEndY + 2);
-            _tft.print("v");
+        if (menuOffset + MENU_VISIBLE_ITEMS < itemCount) {
+            arrows |= 0x02; // Aşağıda daha fazla öğe var
         }
     }
-    
-    // Kontrol ipuçları - alt kısımda
-    _tft.fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
-    _tft.setCursor(5, SCREEN_HEIGHT - 13);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.print("^v:Sec <:Geri >:Giris");
+    if (arrows != _menuArrows) {
+        _gfx->fillRect(SCREEN_WIDTH - 22, 0, 22, 15, COLOR_BACKGROUND);
+        _gfx->setTextSize(1);
+        _gfx->setTextColor(COLOR_HIGHLIGHT);
+        if (arrows & 0x01) {
+            _gfx->setCursor(SCREEN_WIDTH - 20, 5);
+            _gfx->print("^");
+        }
+        if (arrows & 0x02) {
+            _gfx->setCursor(SCREEN_WIDTH - 10, 5);
+            _gfx->print("v");
+        }
+        _menuArrows = arrows;
+    }
     
     // Son seçili öğeyi güncelle
     _lastSelectedItem = selectedItem;
     _menuChanged = false;
     
+    _present();
+    
     // Watchdog besleme - menü gösterimi sonunda
     esp_task_wdt_reset();
 }
 
+void Display::_drawMenuRow(int row, const char* text, bool selected) {
+    MenuRowCache& cache = _menuRows[row];
+    
+    // Satırda görünen metin (önbellek kapasitesine kırpılmış) ve seçim aynıysa atla
+    if (cache.valid && cache.selected == selected &&
+        strncmp(cache.text, text, sizeof(cache.text) - 1) == 0 &&
+        (strlen(cache.text) == sizeof(cache.text) - 1 || text[strlen(cache.text)] == '\0')) {
+        return;
+    }
+    
+    strncpy(cache.text, text, sizeof(cache.text) - 1);
+    cache.text[sizeof(cache.text) - 1] = '\0';
+    cache.selected = selected;
+    cache.valid = true;
+    
+    int y = 16 + row * _menuItemHeight;
+    _gfx->fillRect(0, y, SCREEN_WIDTH, _menuItemHeight, COLOR_BACKGROUND);
+    
+    _gfx->setTextSize(1);
+    if (selected) {
+        // Seçili menü öğesi için çerçeve çiz
+        _gfx->drawRect(0, y, SCREEN_WIDTH, _menuItemHeight, COLOR_HIGHLIGHT);
+        _gfx->setTextColor(COLOR_HIGHLIGHT);
+    } else {
+        _gfx->setTextColor(COLOR_TEXT);
+    }
+    
+    _gfx->setCursor(5, y + 2);
+    _gfx->print(cache.text);
+}
+
+void Display::_scrollMenuRows(int delta) {
+    if (abs(delta) >= _menuVisibleRows) {
+        // Tüm görünür satırlar değişti
+        for (int i = 0; i < _menuVisibleRows; i++) {
+            _menuRows[i].valid = false;
+        }
+        return;
+    }
+    
+    // Doğrudan panel yolunda pikseller yerinde kalır; önbellek de olduğu gibi
+    // kalır ve satır karşılaştırması farklı olanları çizer
+    if (_gfx != &_frame) {
+        return;
+    }
+    
+    // Tamponda liste alanını kaydır; önbellek satırları piksellerle birlikte taşınır
+    _frame.scrollRect(0, 16, SCREEN_WIDTH, _menuVisibleRows * _menuItemHeight, -delta * _menuItemHeight);
+    if (delta > 0) {
+        for (int i = 0; i < _menuVisibleRows - delta; i++) {
+            _menuRows[i] = _menuRows[i + delta];
+        }
+        for (int i = _menuVisibleRows - delta; i < _menuVisibleRows; i++) {
+            _menuRows[i].valid = false;
+        }
+    } else {
+        for (int i = _menuVisibleRows - 1; i >= -delta; i--) {
+            _menuRows[i] = _menuRows[i + delta];
+        }
+        for (int i = 0; i < -delta; i++) {
+            _menuRows[i].valid = false;
+        }
+    }
+}
+
 void Display::showSubmenu(String submenuItems[], int itemCount, int selectedItem) {
     // Ekran modu değişti
     _currentMode = DISPLAY_SUBMENU;
@@ -682,11 +585,11 @@ void Display::showSubmenu(String submenuItems[], int itemCount, int selectedItem
     clear();
     
     // Üst alt menü başlığı
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, 5);
-    _tft.print("ALT MENU");
-    _tft.drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, 5);
+    _gfx->print("ALT MENU");
+    _gfx->drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
     
     // Menü listesi için kullanılabilir alan
     // Üst başlık (15px) ve alt navigasyon (15px) alanı dışında kalan alan
@@ -700,78 +603,80 @@ void Display::showSubmenu(String submenuItems[], int itemCount, int selectedItem
     for (int i = 0; i < itemCount; i++) {
         if (i == selectedItem) {
             // Seçili menü öğesi için çerçeve çiz
-            _tft.drawRect(0, menuStartY + i * itemHeight, SCREEN_WIDTH, itemHeight, COLOR_HIGHLIGHT);
-            _tft.setTextColor(COLOR_HIGHLIGHT);
+            _gfx->drawRect(0, menuStartY + i * itemHeight, SCREEN_WIDTH, itemHeight, COLOR_HIGHLIGHT);
+            _gfx->setTextColor(COLOR_HIGHLIGHT);
         } else {
-            _tft.setTextColor(COLOR_TEXT);
+            _gfx->setTextColor(COLOR_TEXT);
         }
         
         // Menü öğesini yazdır
-        _tft.setCursor(5, menuStartY + i * itemHeight + 2);
-        _tft.print(submenuItems[i]);
+        _gfx->setCursor(5, menuStartY + i * itemHeight + 2);
+        _gfx->print(submenuItems[i]);
     }
     
     // Kontrol ipuçları - alt kısımda
-    _tft.fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
-    _tft.setCursor(5, SCREEN_HEIGHT - 13);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.print("^v:Sec <:Geri >:Sec");
+    _gfx->fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
+    _gfx->setCursor(5, SCREEN_HEIGHT - 13);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->print("^v:Sec <:Geri >:Sec");
     
     // Son seçili öğeyi güncelle
     _lastSelectedItem = selectedItem;
     _menuChanged = false;
+    
+    _present();
 }
 
 void Display::showValueAdjustScreen(String title, String value, String unit) {
-    // Ekran modu değişti
-    _currentMode = DISPLAY_VALUE_ADJUST;
-    
-    // Son değeri kaydet - değişiklik kontrolü için
-    static String lastValue = "";
+    String displayText = value + unit;
     
-    // Değer değişmediyse tekrar çizme
-    if (value == lastValue && !_needsFullRedraw) {
+    // Aynı ekranda yalnızca değer değiştiyse sadece değer satırını yenile;
+    // hızlı ayarlamada SPI trafiği tek satırlık dikdörtgenle sınırlı kalır
+    if (_currentMode == DISPLAY_VALUE_ADJUST && _adjustScreenDrawn && 
+        !_needsFullRedraw && title == _adjustDrawnTitle) {
+        _adjustValueLabel.setText(displayText.c_str());
+        if (_adjustValueLabel.render(*_gfx)) {
+            _present();
+        }
         return;
     }
     
+    // Ekran modu değişti
+    _currentMode = DISPLAY_VALUE_ADJUST;
+    
     clear();
     
     // Başlık
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, 5);
-    _tft.print(title);
-    _tft.drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, 5);
+    _gfx->print(title);
+    _gfx->drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
     
     // Değer gösterimi - daha büyük ve merkeze
-    _tft.setTextSize(2);
-    _tft.setTextColor(COLOR_HIGHLIGHT);
-    
-    // Değerin boyutlarını ölç
-    int16_t x1, y1;
-    uint16_t w, h;
-    String displayText = value + unit;
-    _tft.getTextBounds(displayText, 0, 0, &x1, &y1, &w, &h);
-    _tft.setCursor((SCREEN_WIDTH - w) / 2, SCREEN_HEIGHT / 2 - h);
-    _tft.print(displayText);
+    _adjustValueLabel.setText(displayText.c_str());
+    _adjustValueLabel.invalidate();
+    _adjustValueLabel.render(*_gfx);
     
     // Artı/eksi göstergeleri
-    _tft.setTextSize(2);
-    _tft.setCursor(30, SCREEN_HEIGHT / 2 + 10);
-    _tft.print("-");
+    _gfx->setTextSize(2);
+    _gfx->setCursor(30, SCREEN_HEIGHT / 2 + 10);
+    _gfx->print("-");
     
-    _tft.setCursor(SCREEN_WIDTH - 40, SCREEN_HEIGHT / 2 + 10);
-    _tft.print("+");
+    _gfx->setCursor(SCREEN_WIDTH - 40, SCREEN_HEIGHT / 2 + 10);
+    _gfx->print("+");
     
     // Yönergeler
-    _tft.fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, SCREEN_HEIGHT - 13);
-    _tft.print("^v:Deger <:Geri >:Kaydet");
-    
-    lastValue = value;
+    _gfx->fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, SCREEN_HEIGHT - 13);
+    _gfx->print("^v:Deger <:Geri >:Kaydet");
+    
+    _adjustDrawnTitle = title;
+    _adjustScreenDrawn = true;
     _needsFullRedraw = false;
+    _present();
 }
 
 void Display::showValueAdjustScreen(String title, float value, String unit) {
@@ -786,87 +691,179 @@ void Display::showSensorValuesScreen(float temp1, float humid1, float temp2, flo
     clear();
     
     // Başlık
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, 5);
-    _tft.print("SENSOR DEGERLERI");
-    _tft.drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, 5);
+    _gfx->print("SENSOR DEGERLERI");
+    _gfx->drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
     
     // Sensör 1 bilgileri
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, 25);
-    _tft.print("SENSOR 1:");
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, 25);
+    _gfx->print("SENSOR 1:");
     
     if (sensor1Working) {
-        _tft.setTextColor(COLOR_TEMP);
-        _tft.setCursor(5, 40);
-        _tft.print("Sicaklik: ");
-        _tft.print(temp1, 1);
-        _tft.print("C");
-        _tft.write(247);
-        
-        _tft.setTextColor(COLOR_HUMID);
-        _tft.setCursor(5, 55);
-        _tft.print("Nem: ");
-        _tft.print(humid1, 1);
-        _tft.print("%");
+        _gfx->setTextColor(COLOR_TEMP);
+        _gfx->setCursor(5, 40);
+        _gfx->print("Sicaklik: ");
+        _gfx->print(temp1, 1);
+        _gfx->print("C");
+        _gfx->write(247);
+        
+        _gfx->setTextColor(COLOR_HUMID);
+        _gfx->setCursor(5, 55);
+        _gfx->print("Nem: ");
+        _gfx->print(humid1, 1);
+        _gfx->print("%");
     } else {
-        _tft.setTextColor(COLOR_ALARM);
-        _tft.setCursor(5, 40);
-        _tft.print("CALISMIOR!");
+        _gfx->setTextColor(COLOR_ALARM);
+        _gfx->setCursor(5, 40);
+        _gfx->print("CALISMIOR!");
     }
     
     // Sensör 2 bilgileri
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, 75);
-    _tft.print("SENSOR 2:");
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, 75);
+    _gfx->print("SENSOR 2:");
     
     if (sensor2Working) {
-        _tft.setTextColor(COLOR_TEMP);
-        _tft.setCursor(5, 90);
-        _tft.print("Sicaklik: ");
-        _tft.print(temp2, 1);
-        _tft.print("C");
-        _tft.write(247);
-        
-        _tft.setTextColor(COLOR_HUMID);
-        _tft.setCursor(5, 105);
-        _tft.print("Nem: ");
-        _tft.print(humid2, 1);
-        _tft.print("%");
+        _gfx->setTextColor(COLOR_TEMP);
+        _gfx->setCursor(5, 90);
+        _gfx->print("Sicaklik: ");
+        _gfx->print(temp2, 1);
+        _gfx->print("C");
+        _gfx->write(247);
+        
+        _gfx->setTextColor(COLOR_HUMID);
+        _gfx->setCursor(5, 105);
+        _gfx->print("Nem: ");
+        _gfx->print(humid2, 1);
+        _gfx->print("%");
     } else {
-        _tft.setTextColor(COLOR_ALARM);
-        _tft.setCursor(5, 90);
-        _tft.print("CALISMIOR!");
+        _gfx->setTextColor(COLOR_ALARM);
+        _gfx->setCursor(5, 90);
+        _gfx->print("CALISMIOR!");
     }
     
     // Yönergeler
-    _tft.fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, SCREEN_HEIGHT - 13);
-    _tft.print("<:Geri");
+    _gfx->fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, SCREEN_HEIGHT - 13);
+    _gfx->print("<:Geri");
     
     _needsFullRedraw = false;
+    _present();
+}
+
+void Display::showTrendScreen(const TrendData& data, const char* spanLabel) {
+    // Aynı aralık ve aynı geçmiş sürümü zaten ekrandaysa çizme
+    if (_currentMode == DISPLAY_TREND && !_needsFullRedraw &&
+        _trendDrawnData == &data && _trendDrawnVersion == data.version) {
+        return;
+    }
+    
+    // Ekran modu değişti
+    _currentMode = DISPLAY_TREND;
+    
+    clear();
+    
+    // Başlık
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, 5);
+    _gfx->print("TREND - ");
+    _gfx->print(spanLabel);
+    _gfx->drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
+    
+    // Üstte sıcaklık, altta nem
+    _drawTrendSeries(data.temp, 19, 42, COLOR_TREND_TEMP_BAND, COLOR_TEMP, "C");
+    _gfx->drawFastHLine(0, 63, SCREEN_WIDTH, COLOR_DIVISION);
+    _drawTrendSeries(data.humid, 66, 42, COLOR_TREND_HUMID_BAND, COLOR_HUMID, "%");
+    
+    // Yönergeler
+    _gfx->fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, SCREEN_HEIGHT - 13);
+    _gfx->print("^v:Aralik <:Geri");
+    
+    _trendDrawnData = &data;
+    _trendDrawnVersion = data.version;
+    _needsFullRedraw = false;
+    _present();
+}
+
+void Display::_drawTrendSeries(const TrendSeries& series, int16_t top, int16_t height,
+                               uint16_t bandColor, uint16_t lineColor, const char* unit) {
+    const int16_t plotX = SCREEN_WIDTH - TREND_COLUMNS - 2;
+    
+    // Eksen etiketleri: üst/alt sınır ve birim
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(lineColor);
+    _gfx->setCursor(2, top);
+    _gfx->print(series.scaleHigh / 10.0f, 1);
+    _gfx->setCursor(2, top + height / 2 - 4);
+    _gfx->print(unit);
+    _gfx->setCursor(2, top + height - 8);
+    _gfx->print(series.scaleLow / 10.0f, 1);
+    
+    if (series.validColumns == 0) {
+        _gfx->setTextColor(COLOR_DIVISION);
+        _gfx->setCursor(plotX + TREND_COLUMNS / 2 - 24, top + height / 2 - 4);
+        _gfx->print("Veri yok");
+        return;
+    }
+    
+    const int32_t range = series.scaleHigh - series.scaleLow;
+    const int16_t bottom = top + height - 1;
+    int16_t previousMeanY = -1;
+    
+    for (int16_t column = 0; column < TREND_COLUMNS; column++) {
+        if (series.min[column] > series.max[column]) {
+            previousMeanY = -1; // Veri boşluğunda ortalama çizgisi kopar
+            continue;
+        }
+        
+        int16_t x = plotX + column;
+        int16_t yHigh = bottom - (int32_t)(series.max[column] - series.scaleLow) * (height - 1) / range;
+        int16_t yLow = bottom - (int32_t)(series.min[column] - series.scaleLow) * (height - 1) / range;
+        int16_t yMean = bottom - (int32_t)(series.mean[column] - series.scaleLow) * (height - 1) / range;
+        
+        // Min/max zarfı: sütun başına tek dikey çizgi
+        _gfx->drawFastVLine(x, yHigh, yLow - yHigh + 1, bandColor);
+        
+        // Ortalama çizgisi: önceki sütunun ortalamasına dikey açıklıkla bağlan
+        int16_t spanTop = yMean;
+        int16_t spanBottom = yMean;
+        if (previousMeanY >= 0) {
+            spanTop = min(previousMeanY, yMean);
+            spanBottom = max(previousMeanY, yMean);
+        }
+        _gfx->drawFastVLine(x, spanTop, spanBottom - spanTop + 1, lineColor);
+        previousMeanY = yMean;
+    }
 }
 
 void Display::showConfirmationMessage(String message) {
     // Ekran modu değişti
     _currentMode = DISPLAY_CONFIRMATION;
     
-    _tft.fillRect(20, SCREEN_HEIGHT / 2 - 20, SCREEN_WIDTH - 40, 40, COLOR_BACKGROUND);
-    _tft.drawRect(20, SCREEN_HEIGHT / 2 - 20, SCREEN_WIDTH - 40, 40, COLOR_HIGHLIGHT);
+    _gfx->fillRect(20, SCREEN_HEIGHT / 2 - 20, SCREEN_WIDTH - 40, 40, COLOR_BACKGROUND);
+    _gfx->drawRect(20, SCREEN_HEIGHT / 2 - 20, SCREEN_WIDTH - 40, 40, COLOR_HIGHLIGHT);
     
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_HIGHLIGHT);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_HIGHLIGHT);
     
     // Mesajın boyutlarını ölç
     int16_t x1, y1;
     uint16_t w, h;
-    _tft.getTextBounds(message, 0, 0, &x1, &y1, &w, &h);
-    _tft.setCursor((SCREEN_WIDTH - w) / 2, SCREEN_HEIGHT / 2 - h / 2);
-    _tft.print(message);
+    _gfx->getTextBounds(message, 0, 0, &x1, &y1, &w, &h);
+    _gfx->setCursor((SCREEN_WIDTH - w) / 2, SCREEN_HEIGHT / 2 - h / 2);
+    _gfx->print(message);
+    
+    _presentNow();
     
     // Watchdog besleme
     esp_task_wdt_reset();
@@ -884,26 +881,27 @@ void Display::showAlarmMessage(String alarmType, String alarmValue) {
     // Ekran modu değişti
     _currentMode = DISPLAY_ALARM;
     
-    _tft.fillRect(10, SCREEN_HEIGHT / 2 - 25, SCREEN_WIDTH - 20, 50, COLOR_BACKGROUND);
-    _tft.drawRect(10, SCREEN_HEIGHT / 2 - 25, SCREEN_WIDTH - 20, 50, COLOR_ALARM);
+    _gfx->fillRect(10, SCREEN_HEIGHT / 2 - 25, SCREEN_WIDTH - 20, 50, COLOR_BACKGROUND);
+    _gfx->drawRect(10, SCREEN_HEIGHT / 2 - 25, SCREEN_WIDTH - 20, 50, COLOR_ALARM);
     
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_ALARM);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_ALARM);
     
     // Alarm başlığı
-    _tft.setCursor(20, SCREEN_HEIGHT / 2 - 15);
-    _tft.print("ALARM");
+    _gfx->setCursor(20, SCREEN_HEIGHT / 2 - 15);
+    _gfx->print("ALARM");
     
     // Alarm tipi
-    _tft.setCursor(20, SCREEN_HEIGHT / 2);
-    _tft.print(alarmType);
+    _gfx->setCursor(20, SCREEN_HEIGHT / 2);
+    _gfx->print(alarmType);
     
     // Alarm değeri
-    _tft.setCursor(20, SCREEN_HEIGHT / 2 + 15);
-    _tft.print(alarmValue);
+    _gfx->setCursor(20, SCREEN_HEIGHT / 2 + 15);
+    _gfx->print(alarmValue);
     
     // Ana ekrana dönüşte tam çizimi zorla
     _needsFullRedraw = true;
+    _present();
 }
 
 void Display::showProgressBar(int x, int y, int width, int height, uint16_t color, int percentage) {
@@ -911,15 +909,15 @@ void Display::showProgressBar(int x, int y, int width, int height, uint16_t colo
     percentage = constrain(percentage, 0, 100);
     
     // Çerçeve
-    _tft.drawRect(x, y, width, height, COLOR_TEXT);
+    _gfx->drawRect(x, y, width, height, COLOR_TEXT);
     
     // İçeriği temizle
-    _tft.fillRect(x + 1, y + 1, width - 2, height - 2, COLOR_BACKGROUND);
+    _gfx->fillRect(x + 1, y + 1, width - 2, height - 2, COLOR_BACKGROUND);
     
     // İlerleme değerini göster
     if (percentage > 0) {
         int fillWidth = ((width - 2) * percentage) / 100;
-        _tft.fillRect(x + 1, y + 1, fillWidth, height - 2, color);
+        _gfx->fillRect(x + 1, y + 1, fillWidth, height - 2, color);
         
         // Yüzde değerini metin olarak göster (ilerleme çubuğu yeterince genişse)
         if (width > 40) {
@@ -927,19 +925,21 @@ void Display::showProgressBar(int x, int y, int width, int height, uint16_t colo
             sprintf(percentText, "%d%%", percentage);
             
             // Metin konumu ayarları
-            _tft.setTextSize(1);
-            _tft.setTextColor(COLOR_TEXT);
+            _gfx->setTextSize(1);
+            _gfx->setTextColor(COLOR_TEXT);
             
             // Metin boyutunu ölç
             int16_t x1, y1;
             uint16_t w, h;
-            _tft.getTextBounds(percentText, 0, 0, &x1, &y1, &w, &h);
+            _gfx->getTextBounds(percentText, 0, 0, &x1, &y1, &w, &h);
             
             // Metni ilerleme çubuğunun ortasına yerleştir
-            _tft.setCursor(x + (width - w) / 2, y + (height - h) / 2 + 1);
-            _tft.print(percentText);
+            _gfx->setCursor(x + (width - w) / 2, y + (height - h) / 2 + 1);
+            _gfx->print(percentText);
         }
     }
+    
+    _present();
 }
 
 // Menü öğelerinin değiştiğini belirt
@@ -959,34 +959,35 @@ void Display::showPIDStatusScreen(String pidMode, String pidValues) {
     clear();
     
     // Başlık
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, 5);
-    _tft.print("PID DURUMU");
-    _tft.drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, 5);
+    _gfx->print("PID DURUMU");
+    _gfx->drawFastHLine(0, 15, SCREEN_WIDTH, COLOR_DIVISION);
     
     // PID modu
-    _tft.setTextSize(2);
-    _tft.setTextColor(COLOR_HIGHLIGHT);
-    _tft.setCursor(10, 30);
-    _tft.print("Mod:");
+    _gfx->setTextSize(2);
+    _gfx->setTextColor(COLOR_HIGHLIGHT);
+    _gfx->setCursor(10, 30);
+    _gfx->print("Mod:");
     
-    _tft.setTextColor(COLOR_TARGET);
-    _tft.setCursor(10, 50);
-    _tft.print(pidMode);
+    _gfx->setTextColor(COLOR_TARGET);
+    _gfx->setCursor(10, 50);
+    _gfx->print(pidMode);
     
     // PID değerleri
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(10, 75);
-    _tft.print(pidValues);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(10, 75);
+    _gfx->print(pidValues);
     
     // Yönergeler
-    _tft.fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
-    _tft.setTextSize(1);
-    _tft.setTextColor(COLOR_TEXT);
-    _tft.setCursor(5, SCREEN_HEIGHT - 13);
-    _tft.print("<:Geri");
+    _gfx->fillRect(0, SCREEN_HEIGHT - 15, SCREEN_WIDTH, 15, COLOR_DIVISION);
+    _gfx->setTextSize(1);
+    _gfx->setTextColor(COLOR_TEXT);
+    _gfx->setCursor(5, SCREEN_HEIGHT - 13);
+    _gfx->print("<:Geri");
     
     _needsFullRedraw = false;
+    _present();
 }
\ No newline at end of file
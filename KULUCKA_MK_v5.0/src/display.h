@@ -12,6 +12,9 @@
 #include <Adafruit_ST7735.h>
 #include <SPI.h>
 #include "config.h"
+#include "framebuffer.h"
+#include "widgets.h"
+#include "sensor_history.h"
 
 // Ekran modları
 enum DisplayMode {
@@ -25,10 +28,38 @@ enum DisplayMode {
     DISPLAY_DATE_ADJUST,  // Tarih ayarlama ekranı
     DISPLAY_CONFIRMATION, // Onay mesajı ekranı
     DISPLAY_ALARM,        // Alarm mesajı ekranı
-    DISPLAY_PID_STATUS    // PID durum ekranı
+    DISPLAY_PID_STATUS,   // PID durum ekranı
+    DISPLAY_TREND         // Sıcaklık/nem trend grafiği
 };
 
-class Display {
+struct MenuView;
+
+// Menü satırı önbelleği: panelde o satırda şu an ne çizili olduğu
+struct MenuRowCache {
+    char text[MENU_ROW_TEXT_LENGTH];
+    bool selected;
+    bool valid;
+};
+
+// Ana ekranda gösterilen değerler
+struct MainScreenData {
+    float currentTemp;
+    float targetTemp;
+    float currentHumid;
+    float targetHumid;
+    int motorMinutesLeft;
+    int motorSecondsLeft;
+    int currentDay;
+    int totalDays;
+    const char* incubationType;
+    bool heatingActive;
+    bool humidActive;
+    bool motorActive;
+    const char* timeStr;
+    const char* dateStr;
+};
+
+class Display : public GlyphSink {
 public:
     // Yapılandırıcı
     Display();
@@ -45,15 +76,11 @@ public:
     // Ekranı tamamen temizle
     void clear();
     
-    // Ana ekranı güncelle
-    void updateMainScreen(float currentTemp, float targetTemp, float currentHumid, 
-                          float targetHumid, int motorMinutesLeft, int motorSecondsLeft, 
-                          int currentDay, int totalDays, String incubationType,
-                          bool heatingActive, bool humidActive, bool motorActive,
-                          String timeStr, String dateStr);
+    // Ana ekranı güncelle (yalnızca değişen öğeler çizilir)
+    void updateMainScreen(const MainScreenData& data);
     
-    // Menü ekranını göster
-    void showMenu(String menuItems[], int itemCount, int selectedItem);
+    // Menü ekranını göster (yalnızca değişen satırlar yeniden çizilir)
+    void showMenu(const MenuView& menuItems, int selectedItem);
     
     // Alt menü ekranını göster
     void showSubmenu(String submenuItems[], int itemCount, int selectedItem);
@@ -74,6 +101,9 @@ public:
     void showSensorValuesScreen(float temp1, float humid1, float temp2, float humid2, 
                                bool sensor1Working, bool sensor2Working);
     
+    // Trend grafiğini göster (aynı veri zaten çiziliyse yeniden çizmez)
+    void showTrendScreen(const TrendData& data, const char* spanLabel);
+    
     // Onay mesajı göster
     void showConfirmationMessage(String message);
     
@@ -91,10 +121,25 @@ public:
     
     // Mevcut ekran modunu al
     DisplayMode getCurrentMode();
+    
+    // Arka plan DMA gönderimini ilerlet (ana döngüden her turda çağrılmalı)
+    void service();
+    
+    // Ekran tamponu istatistikleri
+    bool isBuffered() const;
+    uint32_t getFlushCount() const;
+    uint32_t getFlushedPixels() const;
+    
+    // Glif bloğunu etkin hedefe tek pencerede yaz (GlyphSink)
+    void blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels) override;
 
 private:
     Adafruit_ST7735 _tft;
     
+    // Çizim hedefi: ekran tamponu (varsayılan) ya da doğrudan panel (yedek)
+    FrameBuffer _frame;
+    Adafruit_GFX* _gfx;
+    
     // Mevcut ekran modu
     DisplayMode _currentMode;
     
@@ -102,21 +147,41 @@ private:
     int _lastSelectedItem;
     bool _menuChanged;
     
-    // Son değerleri saklayan değişkenler
-    float _lastTemp = -999;
-    float _lastTargetTemp = -999;
-    float _lastHumid = -999;
-    float _lastTargetHumid = -999;
-    int _lastMotorMin = -1;
-    int _lastMotorSec = -1;
-    int _lastDay = -1;
-    int _lastTotalDays = -1;
-    bool _lastHeatingActive = false;
-    bool _lastHumidActive = false;
-    bool _lastMotorActive = false;
-    String _lastTimeStr = "";
-    String _lastDateStr = "";
-    String _lastType = "";
+    // Menü düzeni önbelleği
+    MenuRowCache _menuRows[MENU_VISIBLE_ITEMS];
+    int _menuVisibleRows;
+    int _menuItemHeight;
+    int _menuDrawnOffset;
+    uint8_t _menuArrows;
+    
+    // Ana ekran öğeleri (son çizilen metni ve rengi kendileri saklar)
+    WidgetScreen _mainScreen;
+    TextLabel _timeLabel;
+    TextLabel _logoLabel;
+    TextLabel _dateLabel;
+    TextLabel _tempTitle;
+    DigitLabel _tempValue;
+    TextLabel _tempTarget;
+    TextLabel _humidTitle;
+    DigitLabel _humidValue;
+    TextLabel _humidTarget;
+    TextLabel _motorTitle;
+    TextLabel _motorMinLabel;
+    DigitLabel _motorMinValue;
+    TextLabel _motorSecLabel;
+    DigitLabel _motorSecValue;
+    TextLabel _incubationTitle;
+    DigitLabel _dayValue;
+    TextLabel _typeLabel;
+    
+    // Değer ayarlama ekranı: art arda değişimlerde yalnızca değer satırı çizilir
+    TextLabel _adjustValueLabel;
+    String _adjustDrawnTitle;
+    bool _adjustScreenDrawn;
+    
+    // Trend ekranında çizili olan veri (aralık önbelleği ve sürümü)
+    const TrendData* _trendDrawnData;
+    uint32_t _trendDrawnVersion;
     
     // Tam ekran yenileme gerekli mi?
     bool _needsFullRedraw = true;
@@ -124,20 +189,25 @@ private:
     // Ekranı bölmelere ayır
     void _drawDividers();
     
-    // Bilgi satırını güncelle
-    void _updateInfoBar(String timeStr, String dateStr);
+    // Ana ekran öğelerinin yerleşimi (yapılandırıcıda bir kez)
+    void _layoutMainScreen();
+    
+    // Ana ekran zeminini (bölücüler) çiz ve tüm öğeleri kirlet
+    void _drawMainBackground();
     
-    // Sıcaklık bölmesini güncelle
-    void _updateTempSection(float currentTemp, float targetTemp, bool heatingActive);
+    // Menü satırını önbellekle karşılaştırıp gerekirse çiz
+    void _drawMenuRow(int row, const char* text, bool selected);
     
-    // Nem bölmesini güncelle
-    void _updateHumidSection(float currentHumid, float targetHumid, bool humidActive);
+    // Menü kaydırıldığında satırları kaydır (tamponlu modda pikselleri de taşır)
+    void _scrollMenuRows(int delta);
     
-    // Motor bölmesini güncelle
-    void _updateMotorSection(int minutesLeft, int secondsLeft, bool motorActive);
+    // Tek ölçümün grafiğini sütun sütun dikey çizgilerle çiz
+    void _drawTrendSeries(const TrendSeries& series, int16_t top, int16_t height,
+                          uint16_t bandColor, uint16_t lineColor, const char* unit);
     
-    // Kuluçka bölmesini güncelle - PARAMETRE TÜRÜ DEĞİŞTİRİLDİ
-    void _updateIncubationSection(int currentDay, int totalDays, const char* incubationType);
+    // Çizilenleri panele gönder (arka planda / beklemeli)
+    void _present();
+    void _presentNow();
     
 };
 
@@ -0,0 +1,161 @@
+/**
+ * @file display_power.cpp
+ * @brief Ekran arka ışığı ve yenileme temposu için güç durum makinesi uygulaması
+ * @version 1.0
+ */
+
+#include "display_power.h"
+#include <driver/ledc.h>
+#include <esp_idf_version.h>
+
+DisplayPower::DisplayPower() {
+    _state = DISPLAY_POWER_ACTIVE;
+    _lastActivityTime = 0;
+    _pwmReady = false;
+    _fadeReady = false;
+    _wokeFromOff = false;
+}
+
+bool DisplayPower::begin() {
+    _lastActivityTime = millis();
+    
+    ledc_timer_config_t timerConfig = {};
+    timerConfig.speed_mode = LEDC_LOW_SPEED_MODE;
+    timerConfig.duty_resolution = (ledc_timer_bit_t)BACKLIGHT_PWM_RESOLUTION;
+    timerConfig.timer_num = (ledc_timer_t)BACKLIGHT_LEDC_TIMER;
+    timerConfig.freq_hz = BACKLIGHT_PWM_FREQUENCY;
+    timerConfig.clk_cfg = LEDC_AUTO_CLK;
+    
+    ledc_channel_config_t channelConfig = {};
+    channelConfig.gpio_num = TFT_LED;
+    channelConfig.speed_mode = LEDC_LOW_SPEED_MODE;
+    channelConfig.channel = (ledc_channel_t)BACKLIGHT_LEDC_CHANNEL;
+    channelConfig.intr_type = LEDC_INTR_DISABLE;
+    channelConfig.timer_sel = (ledc_timer_t)BACKLIGHT_LEDC_TIMER;
+    channelConfig.duty = BACKLIGHT_FULL;
+    channelConfig.hpoint = 0;
+    
+    if (ledc_timer_config(&timerConfig) != ESP_OK ||
+        ledc_channel_config(&channelConfig) != ESP_OK) {
+        // Yedek: arka ışık yalnızca açık/kapalı sürülür
+        Serial.println("Arka ışık PWM başlatılamadı, açık/kapalı moda geçildi");
+        pinMode(TFT_LED, OUTPUT);
+        digitalWrite(TFT_LED, HIGH);
+        return false;
+    }
+    
+    _pwmReady = true;
+    
+    // Fade servisi başka bir modül tarafından kurulmuş olabilir
+    esp_err_t fadeResult = ledc_fade_func_install(0);
+    _fadeReady = (fadeResult == ESP_OK || fadeResult == ESP_ERR_INVALID_STATE);
+    
+    return true;
+}
+
+void DisplayPower::update(unsigned long lastActivityTime, bool alarmActive) {
+    unsigned long now = millis();
+    
+    // Alarm sürdükçe ekran uyanık kalır
+    if (alarmActive) {
+        lastActivityTime = now;
+    }
+    
+    // Yeni etkileşim: anında uyan
+    if ((long)(lastActivityTime - _lastActivityTime) > 0) {
+        _lastActivityTime = lastActivityTime;
+        if (_state != DISPLAY_POWER_ACTIVE) {
+            wake();
+        }
+        return;
+    }
+    
+    unsigned long idleTime = now - _lastActivityTime;
+    
+    if (_state == DISPLAY_POWER_ACTIVE && idleTime >= DISPLAY_DIM_TIMEOUT) {
+        _setState(DISPLAY_POWER_DIMMED);
+    } else if (_state == DISPLAY_POWER_DIMMED && idleTime >= DISPLAY_OFF_TIMEOUT) {
+        _setState(DISPLAY_POWER_OFF);
+    }
+}
+
+void DisplayPower::wake() {
+    _lastActivityTime = millis();
+    if (_state != DISPLAY_POWER_ACTIVE) {
+        _setState(DISPLAY_POWER_ACTIVE);
+    }
+}
+
+DisplayPowerState DisplayPower::getState() const {
+    return _state;
+}
+
+bool DisplayPower::isPanelOn() const {
+    return _state != DISPLAY_POWER_OFF;
+}
+
+unsigned long DisplayPower::getRefreshInterval() const {
+    switch (_state) {
+        case DISPLAY_POWER_ACTIVE:
+            return DISPLAY_REFRESH_DELAY;
+        case DISPLAY_POWER_DIMMED:
+            return DISPLAY_IDLE_REFRESH_DELAY;
+        default:
+            return 0;
+    }
+}
+
+bool DisplayPower::consumeWakeFromOff() {
+    bool woke = _wokeFromOff;
+    _wokeFromOff = false;
+    return woke;
+}
+
+void DisplayPower::_setState(DisplayPowerState state) {
+    if (_state == DISPLAY_POWER_OFF && state != DISPLAY_POWER_OFF) {
+        _wokeFromOff = true;
+    }
+    _state = state;
+    
+    switch (state) {
+        case DISPLAY_POWER_ACTIVE:
+            _setBrightness(BACKLIGHT_FULL, false);
+            Serial.println("Ekran: etkin");
+            break;
+        case DISPLAY_POWER_DIMMED:
+            _setBrightness(BACKLIGHT_DIM, true);
+            Serial.println("Ekran: kısık");
+            break;
+        case DISPLAY_POWER_OFF:
+            _setBrightness(0, true);
+            Serial.println("Ekran: kapalı");
+            break;
+    }
+}
+
+void DisplayPower::_setBrightness(uint32_t duty, bool fade) {
+    if (!_pwmReady) {
+        digitalWrite(TFT_LED, duty > 0 ? HIGH : LOW);
+        return;
+    }
+    
+    ledc_channel_t channel = (ledc_channel_t)BACKLIGHT_LEDC_CHANNEL;
+    
+    if (!_fadeReady) {
+        ledc_set_duty(LEDC_LOW_SPEED_MODE, channel, duty);
+        ledc_update_duty(LEDC_LOW_SPEED_MODE, channel);
+    } else if (fade) {
+        ledc_set_fade_time_and_start(LEDC_LOW_SPEED_MODE, channel, duty,
+                                     BACKLIGHT_FADE_MS, LEDC_FADE_NO_WAIT);
+    } else {
+        // Uyanış gecikmesiz olmalı. ledc_set_duty_and_update() süren kısılmanın
+        // bitmesini bekler (en çok BACKLIGHT_FADE_MS), bu yüzden kullanılmaz:
+        // IDF 5'te kısılma önce durdurulur, eski sürümlerde ledc_set_duty +
+        // ledc_update_duty fade kilidini beklemeden yeni değeri yazar.
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+        ledc_fade_stop(LEDC_LOW_SPEED_MODE, channel);
+#endif
+        ledc_set_duty(LEDC_LOW_SPEED_MODE, channel, duty);
+        ledc_update_duty(LEDC_LOW_SPEED_MODE, channel);
+    }
+}
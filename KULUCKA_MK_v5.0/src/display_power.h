@@ -0,0 +1,65 @@
+/**
+ * @file display_power.h
+ * @brief Ekran arka ışığı ve yenileme temposu için güç durum makinesi
+ * @version 1.0
+ */
+
+#ifndef DISPLAY_POWER_H
+#define DISPLAY_POWER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Ekran güç durumları
+enum DisplayPowerState {
+    DISPLAY_POWER_ACTIVE,   // Tam parlaklık, normal yenileme
+    DISPLAY_POWER_DIMMED,   // Kısık parlaklık, seyrek yenileme
+    DISPLAY_POWER_OFF       // Arka ışık kapalı, yenileme ve SPI trafiği yok
+};
+
+// Kullanıcı girişi ve alarmlarla sürülen ekran güç yönetimi. Etkileşim
+// olmadığında önce kısılır, sonra kapanır; giriş veya alarm anında tam
+// parlaklığa döner. Arka ışık LEDC PWM ile sürülür, kısılma donanım
+// fade ile yapılır (CPU kullanmaz).
+class DisplayPower {
+public:
+    // Yapılandırıcı
+    DisplayPower();
+    
+    // Arka ışık PWM'ini başlat (display.begin() sonrasında çağrılmalı)
+    bool begin();
+    
+    // Durum makinesini ilerlet (her döngüde). lastActivityTime: son kullanıcı
+    // girişi (millis), alarmActive: aktif alarm ekranı uyanık tutar
+    void update(unsigned long lastActivityTime, bool alarmActive);
+    
+    // Hemen tam parlaklığa dön
+    void wake();
+    
+    // Mevcut durum
+    DisplayPowerState getState() const;
+    
+    // Panel görünür mü? (kapalıyken çizim ve SPI gönderimi yapılmamalı)
+    bool isPanelOn() const;
+    
+    // Ana ekran yenileme aralığı (ms), 0: yenileme yapılmaz
+    unsigned long getRefreshInterval() const;
+    
+    // Kapalı durumdan uyanıldıysa bir kez true döner (ekran tazelenmeli)
+    bool consumeWakeFromOff();
+
+private:
+    DisplayPowerState _state;
+    unsigned long _lastActivityTime;
+    bool _pwmReady;
+    bool _fadeReady;
+    bool _wokeFromOff;
+    
+    // Durum geçişi
+    void _setState(DisplayPowerState state);
+    
+    // Arka ışık parlaklığını ayarla (fade: kısılırken yumuşak geçiş)
+    void _setBrightness(uint32_t duty, bool fade);
+};
+
+#endif // DISPLAY_POWER_H
@@ -0,0 +1,187 @@
+/**
+ * @file feed_forward.cpp
+ * @brief Isıtıcı ileri besleme modülü uygulaması
+ * @version 1.0
+ */
+
+#include "feed_forward.h"
+
+// Kovaryans matrisinin sınırsız büyümesini önlemek için üst sınır
+static const double FF_COVARIANCE_LIMIT = 1000.0;
+
+FeedForward::FeedForward() {
+    _state = EPISODE_IDLE;
+    _disturbance = false;
+    _seenActive = false;
+    _baselineValid = false;
+    _baselineTemp = 0.0;
+    _episodeStartTemp = 0.0;
+    _minTemp = 0.0;
+    _episodeStartTime = 0;
+    _observeStartTime = 0;
+    begin(0.0);
+}
+
+void FeedForward::begin(double initialBias) {
+    _bias = constrain(initialBias, 0.0, FF_MAX_BIAS);
+    _episodeBias = _bias;
+    _lastDip = 0.0;
+    _episodeCount = 0;
+    
+    // Model başlangıçta bilinmiyor, yüksek kovaryans ile başla
+    _theta[0] = 0.0;
+    _theta[1] = 0.0;
+    _P[0][0] = 100.0;
+    _P[0][1] = 0.0;
+    _P[1][0] = 0.0;
+    _P[1][1] = 100.0;
+    
+    abortEpisode();
+}
+
+void FeedForward::setDisturbance(bool active) {
+    _disturbance = active;
+    
+    // Sensör okumaları arasında kalan kısa darbeleri kaçırma
+    if (active) {
+        _seenActive = true;
+    }
+}
+
+bool FeedForward::isDisturbanceActive() const {
+    return _disturbance;
+}
+
+void FeedForward::learn(double temperature) {
+    unsigned long now = millis();
+    bool active = _disturbance || _seenActive;
+    _seenActive = false;
+    
+    switch (_state) {
+        case EPISODE_IDLE:
+            if (active && _baselineValid) {
+                _state = EPISODE_ACTIVE;
+                _episodeStartTemp = _baselineTemp;
+                _minTemp = temperature;
+                _episodeBias = _bias;
+                _episodeStartTime = now;
+            } else if (!active) {
+                // Isıtıcı salınımını bastırmak için referansı süz
+                if (_baselineValid) {
+                    _baselineTemp += (temperature - _baselineTemp) * 0.2;
+                } else {
+                    _baselineTemp = temperature;
+                    _baselineValid = true;
+                }
+            }
+            break;
+            
+        case EPISODE_ACTIVE:
+            _minTemp = min(_minTemp, temperature);
+            if (!active) {
+                _state = EPISODE_OBSERVE;
+                _observeStartTime = now;
+            }
+            break;
+            
+        case EPISODE_OBSERVE:
+            _minTemp = min(_minTemp, temperature);
+            if (active) {
+                // Röle tekrar açıldı, aynı olayın devamı say
+                _state = EPISODE_ACTIVE;
+            } else if (now - _observeStartTime >= FF_OBSERVE_WINDOW) {
+                _finishEpisode();
+            }
+            break;
+    }
+    
+    // Takılı kalmış röle gibi çok uzun olaylar modeli bozmasın
+    if (_state != EPISODE_IDLE && now - _episodeStartTime > FF_MAX_EPISODE_TIME) {
+        abortEpisode();
+    }
+}
+
+void FeedForward::abortEpisode() {
+    _state = EPISODE_IDLE;
+    _seenActive = false;
+    _baselineValid = false;
+}
+
+double FeedForward::getBias() const {
+    return _bias;
+}
+
+void FeedForward::setBias(double bias) {
+    _bias = constrain(bias, 0.0, FF_MAX_BIAS);
+}
+
+double FeedForward::getActiveBias() const {
+    return _disturbance ? _bias : 0.0;
+}
+
+double FeedForward::getLastDip() const {
+    return _lastDip;
+}
+
+double FeedForward::getSensitivity() const {
+    return _theta[1];
+}
+
+uint16_t FeedForward::getEpisodeCount() const {
+    return _episodeCount;
+}
+
+void FeedForward::_finishEpisode() {
+    _lastDip = _episodeStartTemp - _minTemp;
+    _episodeCount++;
+    
+    _updateModel(_episodeBias, _lastDip);
+    
+    // Model yeterince tanımlandıysa düşüşü sıfırlayan katkıyı hedefle,
+    // aksi halde gözlenen düşüşe orantılı küçük bir adım at
+    double target;
+    if (_theta[1] > FF_MIN_SENSITIVITY) {
+        target = _theta[0] / _theta[1];
+    } else {
+        target = _bias + FF_LEARN_RATE * _lastDip;
+    }
+    
+    double step = constrain(target - _bias, -FF_MAX_STEP, FF_MAX_STEP);
+    setBias(_bias + step);
+    
+    Serial.println("FF: Olay tamamlandı - Düşüş: " + String(_lastDip, 2) + 
+                   "°C, Yeni katkı: " + String(_bias, 3));
+    
+    // Sonraki olay için referansı baştan kur
+    _state = EPISODE_IDLE;
+    _baselineValid = false;
+}
+
+void FeedForward::_updateModel(double bias, double dip) {
+    // Regresör: [1, -katkı]
+    double phi[2] = {1.0, -bias};
+    
+    double Pphi[2] = {
+        _P[0][0] * phi[0] + _P[0][1] * phi[1],
+        _P[1][0] * phi[0] + _P[1][1] * phi[1]
+    };
+    double denom = FF_FORGETTING + phi[0] * Pphi[0] + phi[1] * Pphi[1];
+    double gain[2] = {Pphi[0] / denom, Pphi[1] / denom};
+    
+    double predicted = _theta[0] * phi[0] + _theta[1] * phi[1];
+    double residual = dip - predicted;
+    _theta[0] += gain[0] * residual;
+    _theta[1] += gain[1] * residual;
+    
+    // P = (P - K * phi' * P) / lambda; uyarım yoksa unutma uygulanmaz
+    double trace = _P[0][0] + _P[1][1];
+    double lambda = (trace > FF_COVARIANCE_LIMIT) ? 1.0 : FF_FORGETTING;
+    
+    double newP[2][2];
+    for (uint8_t i = 0; i < 2; i++) {
+        for (uint8_t j = 0; j < 2; j++) {
+            newP[i][j] = (_P[i][j] - gain[i] * Pphi[j]) / lambda;
+        }
+    }
+    memcpy(_P, newP, sizeof(_P));
+}
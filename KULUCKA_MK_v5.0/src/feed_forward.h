@@ -0,0 +1,87 @@
+/**
+ * @file feed_forward.h
+ * @brief Nemlendirici ve motor kaynaklı sıcaklık düşüşleri için ısıtıcı ileri besleme modülü
+ * @version 1.0
+ */
+
+#ifndef FEED_FORWARD_H
+#define FEED_FORWARD_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Bir bozucu kaynak (nemlendirici veya motor) için öğrenen ileri besleme.
+// Röle açıkken PID çıkışına sabit bir ısıtıcı katkısı eklenir. Her olaydan
+// sonra gözlenen sıcaklık düşüşü ile uygulanan katkı arasındaki ilişki
+// (düşüş = a - g * katkı) özyinelemeli en küçük karelerle tahmin edilir ve
+// katkı, düşüşü sıfırlayacak değere (a / g) doğru güncellenir.
+class FeedForward {
+public:
+    // Yapılandırıcı
+    FeedForward();
+    
+    // Başlangıç katkısını ayarla ve modeli sıfırla
+    void begin(double initialBias);
+    
+    // Röle durumunu bildir (her döngüde çağrılır)
+    void setDisturbance(bool active);
+    
+    // Bozucu kaynak şu an aktif mi?
+    bool isDisturbanceActive() const;
+    
+    // Sıcaklık ölçümü ile olay takibini ve öğrenmeyi güncelle
+    void learn(double temperature);
+    
+    // Devam eden olayı öğrenmeye almadan iptal et
+    void abortEpisode();
+    
+    // Öğrenilmiş katkıyı al / elle ayarla
+    double getBias() const;
+    void setBias(double bias);
+    
+    // Röle açıksa katkı, değilse 0
+    double getActiveBias() const;
+    
+    // Son olayda gözlenen sıcaklık düşüşü (°C)
+    double getLastDip() const;
+    
+    // Tahmin edilen hassasiyet (°C düşüş azalması / katkı birimi)
+    double getSensitivity() const;
+    
+    // Öğrenmeye alınan olay sayısı
+    uint16_t getEpisodeCount() const;
+
+private:
+    // Olay takip durumları
+    enum EpisodeState {
+        EPISODE_IDLE,       // Bozucu kapalı, referans sıcaklık izleniyor
+        EPISODE_ACTIVE,     // Röle açık
+        EPISODE_OBSERVE     // Röle kapandı, gecikmeli düşüş izleniyor
+    };
+    
+    EpisodeState _state;
+    bool _disturbance;          // Anlık röle durumu
+    bool _seenActive;           // Son öğrenmeden beri röle açıldı mı
+    
+    double _bias;               // Uygulanan katkı
+    double _episodeBias;        // Olay sırasında uygulanan katkı
+    double _baselineTemp;       // Olay öncesi süzülmüş sıcaklık
+    bool _baselineValid;
+    double _episodeStartTemp;   // Olay başındaki referans sıcaklık
+    double _minTemp;            // Olay boyunca en düşük sıcaklık
+    double _lastDip;
+    
+    unsigned long _episodeStartTime;
+    unsigned long _observeStartTime;
+    uint16_t _episodeCount;
+    
+    // En küçük kareler modeli: düşüş = _theta[0] - _theta[1] * katkı
+    double _theta[2];
+    double _P[2][2];
+    
+    // Olay sonu modeli ve katkıyı güncelle
+    void _finishEpisode();
+    void _updateModel(double bias, double dip);
+};
+
+#endif // FEED_FORWARD_H
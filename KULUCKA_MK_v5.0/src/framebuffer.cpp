@@ -0,0 +1,434 @@
+/**
+ * @file framebuffer.cpp
+ * @brief PSRAM üzerinde RGB565 ekran tamponu ve kirli bölge DMA gönderimi uygulaması
+ * @version 1.0
+ */
+
+#include "framebuffer.h"
+#include <esp_heap_caps.h>
+#include <driver/gpio.h>
+
+// ST7735 adres penceresi ve bellek yazma komutları
+#define FB_CMD_CASET 0x2A
+#define FB_CMD_RASET 0x2B
+#define FB_CMD_RAMWR 0x2C
+
+// DC hattı her aktarımdan hemen önce kesme bağlamında ayarlanır
+static int8_t s_dcPin = -1;
+
+static void IRAM_ATTR frameBufferPreTransfer(spi_transaction_t* transaction) {
+    gpio_set_level((gpio_num_t)s_dcPin, (int)(intptr_t)transaction->user);
+}
+
+static inline uint16_t toPanelOrder(uint16_t color) {
+    return (color >> 8) | (color << 8);
+}
+
+FrameBuffer::FrameBuffer() : Adafruit_GFX(SCREEN_WIDTH, SCREEN_HEIGHT) {
+    _buffer = nullptr;
+    _inPsram = false;
+    _flushRequested = false;
+    _rectCount = 0;
+    _rectIndex = 0;
+    _rectStarted = false;
+    _rectRow = 0;
+    _spi = nullptr;
+    _transactionHead = 0;
+    _inFlight = 0;
+    _chunks[0] = nullptr;
+    _chunks[1] = nullptr;
+    _chunkBusy[0] = false;
+    _chunkBusy[1] = false;
+    _flushCount = 0;
+    _flushedPixels = 0;
+    
+    for (int16_t y = 0; y < SCREEN_HEIGHT; y++) {
+        _dirtyMinX[y] = SCREEN_WIDTH;
+        _dirtyMaxX[y] = -1;
+    }
+}
+
+FrameBuffer::~FrameBuffer() {
+    if (_buffer != nullptr) {
+        heap_caps_free(_buffer);
+    }
+    for (uint8_t i = 0; i < 2; i++) {
+        if (_chunks[i] != nullptr) {
+            heap_caps_free(_chunks[i]);
+        }
+    }
+}
+
+bool FrameBuffer::begin() {
+    if (_buffer != nullptr) {
+        return true;
+    }
+    
+    size_t size = (size_t)SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t);
+    
+    // Tampon yalnızca PSRAM'de tutulur. ~40 KB dahili RAM, web sunucusu ve
+    // DMA tamponlarından alınmaya değmez; PSRAM yoksa doğrudan çizim kullanılır.
+    _buffer = (uint16_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    _inPsram = (_buffer != nullptr);
+    if (_buffer == nullptr) {
+        Serial.println("Ekran tamponu için PSRAM yok, doğrudan çizime dönülüyor");
+        return false;
+    }
+    
+    memset(_buffer, 0, size);
+    Serial.println("Ekran tamponu ayrıldı: " + String(size) + " bayt (PSRAM)");
+    return true;
+}
+
+bool FrameBuffer::attachSpi(int8_t sclk, int8_t mosi, int8_t cs, int8_t dc, uint32_t frequency) {
+    if (_buffer == nullptr) {
+        return false;
+    }
+    
+    for (uint8_t i = 0; i < 2; i++) {
+        if (_chunks[i] == nullptr) {
+            _chunks[i] = (uint8_t*)heap_caps_malloc(DISPLAY_DMA_CHUNK_SIZE, MALLOC_CAP_DMA);
+        }
+        if (_chunks[i] == nullptr) {
+            Serial.println("Ekran DMA tamponu ayrılamadı");
+            return false;
+        }
+    }
+    
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num = mosi;
+    bus.miso_io_num = -1;
+    bus.sclk_io_num = sclk;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = DISPLAY_DMA_CHUNK_SIZE;
+    
+    esp_err_t result = spi_bus_initialize(TFT_SPI_HOST, &bus, SPI_DMA_CH_AUTO);
+    if (result != ESP_OK) {
+        Serial.println("Ekran SPI hattı başlatılamadı: " + String(result));
+        return false;
+    }
+    
+    spi_device_interface_config_t device = {};
+    device.clock_speed_hz = frequency;
+    device.mode = 0;
+    device.spics_io_num = cs;
+    device.queue_size = DISPLAY_DMA_QUEUE_SIZE;
+    device.pre_cb = frameBufferPreTransfer;
+    
+    result = spi_bus_add_device(TFT_SPI_HOST, &device, &_spi);
+    if (result != ESP_OK) {
+        Serial.println("Ekran SPI cihazı eklenemedi: " + String(result));
+        spi_bus_free(TFT_SPI_HOST);
+        _spi = nullptr;
+        return false;
+    }
+    
+    s_dcPin = dc;
+    pinMode(dc, OUTPUT);
+    
+    // İlk turda tüm tampon gönderilir
+    invalidate();
+    return true;
+}
+
+bool FrameBuffer::isReady() const {
+    return _buffer != nullptr && _spi != nullptr;
+}
+
+bool FrameBuffer::isInPsram() const {
+    return _inPsram;
+}
+
+void FrameBuffer::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) {
+        return;
+    }
+    
+    _buffer[y * SCREEN_WIDTH + x] = toPanelOrder(color);
+    _markRow(y, x, x);
+}
+
+void FrameBuffer::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w < 0) {
+        x += w + 1;
+        w = -w;
+    }
+    if (h < 0) {
+        y += h + 1;
+        h = -h;
+    }
+    
+    // Ekran sınırlarına kırp
+    int16_t x0 = max(x, (int16_t)0);
+    int16_t y0 = max(y, (int16_t)0);
+    int16_t x1 = min((int16_t)(x + w), (int16_t)SCREEN_WIDTH);
+    int16_t y1 = min((int16_t)(y + h), (int16_t)SCREEN_HEIGHT);
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    
+    uint16_t value = toPanelOrder(color);
+    for (int16_t row = y0; row < y1; row++) {
+        uint16_t* pixel = _buffer + row * SCREEN_WIDTH + x0;
+        for (int16_t column = x0; column < x1; column++) {
+            *pixel++ = value;
+        }
+        _markRow(row, x0, x1 - 1);
+    }
+}
+
+void FrameBuffer::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    fillRect(x, y, w, 1, color);
+}
+
+void FrameBuffer::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    fillRect(x, y, 1, h, color);
+}
+
+void FrameBuffer::fillScreen(uint16_t color) {
+    fillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, color);
+}
+
+void FrameBuffer::writeRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels) {
+    // Ekran sınırlarına kırp (kaynak satır adımı w olarak kalır)
+    int16_t x0 = max(x, (int16_t)0);
+    int16_t y0 = max(y, (int16_t)0);
+    int16_t x1 = min((int16_t)(x + w), (int16_t)SCREEN_WIDTH);
+    int16_t y1 = min((int16_t)(y + h), (int16_t)SCREEN_HEIGHT);
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    
+    for (int16_t row = y0; row < y1; row++) {
+        const uint16_t* source = pixels + (row - y) * w + (x0 - x);
+        uint16_t* pixel = _buffer + row * SCREEN_WIDTH + x0;
+        for (int16_t column = x0; column < x1; column++) {
+            *pixel++ = toPanelOrder(*source++);
+        }
+        _markRow(row, x0, x1 - 1);
+    }
+}
+
+void FrameBuffer::scrollRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dy) {
+    int16_t x0 = max(x, (int16_t)0);
+    int16_t y0 = max(y, (int16_t)0);
+    int16_t x1 = min((int16_t)(x + w), (int16_t)SCREEN_WIDTH);
+    int16_t y1 = min((int16_t)(y + h), (int16_t)SCREEN_HEIGHT);
+    if (x0 >= x1 || y0 >= y1 || dy == 0 || abs(dy) >= y1 - y0) {
+        return;
+    }
+    
+    size_t rowBytes = (x1 - x0) * sizeof(uint16_t);
+    if (dy < 0) {
+        // Yukarı: üstten aşağı doğru kopyala
+        for (int16_t row = y0; row < y1 + dy; row++) {
+            memcpy(_buffer + row * SCREEN_WIDTH + x0, _buffer + (row - dy) * SCREEN_WIDTH + x0, rowBytes);
+            _markRow(row, x0, x1 - 1);
+        }
+    } else {
+        // Aşağı: alttan yukarı doğru kopyala
+        for (int16_t row = y1 - 1; row >= y0 + dy; row--) {
+            memcpy(_buffer + row * SCREEN_WIDTH + x0, _buffer + (row - dy) * SCREEN_WIDTH + x0, rowBytes);
+            _markRow(row, x0, x1 - 1);
+        }
+    }
+}
+
+void FrameBuffer::flush() {
+    _flushRequested = true;
+    service();
+}
+
+void FrameBuffer::service() {
+    if (!isReady()) {
+        return;
+    }
+    
+    _reapTransactions(0);
+    
+    // Önceki tur bittiyse biriken kirli bölgelerle yeni tur başlat
+    if (_rectIndex >= _rectCount && _flushRequested) {
+        _flushRequested = false;
+        _collectDirtyRects();
+        _rectIndex = 0;
+        _rectStarted = false;
+        if (_rectCount > 0) {
+            _flushCount++;
+        }
+    }
+    
+    while (_rectIndex < _rectCount) {
+        const DirtyRect& rect = _rects[_rectIndex];
+        
+        // Adres penceresi: CASET + veri, RASET + veri, RAMWR
+        if (!_rectStarted) {
+            if (DISPLAY_DMA_QUEUE_SIZE - _inFlight < 5) {
+                return;
+            }
+            _queueCommand(FB_CMD_CASET, rect.x, rect.x + rect.w - 1, true);
+            _queueCommand(FB_CMD_RASET, rect.y, rect.y + rect.h - 1, true);
+            _queueCommand(FB_CMD_RAMWR, 0, 0, false);
+            _rectStarted = true;
+            _rectRow = rect.y;
+        }
+        
+        // Boş bir DMA tamponu varsa sonraki satır grubunu kopyala ve kuyruğa ekle
+        int8_t chunk = !_chunkBusy[0] ? 0 : (!_chunkBusy[1] ? 1 : -1);
+        if (chunk < 0 || _inFlight >= DISPLAY_DMA_QUEUE_SIZE) {
+            return;
+        }
+        
+        size_t rowBytes = (size_t)rect.w * sizeof(uint16_t);
+        int16_t rows = min((int16_t)(DISPLAY_DMA_CHUNK_SIZE / rowBytes), (int16_t)(rect.y + rect.h - _rectRow));
+        
+        uint8_t* target = _chunks[chunk];
+        for (int16_t row = 0; row < rows; row++) {
+            memcpy(target + row * rowBytes, _buffer + (_rectRow + row) * SCREEN_WIDTH + rect.x, rowBytes);
+        }
+        
+        _chunkBusy[chunk] = true;
+        _queueTransaction(target, rows * rowBytes, true);
+        _rectRow += rows;
+        
+        if (_rectRow >= rect.y + rect.h) {
+            _flushedPixels += (uint32_t)rect.w * rect.h;
+            _rectIndex++;
+            _rectStarted = false;
+        }
+    }
+}
+
+void FrameBuffer::flushBlocking() {
+    if (!isReady()) {
+        return;
+    }
+    
+    _flushRequested = true;
+    unsigned long start = millis();
+    
+    while ((isBusy() || _flushRequested) && millis() - start < DISPLAY_FLUSH_TIMEOUT) {
+        service();
+        if (_inFlight > 0) {
+            _reapTransactions(pdMS_TO_TICKS(5));
+        }
+    }
+}
+
+bool FrameBuffer::isBusy() const {
+    return _rectIndex < _rectCount || _inFlight > 0;
+}
+
+void FrameBuffer::invalidate() {
+    for (int16_t y = 0; y < SCREEN_HEIGHT; y++) {
+        _markRow(y, 0, SCREEN_WIDTH - 1);
+    }
+    _flushRequested = true;
+}
+
+uint32_t FrameBuffer::getFlushCount() const {
+    return _flushCount;
+}
+
+uint32_t FrameBuffer::getFlushedPixels() const {
+    return _flushedPixels;
+}
+
+void FrameBuffer::_markRow(int16_t y, int16_t x0, int16_t x1) {
+    if (x0 < _dirtyMinX[y]) {
+        _dirtyMinX[y] = x0;
+    }
+    if (x1 > _dirtyMaxX[y]) {
+        _dirtyMaxX[y] = x1;
+    }
+}
+
+void FrameBuffer::_collectDirtyRects() {
+    _rectCount = 0;
+    
+    for (int16_t y = 0; y < SCREEN_HEIGHT; y++) {
+        int16_t minX = _dirtyMinX[y];
+        int16_t maxX = _dirtyMaxX[y];
+        if (maxX < 0) {
+            continue;
+        }
+        
+        _dirtyMinX[y] = SCREEN_WIDTH;
+        _dirtyMaxX[y] = -1;
+        
+        // Bir önceki satırın dikdörtgeniyle örtüşen aralık aynı dikdörtgene katılır;
+        // liste dolduğunda kalan satırlar son dikdörtgene eklenir
+        DirtyRect* last = (_rectCount > 0) ? &_rects[_rectCount - 1] : nullptr;
+        bool extend = last != nullptr &&
+                      ((last->y + last->h == y && minX <= last->x + last->w && maxX + 1 >= last->x) ||
+                       _rectCount >= DISPLAY_MAX_DIRTY_RECTS);
+        
+        if (extend) {
+            int16_t left = min(last->x, minX);
+            int16_t right = max((int16_t)(last->x + last->w - 1), maxX);
+            last->x = left;
+            last->w = right - left + 1;
+            last->h = y - last->y + 1;
+        } else {
+            DirtyRect& rect = _rects[_rectCount++];
+            rect.x = minX;
+            rect.y = y;
+            rect.w = maxX - minX + 1;
+            rect.h = 1;
+        }
+    }
+}
+
+void FrameBuffer::_reapTransactions(TickType_t wait) {
+    spi_transaction_t* done = nullptr;
+    
+    while (_inFlight > 0 && spi_device_get_trans_result(_spi, &done, wait) == ESP_OK) {
+        _inFlight--;
+        for (uint8_t i = 0; i < 2; i++) {
+            if (done->tx_buffer == _chunks[i]) {
+                _chunkBusy[i] = false;
+            }
+        }
+        wait = 0;
+    }
+}
+
+bool FrameBuffer::_queueTransaction(const void* data, size_t length, bool isData) {
+    // Tanımlayıcılar sırayla tamamlandığı için halka düzeninde yeniden kullanılır
+    spi_transaction_t& transaction = _transactions[_transactionHead];
+    memset(&transaction, 0, sizeof(transaction));
+    transaction.length = length * 8;
+    transaction.user = (void*)(intptr_t)(isData ? 1 : 0);
+    
+    // Kısa komut verisi tanımlayıcıya kopyalanır; DMA tamponları yerinde gönderilir
+    bool isChunk = (data == _chunks[0] || data == _chunks[1]);
+    if (!isChunk && length <= 4) {
+        transaction.flags = SPI_TRANS_USE_TXDATA;
+        memcpy(transaction.tx_data, data, length);
+    } else {
+        transaction.tx_buffer = data;
+    }
+    
+    if (spi_device_queue_trans(_spi, &transaction, 0) != ESP_OK) {
+        return false;
+    }
+    
+    _transactionHead = (_transactionHead + 1) % DISPLAY_DMA_QUEUE_SIZE;
+    _inFlight++;
+    return true;
+}
+
+bool FrameBuffer::_queueCommand(uint8_t command, uint16_t first, uint16_t last, bool withData) {
+    if (!_queueTransaction(&command, 1, false)) {
+        return false;
+    }
+    if (!withData) {
+        return true;
+    }
+    
+    uint8_t data[4] = {
+        (uint8_t)(first >> 8), (uint8_t)(first & 0xFF),
+        (uint8_t)(last >> 8), (uint8_t)(last & 0xFF)
+    };
+    return _queueTransaction(data, sizeof(data), true);
+}
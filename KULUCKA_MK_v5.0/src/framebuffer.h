@@ -0,0 +1,112 @@
+/**
+ * @file framebuffer.h
+ * @brief PSRAM üzerinde RGB565 ekran tamponu ve kirli bölge DMA gönderimi
+ * @version 1.0
+ */
+
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <driver/spi_master.h>
+#include "config.h"
+
+// Panele gönderilecek dikdörtgen bölge
+struct DirtyRect {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+// Ekranın görünmeyen kopyası. Tüm çizimler önce bu tampona yapılır ve
+// değişen pikseller satır başına [minX, maxX] aralığı olarak işaretlenir.
+// flush() çağrıldığında aralıklar dikdörtgenlere birleştirilir ve yalnızca
+// bu bölgeler SPI DMA ile panele gönderilir. ESP32'de DMA PSRAM'i doğrudan
+// okuyamadığı için satırlar iki küçük dahili tampona kopyalanır; biri
+// gönderilirken diğeri doldurulur. Gönderim service() ile ana döngüden
+// ilerletilir, çizim kodu SPI'ı hiç beklemez.
+class FrameBuffer : public Adafruit_GFX {
+public:
+    // Yapılandırıcı
+    FrameBuffer();
+    ~FrameBuffer();
+    
+    // Tamponu PSRAM'de ayır (PSRAM yoksa false döner, dahili RAM kullanılmaz)
+    bool begin();
+    
+    // Panel SPI hattını DMA ile bağla (Arduino SPI serbest bırakılmış olmalı)
+    bool attachSpi(int8_t sclk, int8_t mosi, int8_t cs, int8_t dc, uint32_t frequency);
+    
+    // Tampon ve DMA hattı hazır mı?
+    bool isReady() const;
+    bool isInPsram() const;
+    
+    // Adafruit_GFX çizim temel işlemleri (doğrudan belleğe yazar)
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+    
+    // Hazır RGB565 bloğu tek geçişte kopyala (glif blok çizici için)
+    void writeRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels);
+    
+    // Bölgenin içeriğini dikey kaydır (dy > 0 aşağı); açılan satırlar eski kalır
+    void scrollRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dy);
+    
+    // Kirli bölgelerin gönderimini iste (beklemez)
+    void flush();
+    
+    // DMA kuyruğunu ilerlet (ana döngüden sık çağrılmalı)
+    void service();
+    
+    // Bekleyen her şey panele ulaşana kadar bekle (uzun gecikmelerden önce)
+    void flushBlocking();
+    
+    // Gönderim sürüyor mu?
+    bool isBusy() const;
+    
+    // Tüm ekranı yeniden gönderilecek olarak işaretle
+    void invalidate();
+    
+    // İstatistikler
+    uint32_t getFlushCount() const;
+    uint32_t getFlushedPixels() const;
+
+private:
+    uint16_t* _buffer;              // Panel bayt sırasında (büyük endian) RGB565
+    bool _inPsram;
+    
+    // Satır başına kirli aralık (maxX < 0 ise satır temiz)
+    int16_t _dirtyMinX[SCREEN_HEIGHT];
+    int16_t _dirtyMaxX[SCREEN_HEIGHT];
+    bool _flushRequested;
+    
+    // Gönderilmekte olan tur
+    DirtyRect _rects[DISPLAY_MAX_DIRTY_RECTS];
+    uint8_t _rectCount;
+    uint8_t _rectIndex;
+    bool _rectStarted;
+    int16_t _rectRow;
+    
+    // SPI DMA
+    spi_device_handle_t _spi;
+    spi_transaction_t _transactions[DISPLAY_DMA_QUEUE_SIZE];
+    uint8_t _transactionHead;
+    uint8_t _inFlight;
+    uint8_t* _chunks[2];
+    bool _chunkBusy[2];
+    
+    uint32_t _flushCount;
+    uint32_t _flushedPixels;
+    
+    void _markRow(int16_t y, int16_t x0, int16_t x1);
+    void _collectDirtyRects();
+    void _reapTransactions(TickType_t wait);
+    bool _queueTransaction(const void* data, size_t length, bool isData);
+    bool _queueCommand(uint8_t command, uint16_t first, uint16_t last, bool withData);
+};
+
+#endif // FRAMEBUFFER_H
@@ -0,0 +1,67 @@
+/**
+ * @file glyph_atlas.cpp
+ * @brief Önceden taranmış büyük rakam glifleri ve glif blok çizici uygulaması
+ * @version 1.0
+ */
+
+#include "glyph_atlas.h"
+
+const GlyphInfo* findGlyph(const GlyphAtlas& atlas, char c) {
+    uint8_t code = (uint8_t)c;
+    
+    // Tablo küçük ve sıralı: ikili arama
+    int low = 0;
+    int high = atlas.count - 1;
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        uint8_t midCode = atlas.glyphs[mid].code;
+        if (midCode == code) {
+            return &atlas.glyphs[mid];
+        }
+        if (midCode < code) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return nullptr;
+}
+
+int16_t measureGlyphText(const GlyphAtlas& atlas, const char* text) {
+    int16_t width = 0;
+    for (const char* p = text; *p; p++) {
+        const GlyphInfo* glyph = findGlyph(atlas, *p);
+        if (glyph) {
+            width += glyph->width;
+        }
+    }
+    return width;
+}
+
+void buildGlyphPalette(uint16_t foreground, uint16_t background, uint16_t palette[16]) {
+    // RGB565 kanallarını ayrı ayrı doğrusal karıştır
+    int16_t fr = (foreground >> 11) & 0x1F, br = (background >> 11) & 0x1F;
+    int16_t fg = (foreground >> 5) & 0x3F,  bg = (background >> 5) & 0x3F;
+    int16_t fb = foreground & 0x1F,         bb = background & 0x1F;
+    
+    for (uint8_t a = 0; a < 16; a++) {
+        uint16_t r = br + ((fr - br) * a + 7) / 15;
+        uint16_t g = bg + ((fg - bg) * a + 7) / 15;
+        uint16_t b = bb + ((fb - bb) * a + 7) / 15;
+        palette[a] = (r << 11) | (g << 5) | b;
+    }
+}
+
+void renderGlyph(const GlyphAtlas& atlas, const GlyphInfo& glyph,
+                 const uint16_t palette[16], uint16_t* out) {
+    const uint8_t* row = atlas.alpha + glyph.offset;
+    uint8_t rowBytes = (glyph.width + 1) / 2;
+    
+    for (uint8_t y = 0; y < GLYPH_LARGE_HEIGHT; y++) {
+        for (uint8_t x = 0; x < glyph.width; x++) {
+            uint8_t packed = pgm_read_byte(row + x / 2);
+            *out++ = palette[(x & 1) ? (packed & 0x0F) : (packed >> 4)];
+        }
+        row += rowBytes;
+    }
+}
@@ -0,0 +1,53 @@
+/**
+ * @file glyph_atlas.h
+ * @brief Önceden taranmış büyük rakam glifleri ve glif blok çizici
+ * @version 1.0
+ */
+
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <Arduino.h>
+
+// Büyük glif boyutları (scripts/pre_build.py ile aynı olmalı)
+#define GLYPH_LARGE_HEIGHT 16
+#define GLYPH_LARGE_MAX_WIDTH 12
+
+// Tek bir glifin atlas içindeki yeri
+struct GlyphInfo {
+    uint8_t code;       // Karakter kodu (GFX klasik kodlaması, 0xF7 = derece)
+    uint8_t width;      // Hücre genişliği (harf aralığı dahil)
+    uint16_t offset;    // Alfa verisindeki başlangıç (bayt)
+};
+
+// Derleme öncesinde üretilen atlas (glyph_atlas_data.cpp)
+struct GlyphAtlas {
+    const GlyphInfo* glyphs;   // Karakter koduna göre sıralı
+    uint8_t count;
+    const uint8_t* alpha;      // Piksel başına 4 bit kaplama, satırlar bayt hizalı
+};
+
+extern const GlyphAtlas GLYPH_ATLAS_LARGE;
+
+// Glif bloklarını hedefe tek pencerede yazan arayüz. Ekran tamponu bloğu
+// belleğe kopyalar; doğrudan panel yolunda blok tek SPI penceresiyle gider.
+class GlyphSink {
+public:
+    virtual ~GlyphSink() {}
+    virtual void blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels) = 0;
+};
+
+// Karakterin glifini bul (atlasta yoksa nullptr)
+const GlyphInfo* findGlyph(const GlyphAtlas& atlas, char c);
+
+// Metnin piksel genişliği (atlasta olmayan karakterler atlanır)
+int16_t measureGlyphText(const GlyphAtlas& atlas, const char* text);
+
+// Ön plan/arka plan arasında 16 kademeli karışım paleti
+void buildGlyphPalette(uint16_t foreground, uint16_t background, uint16_t palette[16]);
+
+// Glifi paletle RGB565 bloğa aç (out en az width * GLYPH_LARGE_HEIGHT piksel)
+void renderGlyph(const GlyphAtlas& atlas, const GlyphInfo& glyph,
+                 const uint16_t palette[16], uint16_t* out);
+
+#endif // GLYPH_ATLAS_H
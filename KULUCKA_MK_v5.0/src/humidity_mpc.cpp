@@ -0,0 +1,239 @@
+/**
+ * @file humidity_mpc.cpp
+ * @brief Öngörülü nem kontrol modülü uygulaması
+ * @version 1.0
+ */
+
+#include "humidity_mpc.h"
+
+HumidityMPC::HumidityMPC() {
+    _setpoint = 60.0;      // Varsayılan hedef değer (%60 nem)
+    _gain = HUMID_MODEL_GAIN;
+    _tau = HUMID_MODEL_TAU;
+    _delay = HUMID_MODEL_DELAY;
+    _modelValid = false;  // Varsayılan model yalnızca başlangıç tahminidir
+    reset();
+}
+
+bool HumidityMPC::begin() {
+    reset();
+    return true;
+}
+
+void HumidityMPC::setSetpoint(double setpoint) {
+    _setpoint = setpoint;
+}
+
+void HumidityMPC::compute(double input) {
+    unsigned long now = millis();
+    _input = input;
+    
+    if (!_initialized) {
+        _base = input;
+        _output = _actualOutput;
+        _lastSlotHumidity = input;
+        _slotStart = now;
+        _lastUpdate = now;
+        _outputChangeTime = now;
+        _initialized = true;
+    }
+    
+    // Mevcut adımda nemlendiricinin gerçekte açık kaldığı süreyi biriktir
+    _accumulate(now);
+    
+    // Uzun bir kesintiden sonra eski geçmiş anlamını yitirir
+    if (now - _slotStart >= (unsigned long)HUMID_MPC_STEP * HUMID_MPC_MAX_DELAY_STEPS) {
+        bool actualOutput = _actualOutput;
+        reset();
+        _actualOutput = actualOutput;
+        compute(input);
+        return;
+    }
+    
+    while (now - _slotStart >= HUMID_MPC_STEP) {
+        _closeSlot(input);
+    }
+    
+    // Minimum çevrim kısıtları: süre dolmadan röle durumu değişmez. Süre,
+    // rölenin gerçek son değişiminden sayılır (histerezis sürerken de).
+    unsigned long sinceChange = now - _outputChangeTime;
+    if (_actualOutput && sinceChange < HUMID_MIN_ON_TIME) {
+        _output = true;
+        return;
+    }
+    if (!_actualOutput && sinceChange < HUMID_MIN_OFF_TIME) {
+        _output = false;
+        return;
+    }
+    
+    _output = _plan() > 0;
+}
+
+bool HumidityMPC::getOutput() const {
+    return _output;
+}
+
+void HumidityMPC::setActualOutput(bool state) {
+    if (state == _actualOutput) {
+        return;
+    }
+    
+    unsigned long now = millis();
+    if (_initialized) {
+        // Değişime kadar geçen süre eski duruma yazılır
+        _accumulate(now);
+    }
+    _actualOutput = state;
+    _outputChangeTime = now;
+}
+
+double HumidityMPC::getSetpoint() const {
+    return _setpoint;
+}
+
+bool HumidityMPC::setModel(double gain, unsigned long tau, unsigned long delay) {
+    if (gain <= 0.0 || gain > 100.0 || tau < HUMID_MPC_STEP ||
+        delay >= (unsigned long)HUMID_MPC_STEP * HUMID_MPC_MAX_DELAY_STEPS) {
+        Serial.println("Nem MPC: Geçersiz model parametreleri!");
+        return false;
+    }
+    
+    _gain = gain;
+    _tau = tau;
+    _delay = delay;
+    _modelValid = true;
+    return true;
+}
+
+bool HumidityMPC::hasModel() const {
+    return _modelValid;
+}
+
+double HumidityMPC::getModelGain() const {
+    return _gain;
+}
+
+unsigned long HumidityMPC::getModelTau() const {
+    return _tau;
+}
+
+unsigned long HumidityMPC::getModelDelay() const {
+    return _delay;
+}
+
+double HumidityMPC::getBaseHumidity() const {
+    return _base;
+}
+
+unsigned long HumidityMPC::getPlannedOnTime() const {
+    return _plannedOnTime;
+}
+
+double HumidityMPC::getPredictedHumidity() const {
+    return _predictedHumidity;
+}
+
+void HumidityMPC::reset() {
+    _input = 0.0;
+    _output = false;
+    _actualOutput = false;
+    _initialized = false;
+    _outputChangeTime = 0;
+    _base = 0.0;
+    _historyHead = 0;
+    _slotStart = 0;
+    _slotOnTime = 0;
+    _lastUpdate = 0;
+    _lastSlotHumidity = 0.0;
+    _plannedOnTime = 0;
+    _predictedHumidity = 0.0;
+    
+    for (uint8_t i = 0; i < HUMID_MPC_MAX_DELAY_STEPS; i++) {
+        _history[i] = 0.0;
+    }
+}
+
+void HumidityMPC::_accumulate(unsigned long now) {
+    if (_actualOutput) {
+        _slotOnTime += now - _lastUpdate;
+    }
+    _lastUpdate = now;
+}
+
+void HumidityMPC::_closeSlot(double input) {
+    float duty = min(1.0f, (float)_slotOnTime / HUMID_MPC_STEP);
+    _historyHead = (_historyHead + 1) % HUMID_MPC_MAX_DELAY_STEPS;
+    _history[_historyHead] = duty;
+    _slotOnTime = 0;
+    _slotStart += HUMID_MPC_STEP;
+    
+    // Bir adımlık model tahminini ölçümle karşılaştır ve kapalı durum denge
+    // nemini düzelt (buharlaşma, havalandırma gibi ölçülmeyen etkiler)
+    double a = exp(-(double)HUMID_MPC_STEP / _tau);
+    double u = _historyAt(_delaySteps());
+    double predicted = a * _lastSlotHumidity + (1.0 - a) * (_base + _gain * u);
+    double innovation = input - predicted;
+    _base = constrain(_base + HUMID_MPC_BASE_GAIN * innovation / (1.0 - a), 0.0, 100.0);
+    _lastSlotHumidity = input;
+}
+
+float HumidityMPC::_historyAt(uint8_t stepsAgo) const {
+    if (stepsAgo >= HUMID_MPC_MAX_DELAY_STEPS) {
+        return 0.0;
+    }
+    uint8_t index = (_historyHead + HUMID_MPC_MAX_DELAY_STEPS - stepsAgo) % HUMID_MPC_MAX_DELAY_STEPS;
+    return _history[index];
+}
+
+uint8_t HumidityMPC::_delaySteps() const {
+    return (_delay + HUMID_MPC_STEP / 2) / HUMID_MPC_STEP;
+}
+
+uint8_t HumidityMPC::_plan() {
+    const uint8_t horizon = HUMID_MPC_HORIZON / HUMID_MPC_STEP;
+    const uint8_t delay = min(_delaySteps(), (uint8_t)(horizon - 1));
+    const uint8_t minOnSteps = (HUMID_MIN_ON_TIME + HUMID_MPC_STEP - 1) / HUMID_MPC_STEP;
+    const double a = exp(-(double)HUMID_MPC_STEP / _tau);
+    
+    double bestCost = 1e30;
+    uint8_t bestOnSteps = 0;
+    double bestPrediction = _input;
+    
+    // Aday: şimdi onSteps adım açık, sonra kapalı. Ölü zaman sonrasında
+    // etkisi görülemeyecek adaylar denenmez.
+    for (uint8_t onSteps = 0; onSteps <= horizon - delay; onSteps++) {
+        // Kapalıdan açılan adaylar minimum açık kalma süresini sağlamalı
+        if (!_actualOutput && onSteps > 0 && onSteps < minOnSteps) {
+            continue;
+        }
+        
+        double humidity = _input;
+        double cost = 0.0;
+        
+        for (uint8_t step = 0; step < horizon; step++) {
+            // Bu adımı etkileyen giriş, ölü zaman kadar önceki giriştir
+            double u;
+            if (step < delay) {
+                u = _historyAt(delay - step - 1);
+            } else {
+                u = (step - delay < onSteps) ? 1.0 : 0.0;
+            }
+            
+            humidity = a * humidity + (1.0 - a) * (_base + _gain * u);
+            double error = humidity - _setpoint;
+            cost += error * error;
+        }
+        
+        cost += HUMID_MPC_ENERGY_WEIGHT * onSteps;
+        
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestOnSteps = onSteps;
+            bestPrediction = humidity;
+        }
+    }
+    
+    _plannedOnTime = (unsigned long)bestOnSteps * HUMID_MPC_STEP;
+    _predictedHumidity = bestPrediction;
+    return bestOnSteps;
+}
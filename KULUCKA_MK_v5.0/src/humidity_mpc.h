@@ -0,0 +1,104 @@
+/**
+ * @file humidity_mpc.h
+ * @brief Birinci derece + ölü zaman modeline dayalı öngörülü nem kontrol modülü
+ * @version 1.0
+ */
+
+#ifndef HUMIDITY_MPC_H
+#define HUMIDITY_MPC_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Nemlendirici için kısa ufuklu öngörülü kontrolcü.
+// Nem, nemlendirici girişine birinci derece + ölü zaman (FOPDT) modeliyle
+// yanıt verdiği varsayılır. Her hesaplamada "şimdi N adım açık, sonra kapalı"
+// adaylarının ufuk boyunca oluşturacağı nem tahmin edilir ve hedeften sapma
+// ile açık kalma süresini en aza indiren aday seçilir. Minimum açık/kapalı
+// kalma süreleri röle ömrü ve su tasarrufu için zorunludur.
+class HumidityMPC {
+public:
+    // Yapılandırıcı
+    HumidityMPC();
+    
+    // Kontrolcüyü başlat
+    bool begin();
+    
+    // Hedef değeri ayarla
+    void setSetpoint(double setpoint);
+    
+    // Mevcut nem değeri ile planı güncelle
+    void compute(double input);
+    
+    // Çıkış durumunu al
+    bool getOutput() const;
+    
+    // Nemlendirici rölesinin gerçek durumunu bildir (her döngüde). Geçmiş,
+    // adım doluluk oranı, denge nemi düzeltmesi ve minimum açık/kapalı
+    // süreleri plana göre değil, bu duruma göre işler; böylece histerezis
+    // sürerken de model doğru kalır ve öngörülü moda geçişte röle süreleri korunur.
+    void setActualOutput(bool state);
+    
+    // Hedef değeri al
+    double getSetpoint() const;
+    
+    // Model parametrelerini ayarla (kazanç %RH, süreler ms)
+    bool setModel(double gain, unsigned long tau, unsigned long delay);
+    
+    // Tanımlanmış (varsayılan olmayan) bir model yüklendi mi?
+    bool hasModel() const;
+    
+    // Model parametrelerini al
+    double getModelGain() const;
+    unsigned long getModelTau() const;
+    unsigned long getModelDelay() const;
+    
+    // Nemlendirici kapalıyken beklenen denge nemi tahmini
+    double getBaseHumidity() const;
+    
+    // Seçilen plan: şu andan itibaren açık kalma süresi (ms)
+    unsigned long getPlannedOnTime() const;
+    
+    // Seçilen plan ile ufuk sonunda beklenen nem
+    double getPredictedHumidity() const;
+    
+    // Geçmişi ve tahminleri sıfırla
+    void reset();
+
+private:
+    // Kontrol değişkenleri
+    double _setpoint;
+    double _input;
+    bool _output;
+    bool _actualOutput;
+    bool _initialized;
+    unsigned long _outputChangeTime;
+    
+    // Model parametreleri
+    double _gain;
+    unsigned long _tau;
+    unsigned long _delay;
+    bool _modelValid;
+    double _base;
+    
+    // Adım bazında nemlendirici doluluk oranı geçmişi (0-1)
+    float _history[HUMID_MPC_MAX_DELAY_STEPS];
+    uint8_t _historyHead;
+    unsigned long _slotStart;
+    unsigned long _slotOnTime;
+    unsigned long _lastUpdate;
+    double _lastSlotHumidity;
+    
+    // Son planın sonuçları
+    unsigned long _plannedOnTime;
+    double _predictedHumidity;
+    
+    // Yardımcı fonksiyonlar
+    void _accumulate(unsigned long now);
+    void _closeSlot(double input);
+    float _historyAt(uint8_t stepsAgo) const;
+    uint8_t _delaySteps() const;
+    uint8_t _plan();
+};
+
+#endif // HUMIDITY_MPC_H
@@ -6,17 +6,29 @@
 
 #include "joystick.h"
 
+// Serbest akan uint8_t indekslerin taşmada doğru kalması için
+static_assert((JOYSTICK_EVENT_QUEUE_SIZE & (JOYSTICK_EVENT_QUEUE_SIZE - 1)) == 0 &&
+              JOYSTICK_EVENT_QUEUE_SIZE <= 128,
+              "JOYSTICK_EVENT_QUEUE_SIZE 2'nin kuvveti ve 128'den küçük olmalı");
+
 Joystick::Joystick() {
-    _xPosition = 0;
-    _yPosition = 0;
-    _buttonState = HIGH;
-    _lastButtonState = HIGH;
-    _lastDebounceTime = 0;
-    _lastActionTime = 0;
-    _lastDirection = JOYSTICK_NONE;
-    _currentDirection = JOYSTICK_NONE;
     _xCenter = 2048; // 12-bit ADC orta değeri
     _yCenter = 2048; // 12-bit ADC orta değeri
+    _heldDirection = JOYSTICK_NONE;
+    _candidateDirection = JOYSTICK_NONE;
+    _candidateSamples = 0;
+    _nextRepeatTime = 0;
+    _repeatCount = 0;
+    _buttonEdge.store(0);
+    _buttonHeld = false;
+    _buttonChangeTime = 0;
+    _buttonPressTime = 0;
+    _longPressSent = false;
+    _lastActionTime = 0;
+    _queueHead.store(0);
+    _queueTail.store(0);
+    _droppedEvents = 0;
+    _sampleTimer = nullptr;
 }
 
 bool Joystick::begin() {
@@ -30,6 +42,30 @@ bool Joystick::begin() {
     // Joystick kalibrasyonu
     _calibrateJoystick();
     
+    // Buton kenarlarını kesme ile yakala (basışlar örnekler arasında kaybolmasın)
+    attachInterruptArg(digitalPinToInterrupt(JOY_BTN), _buttonIsr, this, CHANGE);
+    
+    // Eksenleri arka planda sabit periyotla örnekle
+    esp_timer_create_args_t timerArgs = {};
+    timerArgs.callback = &Joystick::_sampleCallback;
+    timerArgs.arg = this;
+    timerArgs.dispatch_method = ESP_TIMER_TASK;
+    timerArgs.name = "joystick";
+    
+    if (esp_timer_create(&timerArgs, &_sampleTimer) != ESP_OK) {
+        Serial.println("Joystick örnekleme zamanlayıcısı oluşturulamadı!");
+        detachInterrupt(digitalPinToInterrupt(JOY_BTN));
+        return false;
+    }
+    
+    if (esp_timer_start_periodic(_sampleTimer, JOYSTICK_SAMPLE_INTERVAL_MS * 1000ULL) != ESP_OK) {
+        Serial.println("Joystick örnekleme zamanlayıcısı başlatılamadı!");
+        esp_timer_delete(_sampleTimer);
+        _sampleTimer = nullptr;
+        detachInterrupt(digitalPinToInterrupt(JOY_BTN));
+        return false;
+    }
+    
     return true;
 }
 
@@ -54,101 +90,162 @@ void Joystick::_calibrateJoystick() {
     Serial.println(_yCenter);
 }
 
-JoystickDirection Joystick::readDirection() {
-    JoystickDirection currentDir = _currentDirection;
-    
-    // Yönü okuduktan sonra sıfırla ki bir sonraki çağrıda eski değeri okumayalım
-    if (currentDir != JOYSTICK_NONE) {
-        _currentDirection = JOYSTICK_NONE;
-    }
-    
-    return currentDir;
+void IRAM_ATTR Joystick::_buttonIsr(void* arg) {
+    // ISR içinde yalnızca kenarı zaman damgasıyla işaretle, kararı örnekleme görevi verir.
+    // Bekleyen kenar varsa ilki korunur (0 -> zaman karşılaştır-ve-yaz).
+    Joystick* self = static_cast<Joystick*>(arg);
+    uint32_t expected = 0;
+    self->_buttonEdge.compare_exchange_strong(expected, (uint32_t)esp_timer_get_time() | 1U);
 }
 
-bool Joystick::isButtonPressed() {
-    return (_buttonState == LOW); // Buton aktif düşük (LOW)
+void Joystick::_sampleCallback(void* arg) {
+    static_cast<Joystick*>(arg)->_sample();
 }
 
-bool Joystick::wasButtonPressed() {
-    // Buton yeni mi basıldı?
-    bool result = (_buttonState == LOW) && (_lastButtonState == HIGH);
-    return result;
+void Joystick::_sample() {
+    uint32_t now = (uint32_t)esp_timer_get_time();
+    _sampleButton(now);
+    _sampleAxes(now);
 }
 
-void Joystick::update() {
-    // Joystick değerlerini oku
-    _xPosition = analogRead(JOY_X);
-    _yPosition = analogRead(JOY_Y);
-    
-    // Mevcut zaman
-    unsigned long currentTime = millis();
-    
-    // Buton durumunu oku
-    bool reading = digitalRead(JOY_BTN);
-    
-    // Buton debounce işlemi
-    if (reading != _lastButtonState) {
-        _lastDebounceTime = currentTime;
+void Joystick::_sampleButton(uint32_t now) {
+    const uint32_t debounceUs = JOYSTICK_DEBOUNCE_MS * 1000UL;
+    
+    // Kenar, pin okunmadan önce okunup aynı anda temizlenir; bu örnekten
+    // sonra gelen kenar bir sonraki örneğe kalır, kaybolmaz
+    uint32_t edge = _buttonEdge.exchange(0);
+    bool pressed = (digitalRead(JOY_BTN) == LOW); // Buton aktif düşük (LOW)
+    
+    if (!_buttonHeld) {
+        // Ön kenar debounce: ilk düşen kenarda basışı başlat, sonra sıçramaları yok say.
+        // PRESS hemen gönderilmez; basışın kısa mı uzun mu olduğu bırakınca belli olur.
+        if (pressed && now - _buttonChangeTime >= debounceUs) {
+            _buttonHeld = true;
+            _buttonChangeTime = now;
+            _buttonPressTime = (edge != 0) ? edge : now;
+            _longPressSent = false;
+            _lastActionTime = millis(); // Ekran basışta uyansın
+        }
+    } else if (pressed) {
+        _buttonChangeTime = now;
+        
+        if (!_longPressSent && now - _buttonPressTime >= JOYSTICK_LONG_PRESS_MS * 1000UL) {
+            _longPressSent = true;
+            _pushEvent(JOYSTICK_PRESS, JOYSTICK_EVENT_LONG_PRESS, 0, now);
+        }
+    } else if (now - _buttonChangeTime >= debounceUs) {
+        // Bırakma, buton debounce süresi boyunca yüksek kaldıysa kabul edilir.
+        // Uzun basma eşiğine ulaşmayan basış ancak şimdi kısa basış (PRESS) olur;
+        // uzun basmada yalnızca LONG_PRESS işlenir.
+        _buttonHeld = false;
+        _buttonChangeTime = now;
+        if (!_longPressSent) {
+            _pushEvent(JOYSTICK_PRESS, JOYSTICK_EVENT_PRESS, 0, now);
+        }
+        _pushEvent(JOYSTICK_PRESS, JOYSTICK_EVENT_RELEASE, 0, now);
     }
-    
-    if ((currentTime - _lastDebounceTime) > _debounceDelay) {
-        if (reading != _buttonState) {
-            _buttonState = reading;
-            
-            if (_buttonState == LOW) {
-                // Buton basıldı
-                _currentDirection = JOYSTICK_PRESS;
-                _lastActionTime = currentTime;
-                return; // Buton basıldığında hemen çık
-            }
+}
+
+JoystickDirection Joystick::_directionFromAxes(int x, int y) const {
+    // X ekseni önceliklidir (eski davranışla aynı)
+    if (x < _xCenter - _deadZone) return JOYSTICK_LEFT;
+    if (x > _xCenter + _deadZone) return JOYSTICK_RIGHT;
+    if (y < _yCenter - _deadZone) return JOYSTICK_UP;
+    if (y > _yCenter + _deadZone) return JOYSTICK_DOWN;
+    return JOYSTICK_NONE;
+}
+
+void Joystick::_sampleAxes(uint32_t now) {
+    int x = analogRead(JOY_X);
+    int y = analogRead(JOY_Y);
+    
+    if (_heldDirection != JOYSTICK_NONE) {
+        // Histerezis: yön ancak merkeze yeterince yaklaşınca bırakılmış sayılır
+        if (abs(x - _xCenter) < _releaseZone && abs(y - _yCenter) < _releaseZone) {
+            _pushEvent(_heldDirection, JOYSTICK_EVENT_RELEASE, _repeatCount, now);
+            _heldDirection = JOYSTICK_NONE;
+            _candidateDirection = JOYSTICK_NONE;
+            _candidateSamples = 0;
+            return;
         }
+        
+        // Yalnızca dikey yönler otomatik tekrarlanır (sağ/sol menüye giriş/çıkış yapar)
+        bool repeatable = (_heldDirection == JOYSTICK_UP || _heldDirection == JOYSTICK_DOWN);
+        if (repeatable && (int32_t)(now - _nextRepeatTime) >= 0) {
+            _repeatCount++;
+            _nextRepeatTime = now + JOYSTICK_REPEAT_INTERVAL_MS * 1000UL;
+            _pushEvent(_heldDirection, JOYSTICK_EVENT_REPEAT, _repeatCount, now);
+        }
+        return;
     }
     
-    _lastButtonState = reading;
+    // Ölü bölge dışındaki yön art arda birkaç örnekte görülmeli (ADC gürültüsü için)
+    JoystickDirection direction = _directionFromAxes(x, y);
+    if (direction != _candidateDirection) {
+        _candidateDirection = direction;
+        _candidateSamples = 0;
+    }
     
-    // Daha önce bir yön algılanmışsa ve son işlemden yeterince zaman geçmemişse çık
-    if (_currentDirection != JOYSTICK_NONE) {
+    if (direction == JOYSTICK_NONE) {
         return;
     }
     
-    // Anti-bounce: Son hareketin üzerinden yeterli süre geçmemişse çık (500ms'ye artırıldı)
-    if (currentTime - _lastActionTime < 500) {
-        return;
+    if (++_candidateSamples >= JOYSTICK_AXIS_DEBOUNCE_SAMPLES) {
+        _heldDirection = direction;
+        _repeatCount = 0;
+        _nextRepeatTime = now + JOYSTICK_REPEAT_DELAY_MS * 1000UL;
+        _pushEvent(direction, JOYSTICK_EVENT_PRESS, 0, now);
     }
+}
+
+void Joystick::_pushEvent(JoystickDirection direction, JoystickEventType type, 
+                          uint16_t repeatCount, uint32_t timestamp) {
+    uint8_t tail = _queueTail.load(std::memory_order_relaxed);
+    uint8_t head = _queueHead.load(std::memory_order_acquire);
     
-    // Yön belirleme
-    JoystickDirection newDirection = JOYSTICK_NONE;
+    if ((uint8_t)(tail - head) >= JOYSTICK_EVENT_QUEUE_SIZE) {
+        _droppedEvents++;
+        return;
+    }
     
-    // Ölü bölge eşiği - daha yüksek
-    const int deadZoneThreshold = 1800;
+    JoystickEvent& slot = _queue[tail & (JOYSTICK_EVENT_QUEUE_SIZE - 1)];
+    slot.direction = direction;
+    slot.type = type;
+    slot.repeatCount = repeatCount;
+    slot.timestamp = timestamp;
     
-    // X ekseni - merkeze göre oldukça farklıysa
-    if (_xPosition < (_xCenter - deadZoneThreshold)) {
-        newDirection = JOYSTICK_LEFT;
-    } else if (_xPosition > (_xCenter + deadZoneThreshold)) {
-        newDirection = JOYSTICK_RIGHT;
-    }
-    // Y ekseni - merkeze göre oldukça farklıysa (ve X hareket yok ise)
-    else if (_yPosition < (_yCenter - deadZoneThreshold)) {
-        newDirection = JOYSTICK_UP;
-    } else if (_yPosition > (_yCenter + deadZoneThreshold)) {
-        newDirection = JOYSTICK_DOWN;
+    if (type != JOYSTICK_EVENT_RELEASE) {
+        _lastActionTime = millis();
     }
     
-    // Eğer yeni bir yön algılandıysa
-    if (newDirection != JOYSTICK_NONE) {
-        _currentDirection = newDirection;
-        _lastDirection = newDirection;
-        _lastActionTime = currentTime;
-    } else {
-        // Eğer joystick merkeze dönmüşse _lastDirection'ı sıfırla
-        if (abs(_xPosition - _xCenter) < (deadZoneThreshold / 2) && 
-            abs(_yPosition - _yCenter) < (deadZoneThreshold / 2)) {
-            _lastDirection = JOYSTICK_NONE;
-        }
+    _queueTail.store((uint8_t)(tail + 1), std::memory_order_release);
+}
+
+bool Joystick::pollEvent(JoystickEvent& event) {
+    uint8_t head = _queueHead.load(std::memory_order_relaxed);
+    uint8_t tail = _queueTail.load(std::memory_order_acquire);
+    
+    if (head == tail) {
+        return false;
     }
+    
+    event = _queue[head & (JOYSTICK_EVENT_QUEUE_SIZE - 1)];
+    _queueHead.store((uint8_t)(head + 1), std::memory_order_release);
+    return true;
+}
+
+bool Joystick::hasEvent() const {
+    return _queueHead.load(std::memory_order_relaxed) != _queueTail.load(std::memory_order_acquire);
+}
+
+bool Joystick::isButtonPressed() {
+    return _buttonHeld;
 }
 
 unsigned long Joystick::getLastActionTime() {
     return _lastActionTime;
-}
\ No newline at end of file
+}
+
+uint32_t Joystick::getDroppedEvents() const {
+    return _droppedEvents;
+}
@@ -8,6 +8,8 @@
 #define JOYSTICK_H
 
 #include <Arduino.h>
+#include <atomic>
+#include <esp_timer.h>
 #include "config.h"
 
 // Joystick yönleri
@@ -20,60 +22,95 @@ enum JoystickDirection {
     JOYSTICK_PRESS
 };
 
+// Joystick olay tipleri
+enum JoystickEventType {
+    JOYSTICK_EVENT_PRESS,       // Yön ilk algılandı / buton uzun basma eşiğinden önce bırakıldı
+    JOYSTICK_EVENT_REPEAT,      // Basılı tutulurken otomatik tekrar
+    JOYSTICK_EVENT_LONG_PRESS,  // Buton uzun basıldı
+    JOYSTICK_EVENT_RELEASE      // Yön/buton bırakıldı
+};
+
+// Zaman damgalı joystick olayı
+struct JoystickEvent {
+    JoystickDirection direction;
+    JoystickEventType type;
+    uint16_t repeatCount;       // Aynı basışta kaçıncı tekrar (PRESS için 0)
+    uint32_t timestamp;         // Olayın algılandığı an (micros)
+};
+
 class Joystick {
 public:
     // Yapılandırıcı
     Joystick();
     
-    // Joystick modülünü başlat
+    // Joystick modülünü başlat (kesme ve örnekleme zamanlayıcısını kurar)
     bool begin();
     
-    // Joystick yönünü oku
-    JoystickDirection readDirection();
+    // Kuyruktan sıradaki olayı al, kuyruk boşsa false döner
+    bool pollEvent(JoystickEvent& event);
     
-    // Buton durumunu oku
-    bool isButtonPressed();
+    // Kuyrukta bekleyen olay var mı?
+    bool hasEvent() const;
     
-    // Buton değişikliğini oku (yalnızca bir kez bastırma algılar)
-    bool wasButtonPressed();
-    
-    // Joystick durumlarını güncelle (her döngüde çağrılmalı)
-    void update();
+    // Buton durumunu oku (debounce edilmiş)
+    bool isButtonPressed();
     
     // Son basılma zamanını al
     unsigned long getLastActionTime();
+    
+    // Kuyruk dolu olduğu için kaybedilen olay sayısı
+    uint32_t getDroppedEvents() const;
 
 private:
-    // Joystick pozisyonları
-    int _xPosition;
-    int _yPosition;
-    bool _buttonState;
-    bool _lastButtonState;
-    
-    // Yön eşik değerleri
-    const int _threshold = 1000; // 0-4095 aralığında, 1000 değeri temsili
-    
-    // Yön değişim zamanları
-    unsigned long _lastDebounceTime;
-    unsigned long _lastActionTime;
-    unsigned long _lastJoystickRead; // Okumalar arasında minimum süre için
-    
-    // Debounce süresi (ms)
-    const unsigned long _debounceDelay = 50;
+    // Yön eşik değerleri (0-4095 aralığında)
+    const int _deadZone = JOYSTICK_DEADZONE;
+    const int _releaseZone = JOYSTICK_RELEASE_ZONE;
     
     // Joystick kalibrasyonu
     int _xCenter;
     int _yCenter;
     
+    // Eksen durum makinesi (yalnızca örnekleme görevi yazar)
+    JoystickDirection _heldDirection;
+    JoystickDirection _candidateDirection;
+    uint8_t _candidateSamples;
+    uint32_t _nextRepeatTime;
+    uint16_t _repeatCount;
+    
+    // Buton durum makinesi
+    std::atomic<uint32_t> _buttonEdge;   // ISR'daki kenar zamanı | 1 (micros), 0: kenar yok
+    volatile bool _buttonHeld;
+    uint32_t _buttonChangeTime;
+    uint32_t _buttonPressTime;
+    bool _longPressSent;
+    
+    volatile unsigned long _lastActionTime;
+    
+    // Tek üretici / tek tüketici kilitsiz olay kuyruğu
+    JoystickEvent _queue[JOYSTICK_EVENT_QUEUE_SIZE];
+    std::atomic<uint8_t> _queueHead;     // Tüketici (loop) ilerletir
+    std::atomic<uint8_t> _queueTail;     // Üretici (örnekleme görevi) ilerletir
+    volatile uint32_t _droppedEvents;
+    
+    esp_timer_handle_t _sampleTimer;
+    
     // Kalibrasyonu oku
     void _calibrateJoystick();
     
-    // Yön değişimi için debounce işlemi
-    bool _debounceDirection(JoystickDirection newDirection);
+    // Periyodik örnekleme (esp_timer görevi bağlamında çalışır)
+    void _sample();
+    void _sampleAxes(uint32_t now);
+    void _sampleButton(uint32_t now);
+    
+    // Ham eksen değerlerinden yön belirle
+    JoystickDirection _directionFromAxes(int x, int y) const;
+    
+    // Olayı kuyruğa ekle
+    void _pushEvent(JoystickDirection direction, JoystickEventType type, 
+                    uint16_t repeatCount, uint32_t timestamp);
     
-    // Son yön
-    JoystickDirection _lastDirection;
-    JoystickDirection _currentDirection;
+    static void _sampleCallback(void* arg);
+    static void IRAM_ATTR _buttonIsr(void* arg);
 };
 
-#endif // JOYSTICK_H
\ No newline at end of file
+#endif // JOYSTICK_H
@@ -0,0 +1,159 @@
+/**
+ * @file json_writer.cpp
+ * @brief Heap kullanmayan JSON serileştirici uygulaması
+ * @version 1.0
+ */
+
+#include "json_writer.h"
+
+JsonWriter::JsonWriter(char* buffer, size_t size) {
+    _buffer = buffer;
+    _size = size;
+    _length = 0;
+    _overflow = (buffer == nullptr || size == 0);
+    _needComma = false;
+    
+    if (!_overflow) {
+        _buffer[0] = '\0';
+    }
+}
+
+void JsonWriter::beginObject() {
+    if (_needComma) {
+        _append(',');
+    }
+    _append('{');
+    _needComma = false;
+}
+
+void JsonWriter::beginObject(const char* key) {
+    _key(key);
+    _append('{');
+    _needComma = false;
+}
+
+void JsonWriter::endObject() {
+    _append('}');
+    _needComma = true;
+}
+
+void JsonWriter::addString(const char* key, const char* value) {
+    _key(key);
+    _append('"');
+    _appendEscaped(value);
+    _append('"');
+    _needComma = true;
+}
+
+void JsonWriter::addInt(const char* key, long value) {
+    char text[12];
+    snprintf(text, sizeof(text), "%ld", value);
+    _key(key);
+    _append(text);
+    _needComma = true;
+}
+
+void JsonWriter::addUInt(const char* key, unsigned long value) {
+    char text[12];
+    snprintf(text, sizeof(text), "%lu", value);
+    _key(key);
+    _append(text);
+    _needComma = true;
+}
+
+void JsonWriter::addFloat(const char* key, double value, uint8_t decimals) {
+    _key(key);
+    _needComma = true;
+    
+    // JSON'da NaN/Inf yoktur
+    if (isnan(value) || isinf(value)) {
+        _append("null");
+        return;
+    }
+    
+    char text[24];
+    snprintf(text, sizeof(text), "%.*f", decimals, value);
+    
+    // Gereksiz sondaki sıfırları ve noktayı kaldır (37.500 -> 37.5)
+    char* dot = strchr(text, '.');
+    if (dot != nullptr) {
+        char* end = text + strlen(text) - 1;
+        while (end > dot && *end == '0') {
+            *end-- = '\0';
+        }
+        if (end == dot) {
+            *end = '\0';
+        }
+    }
+    _append(text);
+}
+
+void JsonWriter::addBool(const char* key, bool value) {
+    _key(key);
+    _append(value ? "true" : "false");
+    _needComma = true;
+}
+
+size_t JsonWriter::length() const {
+    return _overflow ? 0 : _length;
+}
+
+bool JsonWriter::overflowed() const {
+    return _overflow;
+}
+
+void JsonWriter::_key(const char* key) {
+    if (_needComma) {
+        _append(',');
+    }
+    _append('"');
+    _appendEscaped(key);
+    _append("\":");
+}
+
+void JsonWriter::_append(const char* text) {
+    while (*text != '\0') {
+        _append(*text++);
+    }
+}
+
+void JsonWriter::_append(char c) {
+    if (_overflow) {
+        return;
+    }
+    
+    // Sonlandırıcı için her zaman bir bayt ayrılır
+    if (_length + 1 >= _size) {
+        _overflow = true;
+        return;
+    }
+    
+    _buffer[_length++] = c;
+    _buffer[_length] = '\0';
+}
+
+void JsonWriter::_appendEscaped(const char* text) {
+    if (text == nullptr) {
+        return;
+    }
+    
+    for (; *text != '\0'; text++) {
+        char c = *text;
+        switch (c) {
+            case '"':  _append("\\\""); break;
+            case '\\': _append("\\\\"); break;
+            case '\n': _append("\\n"); break;
+            case '\r': _append("\\r"); break;
+            case '\t': _append("\\t"); break;
+            default:
+                if ((uint8_t)c < 0x20) {
+                    char escaped[7];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    _append(escaped);
+                } else {
+                    _append(c);
+                }
+                break;
+        }
+    }
+}
@@ -0,0 +1,49 @@
+/**
+ * @file json_writer.h
+ * @brief Sabit bir buffer'a heap kullanmadan JSON yazan hafif serileştirici
+ * @version 1.0
+ */
+
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <Arduino.h>
+
+// Sık sorgulanan uç noktalar için doğrudan buffer'a yazan JSON üretici.
+// JsonDocument ve String kullanmaz; buffer yetmezse taşma işaretlenir ve
+// çağıran taraf yedek yola geçebilir.
+class JsonWriter {
+public:
+    // Yapılandırıcı (buffer çağırana aittir)
+    JsonWriter(char* buffer, size_t size);
+    
+    // Nesne başlat/bitir (anahtarlı sürüm iç içe nesne açar)
+    void beginObject();
+    void beginObject(const char* key);
+    void endObject();
+    
+    // Alan ekleme fonksiyonları
+    void addString(const char* key, const char* value);
+    void addInt(const char* key, long value);
+    void addUInt(const char* key, unsigned long value);
+    void addFloat(const char* key, double value, uint8_t decimals = 3);
+    void addBool(const char* key, bool value);
+    
+    // Yazılan uzunluk ve taşma durumu
+    size_t length() const;
+    bool overflowed() const;
+
+private:
+    char* _buffer;
+    size_t _size;
+    size_t _length;
+    bool _overflow;
+    bool _needComma;
+    
+    void _key(const char* key);
+    void _append(const char* text);
+    void _append(char c);
+    void _appendEscaped(const char* text);
+};
+
+#endif // JSON_WRITER_H
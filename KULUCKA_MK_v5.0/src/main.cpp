@@ -7,6 +7,7 @@
 #include <Arduino.h>
 #include "config.h"
 #include "display.h"
+#include "display_power.h"
 #include "sensors.h"
 #include "rtc.h"
 #include "joystick.h"
@@ -14,6 +15,10 @@
 #include "incubation.h"
 #include "pid.h"
 #include "hysteresis.h"
+#include "humidity_mpc.h"
+#include "plant_identifier.h"
+#include "perf_monitor.h"
+#include "sensor_history.h"
 #include "menu.h"
 #include "storage.h"
 #include "wifi_manager.h"
@@ -26,6 +31,7 @@
 
 // Modül nesneleri
 Display display;
+DisplayPower displayPower;
 Sensors sensors;
 RTCModule rtc;
 Joystick joystick;
@@ -33,6 +39,11 @@ Relays relays;
 Incubation incubation;
 PIDController pidController;
 Hysteresis hysteresisController;
+HumidityMPC humidityMPC;
+PlantIdentifier heaterIdentifier;
+PlantIdentifier humidIdentifier;
+PerfMonitor perfMonitor;
+SensorHistory sensorHistory;
 MenuManager menuManager;
 Storage storage;
 WiFiManager wifiManager;
@@ -43,17 +54,14 @@ OTAManager otaManager;
 // Zaman kontrolü değişkenleri
 unsigned long lastSensorReadTime = 0;
 unsigned long lastDisplayUpdateTime = 0;
-unsigned long lastJoystickReadTime = 0;
 unsigned long lastMenuTimeout = 0;
 unsigned long lastStorageCheckTime = 0;
 
 // Menü zaman aşımı (ms) - 30 saniye
 const unsigned long MENU_TIMEOUT_MS = 30000;
 
-// Joystick durum kontrolü için
-bool joystickNeedsReset = false;
-unsigned long joystickResetTime = 0;
-const unsigned long JOYSTICK_RESET_DELAY = 300; // 300ms bekleme
+// Değer ayarlama ekranı: kuyruk boşaltılınca tek seferde çizilecek değer var mı?
+bool valueAdjustRedrawPending = false;
 
 // Motor test için global değişkenler
 bool motorTestActive = false;
@@ -62,10 +70,19 @@ unsigned long motorTestDuration = 0;
 bool motorTestRequested = false;
 uint32_t requestedTestDuration = 0;
 
+// Nem kontrol modu (0=Histerezis, 1=Öngörülü)
+uint8_t humidControlMode = HUMID_CONTROL_MODE_DEFAULT;
+
+// Toplu parametre güncellemesi (/api/settings/batch) durumu
+bool wifiParameterBatchActive = false;
+bool wifiParameterBatchScheduleChanged = false;
+
 // Fonksiyon prototipleri
 void initializeModules();
 void handleJoystick();
+void handleJoystickDirection(JoystickDirection direction, uint16_t repeatCount);
 void updateSensors();
+void applyIdentifiedHumidityModel();
 void updateDisplay();
 void updateRelays();
 void updateAlarm();
@@ -76,9 +93,13 @@ void saveSettingsToStorage();
 void handleValueAdjustment(JoystickDirection direction);
 void handlePIDAutoTune();
 void handleWifiParameterUpdate(String param, String value);
+bool validateWifiParameter(const String& param, const String& value);
+void beginWifiParameterBatch();
+void commitWifiParameterBatch();
 void updateMenuWithCurrentStatus();
 void updateWiFiStatus();
 void handleMotorTest();
+void handleSerialCommands();
 
 // YENİ EKLENEN FONKSİYON PROTOTİPLERİ
 void handleTimeAdjustment(JoystickDirection direction);
@@ -94,8 +115,14 @@ void updateTimeDisplay();
 void updateDateDisplay();
 void updateValueDisplay();
 void updateMenuDisplay(MenuState newState);
+void showTrendScreen();
 
 void updateWiFiStatus() {
+    // Toplu güncellemede durum, commit sırasında tek seferde yayınlanır
+    if (wifiParameterBatchActive) {
+        return;
+    }
+    
     DateTime currentDateTime = rtc.getCurrentDateTime();
     
     // Sensör değerlerini ayrı ayrı oku
@@ -170,6 +197,7 @@ void setup() {
 void loop() {
     // Mevcut zaman
     unsigned long currentMillis = millis();
+    uint32_t loopStart = micros();
     
     // Düzenli watchdog beslemesi - İYİLEŞTİRİLMİŞ
     watchdogManager.feed();
@@ -186,23 +214,44 @@ void loop() {
         watchdogManager.endOperation();
     }
     
-    // Joystick kontrolü - İYİLEŞTİRİLMİŞ
-    if (currentMillis - lastJoystickReadTime >= JOYSTICK_READ_DELAY) {
-        lastJoystickReadTime = currentMillis;
-        
+    // Ekran güç durumu: giriş veya alarm anında uyandırır, boşta kısar/kapatır
+    displayPower.update(joystick.getLastActionTime(), alarmManager.isAlarmActive());
+    
+    if (displayPower.consumeWakeFromOff()) {
+        // Karanlık ekranda yapılan giriş yalnızca uyandırır, işlem yapmaz
+        JoystickEvent wakeEvent;
+        while (joystick.pollEvent(wakeEvent)) {
+        }
+        lastDisplayUpdateTime = currentMillis - DISPLAY_REFRESH_DELAY; // Hemen tazele
+    }
+    
+    if (displayPower.getState() == DISPLAY_POWER_OFF && menuManager.getCurrentState() != MENU_NONE) {
+        // Ekran kapanırken menüden çık; uyanınca ana ekran görünsün
+        menuManager.setCurrentState(MENU_NONE);
+        display.setupMainScreen();
+    }
+    
+    // Joystick kontrolü - olaylar arka planda kuyruğa alınır, her döngüde boşaltılır
+    if (joystick.hasEvent() && displayPower.isPanelOn()) {
         watchdogManager.beginOperation(OP_MENU_NAVIGATION, "Joystick İşleme");
         handleJoystick();
         watchdogManager.endOperation();
     }
     
-    // Ekranı güncelle - İYİLEŞTİRİLMİŞ
-    if (currentMillis - lastDisplayUpdateTime >= DISPLAY_REFRESH_DELAY) {
+    // Ekranı güncelle - yenileme temposu güç durumuna bağlı (kapalıyken hiç)
+    unsigned long refreshInterval = displayPower.getRefreshInterval();
+    if (refreshInterval > 0 && currentMillis - lastDisplayUpdateTime >= refreshInterval) {
         lastDisplayUpdateTime = currentMillis;
         
         if (display.getCurrentMode() == DISPLAY_MAIN) {
             watchdogManager.beginOperation(OP_DISPLAY_UPDATE, "Ana Ekran Güncelleme");
+            uint32_t displayStart = micros();
             updateDisplay();
+            perfMonitor.record(PERF_DISPLAY_UPDATE, micros() - displayStart);
             watchdogManager.endOperation();
+        } else if (display.getCurrentMode() == DISPLAY_TREND) {
+            // Yalnızca yeni geçmiş kaydı eklendiyse yeniden çizilir
+            showTrendScreen();
         }
     }
     
@@ -333,7 +382,27 @@ void loop() {
     }
     
     // WiFi isteklerini işle - İYİLEŞTİRİLMİŞ
+    uint32_t wifiStart = micros();
     wifiManager.handleRequests();
+    perfMonitor.record(PERF_WIFI_HANDLE, micros() - wifiStart);
+    
+    // YENİ: Ekran tamponunun DMA gönderimini ilerlet (bloklamaz).
+    // Panel kapalıyken SPI trafiği yok; biriken değişiklikler uyanınca gider.
+    if (displayPower.isPanelOn()) {
+        uint32_t flushStart = micros();
+        display.service();
+        perfMonitor.record(PERF_DISPLAY_FLUSH, micros() - flushStart);
+    }
+    
+    // Otomatik ayarlama sonuçlarını ve onlardan yeniden üretilen kazanç tablosunu kaydet
+    if (pidController.consumeAutoTuneResult()) {
+        storage.setPidKp(pidController.getKp());
+        storage.setPidKi(pidController.getKi());
+        storage.setPidKd(pidController.getKd());
+        storage.queueSave();
+        storage.saveGainSchedule(pidController.getGainSchedule());
+        updateWiFiStatus();
+    }
     
     // PID Otomatik Ayarlama durumunu kontrol et - İYİLEŞTİRİLMİŞ
     if (pidController.isAutoTuneEnabled()) {
@@ -341,6 +410,37 @@ void loop() {
         handlePIDAutoTune();
         watchdogManager.endOperation();
     }
+    
+    // Seri port komutları (perf, perf reset)
+    handleSerialCommands();
+    
+    perfMonitor.record(PERF_LOOP, micros() - loopStart);
+}
+
+void handleSerialCommands() {
+    static String commandBuffer = "";
+    
+    while (Serial.available() > 0) {
+        char c = Serial.read();
+        
+        if (c != '\n' && c != '\r') {
+            if (commandBuffer.length() < 32) {
+                commandBuffer += c;
+            }
+            continue;
+        }
+        
+        commandBuffer.trim();
+        if (commandBuffer == "perf") {
+            perfMonitor.dump();
+        } else if (commandBuffer == "perf reset") {
+            perfMonitor.reset();
+            Serial.println("Perf: Ölçümler sıfırlandı");
+        } else if (commandBuffer.length() > 0) {
+            Serial.println("Bilinmeyen komut: " + commandBuffer + " (perf, perf reset)");
+        }
+        commandBuffer = "";
+    }
 }
 
 void handleMotorTest() {
@@ -429,6 +529,7 @@ void initializeModules() {
     if (!display.begin()) {
         Serial.println("Ekran başlatma hatası!");
     }
+    displayPower.begin();
     watchdogManager.endOperation();
     
     // Sensör modülü
@@ -443,6 +544,11 @@ void initializeModules() {
         Serial.println("RTC başlatma hatası!");
     }
     
+    // Sensör geçmişi (trend grafiği)
+    if (!sensorHistory.begin()) {
+        Serial.println("Sensör geçmişi başlatma hatası!");
+    }
+    
     // Joystick modülü
     if (!joystick.begin()) {
         Serial.println("Joystick başlatma hatası!");
@@ -471,6 +577,18 @@ void initializeModules() {
         Serial.println("Histerezis kontrolü başlatma hatası!");
     }
     
+    // Öngörülü nem kontrolü
+    if (!humidityMPC.begin()) {
+        Serial.println("Öngörülü nem kontrolü başlatma hatası!");
+    }
+    
+    // Isıtıcı ve nemlendirici döngüleri için proses tanımlama
+    heaterIdentifier.begin("Isıtıcı");
+    humidIdentifier.begin("Nemlendirici");
+    
+    // Kontrol döngüsü gecikme ölçümü
+    perfMonitor.begin();
+    
     // Menü yönetimi
     if (!menuManager.begin()) {
         Serial.println("Menü yönetimi başlatma hatası!");
@@ -510,13 +628,42 @@ void updateMenuWithCurrentStatus() {
 }
 
 void handleJoystick() {
-    joystick.update();
-    JoystickDirection direction = joystick.readDirection();
+    JoystickEvent event;
     
-    if (direction == JOYSTICK_NONE) {
-        return;
+    while (joystick.pollEvent(event)) {
+        if (event.type == JOYSTICK_EVENT_RELEASE) {
+            continue;
+        }
+        
+        // Uzun basma: menüden doğrudan ana ekrana dön
+        if (event.type == JOYSTICK_EVENT_LONG_PRESS) {
+            menuManager.updateInteractionTime();
+            if (menuManager.getCurrentState() != MENU_NONE) {
+                menuManager.setCurrentState(MENU_NONE);
+                display.setupMainScreen();
+            }
+        } else {
+            handleJoystickDirection(event.direction, event.repeatCount);
+        }
+        
+        perfMonitor.record(PERF_INPUT_LATENCY, micros() - event.timestamp);
     }
     
+    // Art arda gelen ayar olaylarından yalnızca son değer çizilir
+    if (valueAdjustRedrawPending) {
+        valueAdjustRedrawPending = false;
+        
+        if (menuManager.isInValueAdjustScreen()) {
+            display.showValueAdjustScreen(
+                menuManager.getAdjustTitle(),
+                String(menuManager.getAdjustedValue()),
+                menuManager.getAdjustUnit()
+            );
+        }
+    }
+}
+
+void handleJoystickDirection(JoystickDirection direction, uint16_t repeatCount) {
     Serial.print("Joystick: ");
     Serial.println(direction);
     
@@ -529,13 +676,9 @@ void handleJoystick() {
             menuManager.setCurrentState(MENU_MAIN);
             updateMenuWithCurrentStatus();
             
-            std::vector<String> items = menuManager.getMenuItems();
+            const MenuView& items = menuManager.getCurrentMenuItems();
             if (!items.empty()) {
-                display.showMenu(
-                    items.data(),
-                    items.size(),
-                    menuManager.getSelectedIndex()
-                );
+                display.showMenu(items, menuManager.getSelectedIndex());
             }
         }
         return;
@@ -545,9 +688,9 @@ void handleJoystick() {
     if (menuManager.isInTimeAdjustScreen()) {
         if (direction == JOYSTICK_LEFT) {
             menuManager.setCurrentState(MENU_TIME_DATE);
-            std::vector<String> items = menuManager.getMenuItems();
+            const MenuView& items = menuManager.getCurrentMenuItems();
             if (!items.empty()) {
-                display.showMenu(items.data(), items.size(), menuManager.getSelectedIndex());
+                display.showMenu(items, menuManager.getSelectedIndex());
             }
             return;
         } else if (direction == JOYSTICK_RIGHT) {
@@ -577,9 +720,9 @@ void handleJoystick() {
     if (menuManager.isInDateAdjustScreen()) {
         if (direction == JOYSTICK_LEFT) {
             menuManager.setCurrentState(MENU_TIME_DATE);
-            std::vector<String> items = menuManager.getMenuItems();
+            const MenuView& items = menuManager.getCurrentMenuItems();
             if (!items.empty()) {
-                display.showMenu(items.data(), items.size(), menuManager.getSelectedIndex());
+                display.showMenu(items, menuManager.getSelectedIndex());
             }
             return;
         } else if (direction == JOYSTICK_RIGHT) {
@@ -616,19 +759,16 @@ void handleJoystick() {
             if (prevState == MENU_NONE) {
                 display.setupMainScreen();
             } else {
-                std::vector<String> items = menuManager.getMenuItems();
+                const MenuView& items = menuManager.getCurrentMenuItems();
                 if (!items.empty()) {
-                    display.showMenu(items.data(), items.size(), menuManager.getSelectedIndex());
+                    display.showMenu(items, menuManager.getSelectedIndex());
                 }
             }
             return;
         } else if (direction == JOYSTICK_UP || direction == JOYSTICK_DOWN || direction == JOYSTICK_RIGHT) {
-            menuManager.update(direction);
-            display.showValueAdjustScreen(
-                menuManager.getAdjustTitle(),
-                String(menuManager.getAdjustedValue()),
-                menuManager.getAdjustUnit()
-            );
+            // Basılı tutarken adım hızlanır; çizim kuyruk boşalınca yapılır
+            menuManager.update(direction, repeatCount);
+            valueAdjustRedrawPending = true;
         }
         return;
     }
@@ -646,7 +786,7 @@ void handleJoystick() {
         MENU_ALARM_TEMP_LOW, MENU_ALARM_TEMP_HIGH,
         MENU_ALARM_HUMID_LOW, MENU_ALARM_HUMID_HIGH,
         MENU_ALARM_MOTOR,
-        MENU_SENSOR_VALUES,
+        MENU_SENSOR_VALUES, MENU_TREND,
         MENU_MANUAL_DEV_TEMP, MENU_MANUAL_HATCH_TEMP,
         MENU_MANUAL_DEV_HUMID, MENU_MANUAL_HATCH_HUMID,
         MENU_MANUAL_DEV_DAYS, MENU_MANUAL_HATCH_DAYS,
@@ -663,16 +803,21 @@ void handleJoystick() {
     }
     
     if (isTerminalMenu) {
-        if (direction == JOYSTICK_LEFT) {
+        if (currentState == MENU_TREND && (direction == JOYSTICK_UP || direction == JOYSTICK_DOWN)) {
+            // Aralık değişimi: önbellekteki sütunlardan tek çizim
+            menuManager.update(direction);
+            showTrendScreen();
+            return;
+        } else if (direction == JOYSTICK_LEFT) {
             menuManager.update(direction);
             MenuState newState = menuManager.getCurrentState();
             
             if (newState == MENU_NONE) {
                 display.setupMainScreen();
             } else {
-                std::vector<String> items = menuManager.getMenuItems();
+                const MenuView& items = menuManager.getCurrentMenuItems();
                 if (!items.empty()) {
-                    display.showMenu(items.data(), items.size(), menuManager.getSelectedIndex());
+                    display.showMenu(items, menuManager.getSelectedIndex());
                 }
             }
             return;
@@ -713,24 +858,27 @@ void handleJoystick() {
             menuManager.getAdjustUnit()
         );
     } else if (menuManager.isInMenu()) {
-        std::vector<String> items = menuManager.getMenuItems();
+        const MenuView& items = menuManager.getCurrentMenuItems();
         if (!items.empty()) {
-            display.showMenu(
-                items.data(),
-                items.size(),
-                menuManager.getSelectedIndex()
-            );
+            display.showMenu(items, menuManager.getSelectedIndex());
         }
     }
 }
 
+void showTrendScreen() {
+    TrendSpan span = menuManager.getTrendSpan();
+    display.showTrendScreen(sensorHistory.getTrend(span), SensorHistory::getSpanLabel(span));
+}
+
 void updateSensors() {
     // Sensör verilerini okumadan önce watchdog beslemesi
     bool needWatchdogFeed = false;
     
     // Sıcaklık ve nem değerlerini oku
+    perfMonitor.markSampleStart();
     float temp = sensors.readTemperature();
     float humid = sensors.readHumidity();
+    perfMonitor.markSampleReady();
 
     // Sensör hata kontrolü - basitleştirilmiş versiyon
     if (temp == -999.0 || humid == -999.0) {
@@ -750,12 +898,18 @@ void updateSensors() {
             relays.setHumidifier(false);
         }
         
+        // Trend grafiğinde kesinti dakikaları boş görünsün
+        sensorHistory.update();
+        
         // WiFi üzerinden hata durumunu bildir
         updateWiFiStatus();
         
         return; // Diğer güncellemeleri yapma
     }
     
+    // Trend grafiği için geçmişe ekle
+    sensorHistory.addSample(temp, humid);
+    
     // Eğer sensör hata sayısı yüksekse watchdog beslemeyi zorla
     if (sensors.getI2CErrorCount() > 5) {
         needWatchdogFeed = true;
@@ -763,10 +917,24 @@ void updateSensors() {
     
     // PID kontrolü için sıcaklık değerini kullan
     pidController.compute(temp);
+    perfMonitor.markPidDone();
     
     // Histerezis kontrolü için nem değerini kullan
     hysteresisController.compute(humid);
     
+    // YENİ: Öngörülü nem kontrolü, hedefi histerezis kontrolcüsünden alır
+    humidityMPC.setSetpoint(hysteresisController.getSetpoint());
+    humidityMPC.compute(humid);
+    
+    // YENİ: Proses modellerini röle geçmişi ve ölçümlerden güncelle
+    heaterIdentifier.update(temp);
+    humidIdentifier.update(humid);
+    
+    // Tanımlanan nem modelini öngörülü kontrolcüye seyrek aralıklarla aktar
+    if (IDENT_APPLY_TO_HUMID_MPC) {
+        applyIdentifiedHumidityModel();
+    }
+    
     // Kuluçka durumunu güncelle
     incubation.update(rtc.getCurrentDateTime());
 
@@ -782,6 +950,9 @@ void updateSensors() {
         pidController.setSetpoint(newTargetTemp);
         hysteresisController.setSetpoint(newTargetHumid);
         
+        // YENİ: Kazanç tablosunda yeni aşamanın satırına geç
+        pidController.setStage((uint8_t)currentStage);
+        
         lastStage = currentStage;
         
         Serial.println("Kuluçka aşaması değişti. Yeni hedef değerler:");
@@ -847,29 +1018,31 @@ void updateDisplay() {
     // Mevcut duruma göre ekranı güncelle
     if (menuManager.isInHomeScreen()) {
         // Ana ekran güncellemesi
-        display.updateMainScreen(
-            sensors.readTemperature(),
-            pidController.getSetpoint(),
-            sensors.readHumidity(),
-            hysteresisController.getSetpoint(),
-            relays.getMotorWaitTimeLeft(),      // Kalan bekleme süresi (dakika)
-            relays.getMotorRunTimeLeft(),       // Kalan çalışma süresi (saniye)
-            incubation.getDisplayDay(rtc.getCurrentDateTime()), // DÜZELTME: getDisplayDay kullan
-            incubation.getTotalDays(),
-            incubation.getIncubationTypeName(),
-            relays.getHeaterState(),
-            relays.getHumidifierState(),
-            relays.getMotorState(),
-            rtc.getTimeString(),
-            rtc.getDateString()
-        );
+        String typeName = incubation.getIncubationTypeName();
+        String timeStr = rtc.getTimeString();
+        String dateStr = rtc.getDateString();
+        
+        MainScreenData data;
+        data.currentTemp = sensors.readTemperature();
+        data.targetTemp = pidController.getSetpoint();
+        data.currentHumid = sensors.readHumidity();
+        data.targetHumid = hysteresisController.getSetpoint();
+        data.motorMinutesLeft = relays.getMotorWaitTimeLeft();   // Kalan bekleme süresi (dakika)
+        data.motorSecondsLeft = relays.getMotorRunTimeLeft();    // Kalan çalışma süresi (saniye)
+        data.currentDay = incubation.getDisplayDay(rtc.getCurrentDateTime()); // DÜZELTME: getDisplayDay kullan
+        data.totalDays = incubation.getTotalDays();
+        data.incubationType = typeName.c_str();
+        data.heatingActive = relays.getHeaterState();
+        data.humidActive = relays.getHumidifierState();
+        data.motorActive = relays.getMotorState();
+        data.timeStr = timeStr.c_str();
+        data.dateStr = dateStr.c_str();
+        
+        display.updateMainScreen(data);
     } else if (menuManager.isInMenu()) {
-        // Menü ekranı güncellemesi
-        display.showMenu(
-            menuManager.getMenuItems().data(),
-            menuManager.getMenuItems().size(),
-            menuManager.getSelectedIndex()
-        );
+        // Menü ekranı güncellemesi (öğeler kopyalanmadan okunur)
+        const MenuView& items = menuManager.getCurrentMenuItems();
+        display.showMenu(items, menuManager.getSelectedIndex());
     }
     
     // PID Otomatik Ayarlama ekranı
@@ -897,12 +1070,78 @@ void updateDisplay() {
     }
 }
 
+// Yakınsamış RLS modelini öngörülü kontrolcüye aktarır. Her örnekte değil,
+// IDENT_MPC_APPLY_INTERVAL aralığında ve yalnızca model fiziksel sınırlar
+// içindeyse ve mevcut modelden anlamlı ölçüde farklıysa uygulanır; böylece
+// tahmin gürültüsü kontrol planını sürekli değiştirmez.
+void applyIdentifiedHumidityModel() {
+    static unsigned long lastApplyTime = 0;
+    
+    if (!humidIdentifier.isConverged()) {
+        return;
+    }
+    
+    // İlk model beklemeden uygulanır; sonrakiler yavaş kadansla
+    if (humidityMPC.hasModel() && millis() - lastApplyTime < IDENT_MPC_APPLY_INTERVAL) {
+        return;
+    }
+    
+    double gain = humidIdentifier.getGain();
+    unsigned long tau = humidIdentifier.getTimeConstant();
+    unsigned long delay = humidIdentifier.getDeadTime();
+    
+    if (gain < IDENT_HUMID_GAIN_MIN || gain > IDENT_HUMID_GAIN_MAX ||
+        tau < IDENT_HUMID_TAU_MIN || tau > IDENT_HUMID_TAU_MAX ||
+        delay >= (unsigned long)HUMID_MPC_STEP * HUMID_MPC_MAX_DELAY_STEPS) {
+        return;
+    }
+    
+    if (humidityMPC.hasModel()) {
+        double gainChange = fabs(gain - humidityMPC.getModelGain()) / humidityMPC.getModelGain();
+        double tauChange = fabs((double)tau - humidityMPC.getModelTau()) / humidityMPC.getModelTau();
+        long delayChange = labs((long)delay - (long)humidityMPC.getModelDelay());
+        
+        if (gainChange < IDENT_MPC_MIN_CHANGE && tauChange < IDENT_MPC_MIN_CHANGE &&
+            delayChange < HUMID_MPC_STEP) {
+            lastApplyTime = millis();
+            return;
+        }
+    }
+    
+    if (humidityMPC.setModel(gain, tau, delay)) {
+        lastApplyTime = millis();
+        Serial.println("Nem MPC: Model güncellendi - K:" + String(gain) + " Tau:" + String(tau / 1000) +
+                       "s Gecikme:" + String(delay / 1000) + "s");
+    }
+}
+
 void updateRelays() {
+    // YENİ: Nemlendirici ve motor durumlarını ileri besleme için bildir
+    pidController.setDisturbanceStates(relays.getHumidifierState(), relays.getMotorState());
+    
     // PID çıkışına göre ısıtıcı rölesini kontrol et
     relays.setHeater(pidController.isOutputActive());
+    perfMonitor.markHeaterActuated();
+    
+    // Seçili nem kontrol moduna göre nem rölesini kontrol et. Öngörülü mod,
+    // tanımlanmış bir nem modeli olana kadar histerezisle çalışır.
+    bool predictive = humidControlMode == HUMID_CONTROL_PREDICTIVE && humidityMPC.hasModel();
+    static bool lastPredictive = false;
+    if (predictive != lastPredictive) {
+        lastPredictive = predictive;
+        Serial.println("Nem kontrolü: " + String(predictive ? "Öngörülü (model hazır)" : "Histerezis"));
+    }
+    
+    if (predictive) {
+        relays.setHumidifier(humidityMPC.getOutput());
+    } else {
+        relays.setHumidifier(hysteresisController.getOutput());
+    }
     
-    // Histerezis çıkışına göre nem rölesini kontrol et
-    relays.setHumidifier(hysteresisController.getOutput());
+    // YENİ: Proses tanımlama ve öngörülü kontrol için gerçek röle durumlarını bildir
+    heaterIdentifier.setInput(relays.getHeaterState());
+    humidIdentifier.setInput(relays.getHumidifierState());
+    humidityMPC.setActualOutput(relays.getHumidifierState());
     
     // Motor rölesini güncelle
     relays.update();
@@ -1005,6 +1244,12 @@ void handleMenuActions(JoystickDirection direction) {
     
     // Terminal menüler için özel işlemler - TÜM DEĞER AYARLAMA EKRANLARI
     
+    // Trend grafiği ekranı
+    if (currentState == MENU_TREND) {
+        showTrendScreen();
+        return;
+    }
+    
     // Sensör değerleri ekranı
     if (currentState == MENU_SENSOR_VALUES) {
         display.showSensorValuesScreen(
@@ -1233,9 +1478,9 @@ if (currentState == MENU_CALIBRATION_HUMID_2) {
             Serial.println("Kullanıcı tarafından tüm alarmlar açıldı");
             
             // Menüyü güncelle
-            std::vector<String> items = menuManager.getMenuItems();
+            const MenuView& items = menuManager.getCurrentMenuItems();
             if (!items.empty()) {
-                display.showMenu(items.data(), items.size(), menuManager.getSelectedIndex());
+                display.showMenu(items, menuManager.getSelectedIndex());
             }
         }
         return;
@@ -1256,9 +1501,9 @@ if (currentState == MENU_CALIBRATION_HUMID_2) {
             Serial.println("Kullanıcı tarafından tüm alarmlar kapatıldı");
             
             // Menüyü güncelle
-            std::vector<String> items = menuManager.getMenuItems();
+            const MenuView& items = menuManager.getCurrentMenuItems();
             if (!items.empty()) {
-                display.showMenu(items.data(), items.size(), menuManager.getSelectedIndex());
+                display.showMenu(items, menuManager.getSelectedIndex());
             }
         }
         return;
@@ -1592,9 +1837,9 @@ void handleValueAdjustment(JoystickDirection direction) {
             }
             
             menuManager.setCurrentState(MENU_TIME_DATE);
-            std::vector<String> items = menuManager.getMenuItems();
+            const MenuView& items = menuManager.getCurrentMenuItems();
             if (!items.empty()) {
-                display.showMenu(items.data(), items.size(), menuManager.getSelectedIndex());
+                display.showMenu(items, menuManager.getSelectedIndex());
             }
             return;
         }
@@ -1619,9 +1864,9 @@ void handleValueAdjustment(JoystickDirection direction) {
             }
             
             menuManager.setCurrentState(MENU_TIME_DATE);
-            std::vector<String> items = menuManager.getMenuItems();
+            const MenuView& items = menuManager.getCurrentMenuItems();
             if (!items.empty()) {
-                display.showMenu(items.data(), items.size(), menuManager.getSelectedIndex());
+                display.showMenu(items, menuManager.getSelectedIndex());
             }
             return;
         }
@@ -1632,6 +1877,9 @@ void handleValueAdjustment(JoystickDirection direction) {
         
         Serial.println("Değer ayarlama - Önceki menü: " + String(prevState) + " Değer: " + String(value));
         
+        // Kazanç tablosu etkinken temel PID kazançları uygulanmaz; kullanıcıya bildirilir
+        const char* confirmation = "Kaydedildi";
+        
         switch (prevState) {
             case MENU_TEMPERATURE:
                 pidController.setSetpoint(value);
@@ -1652,19 +1900,28 @@ void handleValueAdjustment(JoystickDirection direction) {
                 break;
                 
             case MENU_PID_KP:
-                pidController.setTunings(value, pidController.getKi(), pidController.getKd());
+                if (!pidController.setTunings(value, pidController.getKi(), pidController.getKd())) {
+                    confirmation = "Kazanc Tablosu Aktif!";
+                    break;
+                }
                 storage.setPidKp(value);
                 Serial.println("PID Kp güncellendi: " + String(value));
                 break;
                 
             case MENU_PID_KI:
-                pidController.setTunings(pidController.getKp(), value, pidController.getKd());
+                if (!pidController.setTunings(pidController.getKp(), value, pidController.getKd())) {
+                    confirmation = "Kazanc Tablosu Aktif!";
+                    break;
+                }
                 storage.setPidKi(value);
                 Serial.println("PID Ki güncellendi: " + String(value));
                 break;
                 
             case MENU_PID_KD:
-                pidController.setTunings(pidController.getKp(), pidController.getKi(), value);
+                if (!pidController.setTunings(pidController.getKp(), pidController.getKi(), value)) {
+                    confirmation = "Kazanc Tablosu Aktif!";
+                    break;
+                }
                 storage.setPidKd(value);
                 Serial.println("PID Kd güncellendi: " + String(value));
                 break;
@@ -1793,16 +2050,16 @@ void handleValueAdjustment(JoystickDirection direction) {
         Serial.println("!!! DEĞER DEĞİŞİKLİĞİ ANINDA KAYDEDİLDİ !!!");
         
         updateWiFiStatus();
-        display.showConfirmationMessage("Kaydedildi");
+        display.showConfirmationMessage(confirmation);
         
         // Bir üst menüye dönüş
         MenuState targetState = menuManager.getBackState(prevState);
         menuManager.setCurrentState(targetState);
         
         // Menü ekranını göster
-        std::vector<String> items = menuManager.getMenuItems();
+        const MenuView& items = menuManager.getCurrentMenuItems();
         if (!items.empty()) {
-            display.showMenu(items.data(), items.size(), menuManager.getSelectedIndex());
+            display.showMenu(items, menuManager.getSelectedIndex());
             Serial.println("Menü geçişi yapıldı - Hedef: " + String(targetState));
         } else {
             Serial.println("HATA: Menü öğeleri boş - Hedef: " + String(targetState));
@@ -1868,6 +2125,21 @@ void loadSettingsFromStorage() {
     Serial.println("PID parametreleri yüklendi - Kp:" + String(storage.getPidKp()) + 
                    " Ki:" + String(storage.getPidKi()) + " Kd:" + String(storage.getPidKd()));
     
+    // YENİ: PID kazanç tablosunu yükle, yoksa temel parametrelerden oluştur
+    PIDGainSchedule gainSchedule;
+    if (storage.loadGainSchedule(gainSchedule)) {
+        pidController.setGainSchedule(gainSchedule);
+        Serial.println("PID kazanç tablosu yüklendi - Durum: " + 
+                       String(gainSchedule.enabled ? "Etkin" : "Kapalı"));
+    } else {
+        pidController.resetGainSchedule();
+        Serial.println("PID kazanç tablosu bulunamadı, varsayılan tablo kullanılıyor");
+    }
+    
+    // Nem kontrol modu tercihi (öngörülü mod model tanımlanınca devreye girer)
+    humidControlMode = storage.getHumidControlMode();
+    Serial.println("Nem kontrol modu: " + String(humidControlMode == HUMID_CONTROL_PREDICTIVE ? "Öngörülü" : "Histerezis"));
+    
     // DÜZELTME: Storage'dan PID modunu oku ve uygula
     uint8_t savedPidMode = storage.getPidMode();
     Serial.println("Kaydedilmiş PID modu: " + String(savedPidMode));
@@ -2041,315 +2313,549 @@ void saveSettingsToStorage() {
     watchdogManager.endOperation(); // İşlem tamamlandı
 }
 
-void handleWifiParameterUpdate(String param, String value) {
-    // KRİTİK: Tüm parametre güncellemeleri kritik olarak değerlendirilecek
-    bool criticalUpdate = true; // VARSAYILAN OLARAK KRİTİK
-    
-    // Sıcaklık ve nem hedef değerleri
-    if (param == "targetTemp") {
-        float temp = value.toFloat();
-        if (temp >= 20.0 && temp <= 40.0) {
-            pidController.setSetpoint(temp);
-            storage.setTargetTemperature(temp); // YENİ EKLENEN
-            if (incubation.getIncubationType() == INCUBATION_MANUAL) {
-                incubation.setTargetTemperature(temp);
-            }
-            updateWiFiStatus();
-            Serial.println("Hedef sıcaklık güncellendi ve kaydedilecek: " + String(temp));
-        }
-    } else if (param == "targetHumid") {
-        float humid = value.toFloat();
-        if (humid >= 30.0 && humid <= 90.0) {
-            hysteresisController.setSetpoint(humid);
-            storage.setTargetHumidity(humid); // YENİ EKLENEN
-            if (incubation.getIncubationType() == INCUBATION_MANUAL) {
-                incubation.setTargetHumidity((uint8_t)humid);
-            }
-            updateWiFiStatus();
-            Serial.println("Hedef nem güncellendi ve kaydedilecek: " + String(humid));
-        }
-    }
-    // PID parametreleri
-    else if (param == "pidKp") {
-        float kp = value.toFloat();
-        if (kp >= 0.1 && kp <= 100.0) {
-            pidController.setTunings(kp, pidController.getKi(), pidController.getKd());
-            storage.setPidKp(kp);
-            updateWiFiStatus();
-            Serial.println("PID Kp güncellendi ve kaydedilecek: " + String(kp));
-        }
-    } else if (param == "pidKi") {
-        float ki = value.toFloat();
-        if (ki >= 0.01 && ki <= 10.0) {
-            pidController.setTunings(pidController.getKp(), ki, pidController.getKd());
-            storage.setPidKi(ki);
-            updateWiFiStatus();
-            Serial.println("PID Ki güncellendi ve kaydedilecek: " + String(ki));
-        }
-    } else if (param == "pidKd") {
-        float kd = value.toFloat();
-        if (kd >= 0.1 && kd <= 100.0) {
-            pidController.setTunings(pidController.getKp(), pidController.getKi(), kd);
-            storage.setPidKd(kd);
-            updateWiFiStatus();
-            Serial.println("PID Kd güncellendi ve kaydedilecek: " + String(kd));
-        }
+// ==================== WiFi PARAMETRE TABLOSU ====================
+// Her parametre; tip, aralık, uygulayıcı ve kalıcılık sınıfıyla tek bir
+// tanımlayıcıda tutulur. Tablo ada göre sıralıdır (derleme anında doğrulanır),
+// arama ikili arama ile String oluşturmadan yapılır. Aynı tablo doğrulama ve
+// /api/settings/schema çıktısını da besler.
+
+enum WifiParameterType : uint8_t {
+    WIFI_PARAM_FLOAT = 0,
+    WIFI_PARAM_INT,
+    WIFI_PARAM_BOOL,
+    WIFI_PARAM_STRING               // min/max metin uzunluğudur
+};
+
+enum WifiParameterPersistence : uint8_t {
+    WIFI_PARAM_PERSIST_STATE = 0,   // Değişiklik anında kritik kayıt (saveStateNow)
+    WIFI_PARAM_PERSIST_SCHEDULE,    // PID kazanç tablosu kaydı
+    WIFI_PARAM_PERSIST_RUNTIME,     // Sadece çalışma zamanı, kayıt yok
+    WIFI_PARAM_PERSIST_COMMAND      // Tek seferlik komut, toplu güncellemeye girmez
+};
+
+struct WifiParameterValue {
+    float number;
+    bool flag;
+    const String* text;
+};
+
+typedef void (*WifiParameterSetter)(const WifiParameterValue& value);
+
+struct WifiParameterDescriptor {
+    const char* name;
+    uint8_t type;
+    float minValue;
+    float maxValue;
+    uint8_t persistence;
+    WifiParameterSetter apply;
+};
+
+static const char* const WIFI_PARAM_TYPE_NAMES[] = { "float", "int", "bool", "string" };
+static const char* const WIFI_PARAM_PERSISTENCE_NAMES[] = { "state", "schedule", "runtime", "command" };
+
+// --- Uygulayıcılar (değer tablo sınırlarında doğrulanmış olarak gelir) ---
+
+static void applyTargetTemp(const WifiParameterValue& value) {
+    float temp = value.number;
+    pidController.setSetpoint(temp);
+    storage.setTargetTemperature(temp);
+    if (incubation.getIncubationType() == INCUBATION_MANUAL) {
+        incubation.setTargetTemperature(temp);
     }
-    // PID modu değişikliği
-    else if (param == "pidMode") {
-        int mode = value.toInt();
-        if (mode >= 0 && mode <= 2) {
-            PIDMode newMode = (PIDMode)mode;
-            pidController.setPIDMode(newMode);
-            storage.setPidMode(mode);
-            updateWiFiStatus();
-            updateMenuWithCurrentStatus();
-            Serial.println("PID modu güncellendi ve kaydedilecek: " + String(mode));
-        }
+    updateWiFiStatus();
+    Serial.println("Hedef sıcaklık güncellendi ve kaydedilecek: " + String(temp));
+}
+
+static void applyTargetHumid(const WifiParameterValue& value) {
+    float humid = value.number;
+    hysteresisController.setSetpoint(humid);
+    storage.setTargetHumidity(humid);
+    if (incubation.getIncubationType() == INCUBATION_MANUAL) {
+        incubation.setTargetHumidity((uint8_t)humid);
     }
-    // Motor ayarları
-    else if (param == "motorWaitTime") {
-    uint32_t waitTime = value.toInt();
-    if (waitTime >= 1 && waitTime <= 1440) { // 240'dan 1440'a değiştirildi
-        relays.updateMotorTiming(millis(), waitTime, storage.getMotorRunTime());
-        storage.setMotorWaitTime(waitTime);
-        updateWiFiStatus();
-        Serial.println("Motor bekleme süresi güncellendi ve kaydedilecek: " + String(waitTime));
-    } else {
-        Serial.println("Geçersiz motor bekleme süresi: " + String(waitTime) + " (1-1440 aralığında olmalı)");
+    updateWiFiStatus();
+    Serial.println("Hedef nem güncellendi ve kaydedilecek: " + String(humid));
+}
+
+static void applyPidKp(const WifiParameterValue& value) {
+    if (!pidController.setTunings(value.number, pidController.getKi(), pidController.getKd())) {
+        return;
     }
-} else if (param == "motorRunTime") {
-    uint32_t runTime = value.toInt();
-    if (runTime >= 1 && runTime <= 300) { // 60'dan 300'e değiştirildi
-        relays.updateMotorTiming(millis(), storage.getMotorWaitTime(), runTime);
-        storage.setMotorRunTime(runTime);
-        updateWiFiStatus();
-        Serial.println("Motor çalışma süresi güncellendi ve kaydedilecek: " + String(runTime));
-    } else {
-        Serial.println("Geçersiz motor çalışma süresi: " + String(runTime) + " (1-300 aralığında olmalı)");
+    storage.setPidKp(value.number);
+    updateWiFiStatus();
+    Serial.println("PID Kp güncellendi ve kaydedilecek: " + String(value.number));
+}
+
+static void applyPidKi(const WifiParameterValue& value) {
+    if (!pidController.setTunings(pidController.getKp(), value.number, pidController.getKd())) {
+        return;
     }
+    storage.setPidKi(value.number);
+    updateWiFiStatus();
+    Serial.println("PID Ki güncellendi ve kaydedilecek: " + String(value.number));
 }
-    // Motor test komutu
-else if (param == "motorTest") {
-    uint32_t testDuration = value.toInt();
-    if (testDuration > 0 && testDuration <= 60) {
-        Serial.println("WiFi API: Motor test isteği alındı - Süre: " + String(testDuration) + " saniye");
-        
-        // Motor test global değişkenlerini ayarla
-        motorTestRequested = true;
-        requestedTestDuration = testDuration;
-        
-        Serial.println("Motor test kuyruğa alındı");
-        return; // Kayıt işlemini atla
+
+static void applyPidKd(const WifiParameterValue& value) {
+    if (!pidController.setTunings(pidController.getKp(), pidController.getKi(), value.number)) {
+        return;
     }
+    storage.setPidKd(value.number);
+    updateWiFiStatus();
+    Serial.println("PID Kd güncellendi ve kaydedilecek: " + String(value.number));
 }
-    // Alarm ayarları
-    else if (param == "tempLowAlarm") {
-        float alarm = value.toFloat();
-        if (alarm >= 0.1 && alarm <= 5.0) {
-            alarmManager.setTempLowThreshold(alarm);
-            storage.setTempLowAlarm(alarm);
-            updateWiFiStatus();
-            Serial.println("Düşük sıcaklık alarmı güncellendi ve kaydedilecek: " + String(alarm));
-        }
-    } else if (param == "tempHighAlarm") {
-        float alarm = value.toFloat();
-        if (alarm >= 0.1 && alarm <= 5.0) {
-            alarmManager.setTempHighThreshold(alarm);
-            storage.setTempHighAlarm(alarm);
-            updateWiFiStatus();
-            Serial.println("Yüksek sıcaklık alarmı güncellendi ve kaydedilecek: " + String(alarm));
-        }
-    } else if (param == "humidLowAlarm") {
-        float alarm = value.toFloat();
-        if (alarm >= 1 && alarm <= 20) {
-            alarmManager.setHumidLowThreshold(alarm);
-            storage.setHumidLowAlarm(alarm);
-            updateWiFiStatus();
-            Serial.println("Düşük nem alarmı güncellendi ve kaydedilecek: " + String(alarm));
-        }
-    } else if (param == "humidHighAlarm") {
-        float alarm = value.toFloat();
-        if (alarm >= 1 && alarm <= 20) {
-            alarmManager.setHumidHighThreshold(alarm);
-            storage.setHumidHighAlarm(alarm);
-            updateWiFiStatus();
-            Serial.println("Yüksek nem alarmı güncellendi ve kaydedilecek: " + String(alarm));
-        }
-    } else if (param == "alarmEnabled") {
-        bool enabled = (value == "1" || value == "true");
-        alarmManager.setAlarmsEnabled(enabled);
-        storage.setAlarmsEnabled(enabled);
+
+static void applyPidMode(const WifiParameterValue& value) {
+    int mode = (int)value.number;
+    pidController.setPIDMode((PIDMode)mode);
+    storage.setPidMode(mode);
+    updateWiFiStatus();
+    updateMenuWithCurrentStatus();
+    Serial.println("PID modu güncellendi ve kaydedilecek: " + String(mode));
+}
+
+static void applyHumidControlMode(const WifiParameterValue& value) {
+    humidControlMode = (uint8_t)value.number;
+    storage.setHumidControlMode(humidControlMode);
+    updateWiFiStatus();
+    Serial.println("Nem kontrol modu: " + String(humidControlMode == HUMID_CONTROL_PREDICTIVE ? "Öngörülü" : "Histerezis") +
+                   (humidControlMode == HUMID_CONTROL_PREDICTIVE && !humidityMPC.hasModel() ? " (model bekleniyor)" : ""));
+}
+
+static void applyPidFeedForward(const WifiParameterValue& value) {
+    pidController.setFeedForwardEnabled(value.flag);
+    updateWiFiStatus();
+    Serial.println("Isıtıcı ileri besleme " + String(value.flag ? "etkinleştirildi" : "kapatıldı"));
+}
+
+static void applyPidGainSchedule(const WifiParameterValue& value) {
+    pidController.setGainScheduleEnabled(value.flag);
+    updateWiFiStatus();
+    Serial.println("PID kazanç tablosu " + String(value.flag ? "etkinleştirildi" : "kapatıldı"));
+}
+
+static void applyMotorWaitTime(const WifiParameterValue& value) {
+    uint32_t waitTime = (uint32_t)value.number;
+    relays.updateMotorTiming(millis(), waitTime, storage.getMotorRunTime());
+    storage.setMotorWaitTime(waitTime);
+    updateWiFiStatus();
+    Serial.println("Motor bekleme süresi güncellendi ve kaydedilecek: " + String(waitTime));
+}
+
+static void applyMotorRunTime(const WifiParameterValue& value) {
+    uint32_t runTime = (uint32_t)value.number;
+    relays.updateMotorTiming(millis(), storage.getMotorWaitTime(), runTime);
+    storage.setMotorRunTime(runTime);
+    updateWiFiStatus();
+    Serial.println("Motor çalışma süresi güncellendi ve kaydedilecek: " + String(runTime));
+}
+
+static void applyMotorTest(const WifiParameterValue& value) {
+    uint32_t testDuration = (uint32_t)value.number;
+    Serial.println("WiFi API: Motor test isteği alındı - Süre: " + String(testDuration) + " saniye");
+    
+    // Motor test global değişkenlerini ayarla
+    motorTestRequested = true;
+    requestedTestDuration = testDuration;
+    
+    Serial.println("Motor test kuyruğa alındı");
+}
+
+static void applyTempLowAlarm(const WifiParameterValue& value) {
+    alarmManager.setTempLowThreshold(value.number);
+    storage.setTempLowAlarm(value.number);
+    updateWiFiStatus();
+    Serial.println("Düşük sıcaklık alarmı güncellendi ve kaydedilecek: " + String(value.number));
+}
+
+static void applyTempHighAlarm(const WifiParameterValue& value) {
+    alarmManager.setTempHighThreshold(value.number);
+    storage.setTempHighAlarm(value.number);
+    updateWiFiStatus();
+    Serial.println("Yüksek sıcaklık alarmı güncellendi ve kaydedilecek: " + String(value.number));
+}
+
+static void applyHumidLowAlarm(const WifiParameterValue& value) {
+    alarmManager.setHumidLowThreshold(value.number);
+    storage.setHumidLowAlarm(value.number);
+    updateWiFiStatus();
+    Serial.println("Düşük nem alarmı güncellendi ve kaydedilecek: " + String(value.number));
+}
+
+static void applyHumidHighAlarm(const WifiParameterValue& value) {
+    alarmManager.setHumidHighThreshold(value.number);
+    storage.setHumidHighAlarm(value.number);
+    updateWiFiStatus();
+    Serial.println("Yüksek nem alarmı güncellendi ve kaydedilecek: " + String(value.number));
+}
+
+static void applyAlarmEnabled(const WifiParameterValue& value) {
+    alarmManager.setAlarmsEnabled(value.flag);
+    storage.setAlarmsEnabled(value.flag);
+    updateWiFiStatus();
+    updateMenuWithCurrentStatus();
+    Serial.println("Alarm durumu güncellendi ve kaydedilecek: " + String(value.flag ? "AÇIK" : "KAPALI"));
+}
+
+static void applyTempCalibration(uint8_t sensorIndex, float cal) {
+    sensors.setTemperatureCalibrationSingle(sensorIndex, cal);
+    storage.setTempCalibration(sensorIndex, cal);
+    updateWiFiStatus();
+    Serial.println("Sensör " + String(sensorIndex + 1) + " sıcaklık kalibrasyonu güncellendi ve kaydedilecek: " + String(cal));
+}
+
+static void applyHumidCalibration(uint8_t sensorIndex, float cal) {
+    sensors.setHumidityCalibrationSingle(sensorIndex, cal);
+    storage.setHumidCalibration(sensorIndex, cal);
+    updateWiFiStatus();
+    Serial.println("Sensör " + String(sensorIndex + 1) + " nem kalibrasyonu güncellendi ve kaydedilecek: " + String(cal));
+}
+
+static void applyTempCalibration1(const WifiParameterValue& value) { applyTempCalibration(0, value.number); }
+static void applyTempCalibration2(const WifiParameterValue& value) { applyTempCalibration(1, value.number); }
+static void applyHumidCalibration1(const WifiParameterValue& value) { applyHumidCalibration(0, value.number); }
+static void applyHumidCalibration2(const WifiParameterValue& value) { applyHumidCalibration(1, value.number); }
+
+static void applyIncubationType(const WifiParameterValue& value) {
+    uint8_t type = (uint8_t)value.number;
+    incubation.setIncubationType(type);
+    storage.setIncubationType(type);
+    
+    pidController.setSetpoint(incubation.getTargetTemperature());
+    hysteresisController.setSetpoint(incubation.getTargetHumidity());
+    updateWiFiStatus();
+    Serial.println("Kuluçka tipi güncellendi ve kaydedilecek: " + String(type));
+}
+
+static void applyIsIncubationRunning(const WifiParameterValue& value) {
+    if (value.flag && !incubation.isIncubationRunning()) {
+        incubation.startIncubation(rtc.getCurrentDateTime());
+        storage.setIncubationRunning(true);
+        storage.setStartTime(rtc.getCurrentDateTime());
+        
+        pidController.setPIDMode(PID_MODE_MANUAL);
+        pidController.startManualMode();
+        storage.setPidMode(1);
         updateWiFiStatus();
         updateMenuWithCurrentStatus();
-        Serial.println("Alarm durumu güncellendi ve kaydedilecek: " + String(enabled ? "AÇIK" : "KAPALI"));
-    }
-    // Kalibrasyon ayarları
-    else if (param == "tempCalibration1") {
-        float cal = value.toFloat();
-        if (cal >= -10.0 && cal <= 10.0) {
-            sensors.setTemperatureCalibrationSingle(0, cal);
-            storage.setTempCalibration(0, cal);
-            updateWiFiStatus();
-            Serial.println("Sensör 1 sıcaklık kalibrasyonu güncellendi ve kaydedilecek: " + String(cal));
-        }
-    } else if (param == "tempCalibration2") {
-        float cal = value.toFloat();
-        if (cal >= -10.0 && cal <= 10.0) {
-            sensors.setTemperatureCalibrationSingle(1, cal);
-            storage.setTempCalibration(1, cal);
-            updateWiFiStatus();
-            Serial.println("Sensör 2 sıcaklık kalibrasyonu güncellendi ve kaydedilecek: " + String(cal));
-        }
-    } else if (param == "humidCalibration1") {
-        float cal = value.toFloat();
-        if (cal >= -20.0 && cal <= 20.0) {
-            sensors.setHumidityCalibrationSingle(0, cal);
-            storage.setHumidCalibration(0, cal);
-            updateWiFiStatus();
-            Serial.println("Sensör 1 nem kalibrasyonu güncellendi ve kaydedilecek: " + String(cal));
-        }
-    } else if (param == "humidCalibration2") {
-        float cal = value.toFloat();
-        if (cal >= -20.0 && cal <= 20.0) {
-            sensors.setHumidityCalibrationSingle(1, cal);
-            storage.setHumidCalibration(1, cal);
-            updateWiFiStatus();
-            Serial.println("Sensör 2 nem kalibrasyonu güncellendi ve kaydedilecek: " + String(cal));
-        }
+        Serial.println("Kuluçka başlatıldı ve kaydedilecek");
+    } else if (!value.flag && incubation.isIncubationRunning()) {
+        incubation.stopIncubation();
+        storage.setIncubationRunning(false);
+        updateWiFiStatus();
+        Serial.println("Kuluçka durduruldu ve kaydedilecek");
     }
-    // Kuluçka ayarları
-    else if (param == "incubationType") {
-        uint8_t type = value.toInt();
-        if (type <= INCUBATION_MANUAL) {
-            incubation.setIncubationType(type);
-            storage.setIncubationType(type);
-            
-            float newTargetTemp = incubation.getTargetTemperature();
-            float newTargetHumid = incubation.getTargetHumidity();
-            
-            pidController.setSetpoint(newTargetTemp);
-            hysteresisController.setSetpoint(newTargetHumid);
-            updateWiFiStatus();
-            Serial.println("Kuluçka tipi güncellendi ve kaydedilecek: " + String(type));
-        }
-    } else if (param == "isIncubationRunning") {
-        bool running = (value == "1");
-        if (running && !incubation.isIncubationRunning()) {
-            incubation.startIncubation(rtc.getCurrentDateTime());
-            storage.setIncubationRunning(true);
-            storage.setStartTime(rtc.getCurrentDateTime());
-            
-            pidController.setPIDMode(PID_MODE_MANUAL);
-            pidController.startManualMode();
-            storage.setPidMode(1);
-            updateWiFiStatus();
-            updateMenuWithCurrentStatus();
-            Serial.println("Kuluçka başlatıldı ve kaydedilecek");
-        } else if (!running && incubation.isIncubationRunning()) {
-            incubation.stopIncubation();
-            storage.setIncubationRunning(false);
-            updateWiFiStatus();
-            Serial.println("Kuluçka durduruldu ve kaydedilecek");
+}
+
+static void applyManualDevTemp(const WifiParameterValue& value) {
+    float temp = value.number;
+    IncubationParameters params = incubation.getParameters();
+    incubation.setManualParameters(temp, params.hatchingTemp, params.developmentHumidity, 
+                                 params.hatchingHumidity, params.developmentDays, params.hatchingDays);
+    storage.setManualDevTemp(temp);
+    
+    if (incubation.getIncubationType() == INCUBATION_MANUAL && incubation.getCurrentStage() == STAGE_DEVELOPMENT) {
+        pidController.setSetpoint(temp);
+    }
+    updateWiFiStatus();
+    Serial.println("Manuel gelişim sıcaklığı güncellendi ve kaydedilecek: " + String(temp));
+}
+
+static void applyManualHatchTemp(const WifiParameterValue& value) {
+    float temp = value.number;
+    IncubationParameters params = incubation.getParameters();
+    incubation.setManualParameters(params.developmentTemp, temp, params.developmentHumidity, 
+                                 params.hatchingHumidity, params.developmentDays, params.hatchingDays);
+    storage.setManualHatchTemp(temp);
+    
+    if (incubation.getIncubationType() == INCUBATION_MANUAL && incubation.getCurrentStage() == STAGE_HATCHING) {
+        pidController.setSetpoint(temp);
+    }
+    updateWiFiStatus();
+    Serial.println("Manuel çıkım sıcaklığı güncellendi ve kaydedilecek: " + String(temp));
+}
+
+static void applyManualDevHumid(const WifiParameterValue& value) {
+    uint8_t humid = (uint8_t)value.number;
+    IncubationParameters params = incubation.getParameters();
+    incubation.setManualParameters(params.developmentTemp, params.hatchingTemp, humid, 
+                                 params.hatchingHumidity, params.developmentDays, params.hatchingDays);
+    storage.setManualDevHumid(humid);
+    
+    if (incubation.getIncubationType() == INCUBATION_MANUAL && incubation.getCurrentStage() == STAGE_DEVELOPMENT) {
+        hysteresisController.setSetpoint(humid);
+    }
+    updateWiFiStatus();
+    Serial.println("Manuel gelişim nemi güncellendi ve kaydedilecek: " + String(humid));
+}
+
+static void applyManualHatchHumid(const WifiParameterValue& value) {
+    uint8_t humid = (uint8_t)value.number;
+    IncubationParameters params = incubation.getParameters();
+    incubation.setManualParameters(params.developmentTemp, params.hatchingTemp, params.developmentHumidity, 
+                                 humid, params.developmentDays, params.hatchingDays);
+    storage.setManualHatchHumid(humid);
+    
+    if (incubation.getIncubationType() == INCUBATION_MANUAL && incubation.getCurrentStage() == STAGE_HATCHING) {
+        hysteresisController.setSetpoint(humid);
+    }
+    updateWiFiStatus();
+    Serial.println("Manuel çıkım nemi güncellendi ve kaydedilecek: " + String(humid));
+}
+
+static void applyManualDevDays(const WifiParameterValue& value) {
+    uint8_t days = (uint8_t)value.number;
+    IncubationParameters params = incubation.getParameters();
+    incubation.setManualParameters(params.developmentTemp, params.hatchingTemp, params.developmentHumidity, 
+                                 params.hatchingHumidity, days, params.hatchingDays);
+    storage.setManualDevDays(days);
+    updateWiFiStatus();
+    Serial.println("Manuel gelişim günleri güncellendi ve kaydedilecek: " + String(days));
+}
+
+static void applyManualHatchDays(const WifiParameterValue& value) {
+    uint8_t days = (uint8_t)value.number;
+    IncubationParameters params = incubation.getParameters();
+    incubation.setManualParameters(params.developmentTemp, params.hatchingTemp, params.developmentHumidity, 
+                                 params.hatchingHumidity, params.developmentDays, days);
+    storage.setManualHatchDays(days);
+    updateWiFiStatus();
+    Serial.println("Manuel çıkım günleri güncellendi ve kaydedilecek: " + String(days));
+}
+
+static void applyWifiStationSSID(const WifiParameterValue& value) {
+    storage.setStationSSID(*value.text);
+    updateWiFiStatus();
+    Serial.println("Station SSID güncellendi ve kaydedilecek: " + *value.text);
+}
+
+static void applyWifiStationPassword(const WifiParameterValue& value) {
+    storage.setStationPassword(*value.text);
+    updateWiFiStatus();
+    Serial.println("Station şifresi güncellendi ve kaydedilecek");
+}
+
+static void applyWifiMode(const WifiParameterValue& value) {
+    WiFiConnectionMode mode = value.flag ? WIFI_CONN_MODE_STATION : WIFI_CONN_MODE_AP;
+    storage.setWifiMode(mode);
+    updateWiFiStatus();
+    Serial.println("WiFi modu güncellendi ve kaydedilecek: " + String(mode));
+}
+
+// DİKKAT: Yeni parametre eklerken ada göre sıralı yere ekleyin (static_assert denetler)
+static constexpr WifiParameterDescriptor WIFI_PARAMETERS[] = {
+    // ad                     tip                  min     max                       kalıcılık                      uygulayıcı
+    { "alarmEnabled",         WIFI_PARAM_BOOL,      0.0f,   1.0f,                    WIFI_PARAM_PERSIST_STATE,    applyAlarmEnabled },
+    { "humidCalibration1",    WIFI_PARAM_FLOAT,   -20.0f,  20.0f,                    WIFI_PARAM_PERSIST_STATE,    applyHumidCalibration1 },
+    { "humidCalibration2",    WIFI_PARAM_FLOAT,   -20.0f,  20.0f,                    WIFI_PARAM_PERSIST_STATE,    applyHumidCalibration2 },
+    { "humidControlMode",     WIFI_PARAM_INT,       HUMID_CONTROL_HYSTERESIS, HUMID_CONTROL_PREDICTIVE, WIFI_PARAM_PERSIST_STATE,   applyHumidControlMode },
+    { "humidHighAlarm",       WIFI_PARAM_FLOAT,     1.0f,  20.0f,                    WIFI_PARAM_PERSIST_STATE,    applyHumidHighAlarm },
+    { "humidLowAlarm",        WIFI_PARAM_FLOAT,     1.0f,  20.0f,                    WIFI_PARAM_PERSIST_STATE,    applyHumidLowAlarm },
+    { "incubationType",       WIFI_PARAM_INT,       0.0f,   INCUBATION_MANUAL,       WIFI_PARAM_PERSIST_STATE,    applyIncubationType },
+    { "isIncubationRunning",  WIFI_PARAM_BOOL,      0.0f,   1.0f,                    WIFI_PARAM_PERSIST_STATE,    applyIsIncubationRunning },
+    { "manualDevDays",        WIFI_PARAM_INT,       1.0f,  60.0f,                    WIFI_PARAM_PERSIST_STATE,    applyManualDevDays },
+    { "manualDevHumid",       WIFI_PARAM_INT,      30.0f,  90.0f,                    WIFI_PARAM_PERSIST_STATE,    applyManualDevHumid },
+    { "manualDevTemp",        WIFI_PARAM_FLOAT,    20.0f,  40.0f,                    WIFI_PARAM_PERSIST_STATE,    applyManualDevTemp },
+    { "manualHatchDays",      WIFI_PARAM_INT,       1.0f,  10.0f,                    WIFI_PARAM_PERSIST_STATE,    applyManualHatchDays },
+    { "manualHatchHumid",     WIFI_PARAM_INT,      30.0f,  90.0f,                    WIFI_PARAM_PERSIST_STATE,    applyManualHatchHumid },
+    { "manualHatchTemp",      WIFI_PARAM_FLOAT,    20.0f,  40.0f,                    WIFI_PARAM_PERSIST_STATE,    applyManualHatchTemp },
+    { "motorRunTime",         WIFI_PARAM_INT,       1.0f, 300.0f,                    WIFI_PARAM_PERSIST_STATE,    applyMotorRunTime },
+    { "motorTest",            WIFI_PARAM_INT,       1.0f,  60.0f,                    WIFI_PARAM_PERSIST_COMMAND,  applyMotorTest },
+    { "motorWaitTime",        WIFI_PARAM_INT,       1.0f, 1440.0f,                   WIFI_PARAM_PERSIST_STATE,    applyMotorWaitTime },
+    { "pidFeedForward",       WIFI_PARAM_BOOL,      0.0f,   1.0f,                    WIFI_PARAM_PERSIST_RUNTIME,  applyPidFeedForward },
+    { "pidGainSchedule",      WIFI_PARAM_BOOL,      0.0f,   1.0f,                    WIFI_PARAM_PERSIST_SCHEDULE, applyPidGainSchedule },
+    { "pidKd",                WIFI_PARAM_FLOAT,     0.1f, 100.0f,                    WIFI_PARAM_PERSIST_STATE,    applyPidKd },
+    { "pidKi",                WIFI_PARAM_FLOAT,     0.01f, 10.0f,                    WIFI_PARAM_PERSIST_STATE,    applyPidKi },
+    { "pidKp",                WIFI_PARAM_FLOAT,     0.1f, 100.0f,                    WIFI_PARAM_PERSIST_STATE,    applyPidKp },
+    { "pidMode",              WIFI_PARAM_INT,       0.0f,   2.0f,                    WIFI_PARAM_PERSIST_STATE,    applyPidMode },
+    { "targetHumid",          WIFI_PARAM_FLOAT,    30.0f,  90.0f,                    WIFI_PARAM_PERSIST_STATE,    applyTargetHumid },
+    { "targetTemp",           WIFI_PARAM_FLOAT,    20.0f,  40.0f,                    WIFI_PARAM_PERSIST_STATE,    applyTargetTemp },
+    { "tempCalibration1",     WIFI_PARAM_FLOAT,   -10.0f,  10.0f,                    WIFI_PARAM_PERSIST_STATE,    applyTempCalibration1 },
+    { "tempCalibration2",     WIFI_PARAM_FLOAT,   -10.0f,  10.0f,                    WIFI_PARAM_PERSIST_STATE,    applyTempCalibration2 },
+    { "tempHighAlarm",        WIFI_PARAM_FLOAT,     0.1f,   5.0f,                    WIFI_PARAM_PERSIST_STATE,    applyTempHighAlarm },
+    { "tempLowAlarm",         WIFI_PARAM_FLOAT,     0.1f,   5.0f,                    WIFI_PARAM_PERSIST_STATE,    applyTempLowAlarm },
+    { "wifiMode",             WIFI_PARAM_BOOL,      0.0f,   1.0f,                    WIFI_PARAM_PERSIST_STATE,    applyWifiMode },
+    { "wifiStationPassword",  WIFI_PARAM_STRING,    0.0f,  64.0f,                    WIFI_PARAM_PERSIST_STATE,    applyWifiStationPassword },
+    { "wifiStationSSID",      WIFI_PARAM_STRING,    0.0f,  32.0f,                    WIFI_PARAM_PERSIST_STATE,    applyWifiStationSSID }
+};
+
+static constexpr size_t WIFI_PARAMETER_COUNT = sizeof(WIFI_PARAMETERS) / sizeof(WIFI_PARAMETERS[0]);
+
+// Derleme anında sıralama denetimi (C++11 uyumlu özyinelemeli constexpr)
+static constexpr int wifiParameterNameCompare(const char* a, const char* b) {
+    return (*a != *b || *a == '\0') ? (int)(uint8_t)*a - (int)(uint8_t)*b
+                                    : wifiParameterNameCompare(a + 1, b + 1);
+}
+
+static constexpr bool wifiParametersSorted(size_t index) {
+    return (index + 1 >= WIFI_PARAMETER_COUNT) ||
+           (wifiParameterNameCompare(WIFI_PARAMETERS[index].name, WIFI_PARAMETERS[index + 1].name) < 0 &&
+            wifiParametersSorted(index + 1));
+}
+
+static_assert(wifiParametersSorted(0), "WIFI_PARAMETERS ada gore sirali olmali");
+
+static const WifiParameterDescriptor* findWifiParameter(const char* name) {
+    size_t low = 0;
+    size_t high = WIFI_PARAMETER_COUNT;
+    
+    while (low < high) {
+        size_t mid = (low + high) / 2;
+        int cmp = strcmp(name, WIFI_PARAMETERS[mid].name);
+        if (cmp == 0) {
+            return &WIFI_PARAMETERS[mid];
+        }
+        if (cmp < 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
         }
     }
-    // Manuel kuluçka parametreleri
-    else if (param == "manualDevTemp") {
-        float temp = value.toFloat();
-        if (temp >= 20.0 && temp <= 40.0) {
-            IncubationParameters params = incubation.getParameters();
-            incubation.setManualParameters(temp, params.hatchingTemp, params.developmentHumidity, 
-                                         params.hatchingHumidity, params.developmentDays, params.hatchingDays);
-            storage.setManualDevTemp(temp);
-            
-            if (incubation.getIncubationType() == INCUBATION_MANUAL && incubation.getCurrentStage() == STAGE_DEVELOPMENT) {
-                pidController.setSetpoint(temp);
+    return nullptr;
+}
+
+// Metni tanımlayıcının tipine göre çözer ve aralığı denetler
+static bool parseWifiParameterValue(const WifiParameterDescriptor& descriptor, const String& text,
+                                    WifiParameterValue& value) {
+    value.number = 0.0f;
+    value.flag = false;
+    value.text = &text;
+    
+    switch (descriptor.type) {
+        case WIFI_PARAM_BOOL:
+            // Tüm çağıranlar bayrakları "1"/"0" olarak gönderir (JSON true/false
+            // toplu güncellemede bu biçime çevrilir); başka metin kabul edilmez
+            if (text == "1") {
+                value.flag = true;
+                value.number = 1.0f;
+                return true;
             }
-            updateWiFiStatus();
-            Serial.println("Manuel gelişim sıcaklığı güncellendi ve kaydedilecek: " + String(temp));
-        }
-    } else if (param == "manualHatchTemp") {
-        float temp = value.toFloat();
-        if (temp >= 20.0 && temp <= 40.0) {
-            IncubationParameters params = incubation.getParameters();
-            incubation.setManualParameters(params.developmentTemp, temp, params.developmentHumidity, 
-                                         params.hatchingHumidity, params.developmentDays, params.hatchingDays);
-            storage.setManualHatchTemp(temp);
+            return text == "0";
             
-            if (incubation.getIncubationType() == INCUBATION_MANUAL && incubation.getCurrentStage() == STAGE_HATCHING) {
-                pidController.setSetpoint(temp);
-            }
-            updateWiFiStatus();
-            Serial.println("Manuel çıkım sıcaklığı güncellendi ve kaydedilecek: " + String(temp));
-        }
-    } else if (param == "manualDevHumid") {
-        uint8_t humid = value.toInt();
-        if (humid >= 30 && humid <= 90) {
-            IncubationParameters params = incubation.getParameters();
-            incubation.setManualParameters(params.developmentTemp, params.hatchingTemp, humid, 
-                                         params.hatchingHumidity, params.developmentDays, params.hatchingDays);
-            storage.setManualDevHumid(humid);
+        case WIFI_PARAM_STRING:
+            return text.length() >= descriptor.minValue && text.length() <= descriptor.maxValue;
             
-            if (incubation.getIncubationType() == INCUBATION_MANUAL && incubation.getCurrentStage() == STAGE_DEVELOPMENT) {
-                hysteresisController.setSetpoint(humid);
+        default: {
+            // Sayısal parametreler: metin tamamen sayı olmalı ve aralıkta kalmalı
+            char* end = nullptr;
+            float number = strtof(text.c_str(), &end);
+            if (text.length() == 0 || end == nullptr || *end != '\0') {
+                return false;
             }
-            updateWiFiStatus();
-            Serial.println("Manuel gelişim nemi güncellendi ve kaydedilecek: " + String(humid));
+            if (descriptor.type == WIFI_PARAM_INT && number != (float)(long)number) {
+                return false;
+            }
+            value.number = number;
+            return number >= descriptor.minValue && number <= descriptor.maxValue;
         }
-    } else if (param == "manualHatchHumid") {
-        uint8_t humid = value.toInt();
-        if (humid >= 30 && humid <= 90) {
-            IncubationParameters params = incubation.getParameters();
-            incubation.setManualParameters(params.developmentTemp, params.hatchingTemp, params.developmentHumidity, 
-                                         humid, params.developmentDays, params.hatchingDays);
-            storage.setManualHatchHumid(humid);
+    }
+}
+
+void handleWifiParameterUpdate(String param, String value) {
+    const WifiParameterDescriptor* descriptor = findWifiParameter(param.c_str());
+    if (descriptor == nullptr) {
+        Serial.println("Bilinmeyen parametre: " + param);
+        return;
+    }
+    
+    WifiParameterValue parsed;
+    if (!parseWifiParameterValue(*descriptor, value, parsed)) {
+        Serial.println("Geçersiz parametre değeri: " + param + " = " + value + " (" +
+                       String(descriptor->minValue) + "-" + String(descriptor->maxValue) + " aralığında olmalı)");
+        return;
+    }
+    
+    descriptor->apply(parsed);
+    
+    switch (descriptor->persistence) {
+        case WIFI_PARAM_PERSIST_STATE:
+            // KRİTİK: PARAMETRE DEĞİŞİKLİKLERİ ANINDA KAYDEDİLECEK
+            // (toplu güncellemede kayıt commitWifiParameterBatch() ile bir kez yapılır)
+            if (!wifiParameterBatchActive) {
+                storage.saveStateNow();
+                Serial.println("!!! PARAMETRE DEĞİŞİKLİĞİ ANINDA KAYDEDİLDİ !!!");
+            }
+            break;
             
-            if (incubation.getIncubationType() == INCUBATION_MANUAL && incubation.getCurrentStage() == STAGE_HATCHING) {
-                hysteresisController.setSetpoint(humid);
+        case WIFI_PARAM_PERSIST_SCHEDULE:
+            if (wifiParameterBatchActive) {
+                wifiParameterBatchScheduleChanged = true;
+            } else {
+                storage.saveGainSchedule(pidController.getGainSchedule());
             }
-            updateWiFiStatus();
-            Serial.println("Manuel çıkım nemi güncellendi ve kaydedilecek: " + String(humid));
-        }
-    } else if (param == "manualDevDays") {
-        uint8_t days = value.toInt();
-        if (days >= 1 && days <= 60) {
-            IncubationParameters params = incubation.getParameters();
-            incubation.setManualParameters(params.developmentTemp, params.hatchingTemp, params.developmentHumidity, 
-                                         params.hatchingHumidity, days, params.hatchingDays);
-            storage.setManualDevDays(days);
-            updateWiFiStatus();
-            Serial.println("Manuel gelişim günleri güncellendi ve kaydedilecek: " + String(days));
-        }
-    } else if (param == "manualHatchDays") {
-        uint8_t days = value.toInt();
-        if (days >= 1 && days <= 10) {
-            IncubationParameters params = incubation.getParameters();
-            incubation.setManualParameters(params.developmentTemp, params.hatchingTemp, params.developmentHumidity, 
-                                         params.hatchingHumidity, params.developmentDays, days);
-            storage.setManualHatchDays(days);
-            updateWiFiStatus();
-            Serial.println("Manuel çıkım günleri güncellendi ve kaydedilecek: " + String(days));
-        }
+            break;
+            
+        default:
+            // Çalışma zamanı ayarları ve komutlar kaydedilmez
+            break;
     }
-    // WiFi ayarları
-    else if (param == "wifiStationSSID") {
-        storage.setStationSSID(value);
-        updateWiFiStatus();
-        Serial.println("Station SSID güncellendi ve kaydedilecek: " + value);
-    } else if (param == "wifiStationPassword") {
-        storage.setStationPassword(value);
-        updateWiFiStatus();
-        Serial.println("Station şifresi güncellendi ve kaydedilecek");
-    } else if (param == "wifiMode") {
-        WiFiConnectionMode mode = (value == "1") ? WIFI_CONN_MODE_STATION : WIFI_CONN_MODE_AP;
-        storage.setWifiMode(mode);
-        updateWiFiStatus();
-        Serial.println("WiFi modu güncellendi ve kaydedilecek: " + String(mode));
+}
+
+bool validateWifiParameter(const String& param, const String& value) {
+    const WifiParameterDescriptor* descriptor = findWifiParameter(param.c_str());
+    
+    // Bilinmeyen parametre veya motorTest gibi komutlar toplu güncellemeye girmez
+    if (descriptor == nullptr || descriptor->persistence == WIFI_PARAM_PERSIST_COMMAND) {
+        return false;
     }
     
-    // KRİTİK: TÜM PARAMETRE DEĞİŞİKLİKLERİ ANINDA KAYDEDİLECEK
-    if (criticalUpdate) {
-        storage.saveStateNow();
-        Serial.println("!!! PARAMETRE DEĞİŞİKLİĞİ ANINDA KAYDEDİLDİ !!!");
+    // Kazanç tablosu etkinken temel PID kazançları etkisiz kalacağından reddedilir
+    if (pidController.isGainScheduleEnabled() && strncmp(descriptor->name, "pidK", 4) == 0) {
+        return false;
     }
+    
+    WifiParameterValue parsed;
+    return parseWifiParameterValue(*descriptor, value, parsed);
+}
+
+// Parametre tablosunu JSON şema olarak yazar; yer yetmezse 0 döner
+size_t writeWifiParameterSchema(char* buffer, size_t size) {
+    size_t length = 0;
+    
+#define SCHEMA_APPEND(...) \
+    do { \
+        int written = snprintf(buffer + length, size - length, __VA_ARGS__); \
+        if (written < 0 || (size_t)written >= size - length) return 0; \
+        length += written; \
+    } while (0)
+    
+    // Her parametre [ad, tip, min, max, kalıcılık] dizisi olarak verilir
+    SCHEMA_APPEND("{\"count\":%u,\"parameters\":[", (unsigned)WIFI_PARAMETER_COUNT);
+    
+    for (size_t i = 0; i < WIFI_PARAMETER_COUNT; i++) {
+        const WifiParameterDescriptor& descriptor = WIFI_PARAMETERS[i];
+        SCHEMA_APPEND("%s[\"%s\",\"%s\",%g,%g,\"%s\"]", (i > 0) ? "," : "", descriptor.name,
+                      WIFI_PARAM_TYPE_NAMES[descriptor.type], (double)descriptor.minValue,
+                      (double)descriptor.maxValue, WIFI_PARAM_PERSISTENCE_NAMES[descriptor.persistence]);
+    }
+    
+    SCHEMA_APPEND("]}");
+    
+#undef SCHEMA_APPEND
+    
+    return length;
+}
+
+void beginWifiParameterBatch() {
+    wifiParameterBatchActive = true;
+    wifiParameterBatchScheduleChanged = false;
+    storage.beginTransaction();
+}
+
+void commitWifiParameterBatch() {
+    if (!wifiParameterBatchActive) {
+        return;
+    }
+    
+    wifiParameterBatchActive = false;
+    
+    if (wifiParameterBatchScheduleChanged) {
+        wifiParameterBatchScheduleChanged = false;
+        storage.saveGainSchedule(pidController.getGainSchedule());
+    }
+    
+    // Tüm değişiklikler için tek kayıt ve tek durum yayını
+    storage.commitTransaction();
+    updateWiFiStatus();
+    updateMenuWithCurrentStatus();
+    Serial.println("Toplu parametre güncellemesi tek seferde kaydedildi");
 }
@@ -8,6 +8,174 @@
 #include "alarm.h"  // AlarmManager için gerekli
 #include "pid.h"    // PIDController ve PIDMode için gerekli
 
+// *** Koşullu menü öğeleri ***
+
+static bool pidModeIs(PIDMode mode) {
+    extern PIDController pidController;
+    return pidController.getPIDMode() == mode;
+}
+
+static bool pidIsOff() { return pidModeIs(PID_MODE_OFF); }
+static bool pidIsNotOff() { return !pidModeIs(PID_MODE_OFF); }
+static bool pidIsNotManual() { return !pidModeIs(PID_MODE_MANUAL); }
+static bool pidIsAutoTune() { return pidModeIs(PID_MODE_AUTO_TUNE); }
+static bool pidIsNotAutoTune() { return !pidModeIs(PID_MODE_AUTO_TUNE); }
+
+static bool pidIsManualActive() {
+    extern PIDController pidController;
+    return pidController.isManualModeActive();
+}
+
+static bool pidIsManualStandby() {
+    return pidModeIs(PID_MODE_MANUAL) && !pidIsManualActive();
+}
+
+// PID parametreleri yalnızca manuel modda veya kapalı modda
+static bool pidParametersEditable() { return !pidModeIs(PID_MODE_AUTO_TUNE); }
+
+static bool alarmsEnabled() {
+    extern AlarmManager alarmManager;
+    return alarmManager.areAlarmsEnabled();
+}
+
+static bool alarmsDisabled() { return !alarmsEnabled(); }
+
+// *** Menü ağacı (flash) ***
+
+static constexpr MenuItem MAIN_MENU[] = {
+    {"Kulucka Tipleri", MENU_INCUBATION_TYPE, nullptr},
+    {"Sicaklik", MENU_TEMPERATURE, nullptr},
+    {"Nem", MENU_HUMIDITY, nullptr},
+    {"PID Modu", MENU_PID_MODE, nullptr},
+    {"Motor", MENU_MOTOR, nullptr},
+    {"Saat ve Tarih", MENU_TIME_DATE, nullptr},
+    {"Kalibrasyon", MENU_CALIBRATION, nullptr},
+    {"Alarm", MENU_ALARM, nullptr},
+    {"Sensor Degerleri", MENU_SENSOR_VALUES, nullptr},
+    {"Grafik", MENU_TREND, nullptr},
+    {"WiFi Ayarlari", MENU_WIFI_SETTINGS, nullptr},
+};
+
+// SADECE 4 TİP
+static constexpr MenuItem INCUBATION_TYPE_MENU[] = {
+    {"Tavuk", MENU_NONE, nullptr},
+    {"Bildircin", MENU_NONE, nullptr},
+    {"Kaz", MENU_NONE, nullptr},
+    {"Manuel", MENU_MANUAL_INCUBATION, nullptr},
+};
+
+// PID modu menüsü: mevcut moda göre görünen öğeler değişir
+static constexpr MenuItem PID_MODE_MENU[] = {
+    {"Mevcut Mod: Kapalı", MENU_NONE, pidIsOff},
+    {"Mevcut Mod: Manuel Aktif", MENU_NONE, pidIsManualActive},
+    {"Mevcut Mod: Manuel Beklemede", MENU_NONE, pidIsManualStandby},
+    {"Mevcut Mod: Otomatik Ayarlama", MENU_NONE, pidIsAutoTune},
+    {"Manuel PID Baslat", MENU_PID_MANUAL_START, pidIsNotManual},
+    {"Otomatik Ayarlama", MENU_PID_AUTO_TUNE, pidIsNotAutoTune},
+    {"PID'i Kapat", MENU_PID_OFF, pidIsNotOff},
+    {"PID Parametreleri", MENU_PID, pidParametersEditable},
+};
+
+static constexpr MenuItem PID_MANUAL_MENU[] = {
+    {"PID Kp", MENU_PID_KP, nullptr},
+    {"PID Ki", MENU_PID_KI, nullptr},
+    {"PID Kd", MENU_PID_KD, nullptr},
+    {"Manuel PID Baslat", MENU_PID_MANUAL_START, nullptr},
+};
+
+static constexpr MenuItem MOTOR_MENU[] = {
+    {"Bekleme Suresi", MENU_MOTOR_WAIT, nullptr},
+    {"Calisma Suresi", MENU_MOTOR_RUN, nullptr},
+    {"Motor Test", MENU_MOTOR_TEST, nullptr},
+};
+
+static constexpr MenuItem TIME_DATE_MENU[] = {
+    {"Saati ayarla", MENU_SET_TIME, nullptr},
+    {"Tarihi ayarla", MENU_SET_DATE, nullptr},
+};
+
+static constexpr MenuItem CALIBRATION_MENU[] = {
+    {"Sicaklik Kalibrasyon", MENU_CALIBRATION_TEMP, nullptr},
+    {"Nem Kalibrasyon", MENU_CALIBRATION_HUMID, nullptr},
+};
+
+static constexpr MenuItem TEMP_CALIBRATION_MENU[] = {
+    {"Sensor 1 Sicaklik", MENU_CALIBRATION_TEMP_1, nullptr},
+    {"Sensor 2 Sicaklik", MENU_CALIBRATION_TEMP_2, nullptr},
+};
+
+static constexpr MenuItem HUMID_CALIBRATION_MENU[] = {
+    {"Sensor 1 Nem", MENU_CALIBRATION_HUMID_1, nullptr},
+    {"Sensor 2 Nem", MENU_CALIBRATION_HUMID_2, nullptr},
+};
+
+// Alarm menüsü: ilk öğe alarm durumuna göre aç/kapat
+static constexpr MenuItem ALARM_MENU[] = {
+    {"Tum Alarmlari Kapat", MENU_ALARM_DISABLE_ALL, alarmsEnabled},
+    {"Tum Alarmlari Ac", MENU_ALARM_ENABLE_ALL, alarmsDisabled},
+    {"Sicaklik Alarmlari", MENU_ALARM_TEMP, nullptr},
+    {"Nem Alarmlari", MENU_ALARM_HUMID, nullptr},
+    {"Motor Alarmlari", MENU_ALARM_MOTOR, nullptr},
+};
+
+static constexpr MenuItem TEMP_ALARM_MENU[] = {
+    {"Dusuk Sicaklik", MENU_ALARM_TEMP_LOW, nullptr},
+    {"Yuksek Sicaklik", MENU_ALARM_TEMP_HIGH, nullptr},
+};
+
+static constexpr MenuItem HUMID_ALARM_MENU[] = {
+    {"Dusuk Nem", MENU_ALARM_HUMID_LOW, nullptr},
+    {"Yuksek Nem", MENU_ALARM_HUMID_HIGH, nullptr},
+};
+
+static constexpr MenuItem MANUAL_INCUBATION_MENU[] = {
+    {"Gelisim Sicakligi", MENU_MANUAL_DEV_TEMP, nullptr},
+    {"Cikim Sicakligi", MENU_MANUAL_HATCH_TEMP, nullptr},
+    {"Gelisim Nemi", MENU_MANUAL_DEV_HUMID, nullptr},
+    {"Cikim Nemi", MENU_MANUAL_HATCH_HUMID, nullptr},
+    {"Gelisim Gunleri", MENU_MANUAL_DEV_DAYS, nullptr},
+    {"Cikim Gunleri", MENU_MANUAL_HATCH_DAYS, nullptr},
+    {"Manuel Baslat", MENU_MANUAL_START, nullptr},
+};
+
+static constexpr MenuItem WIFI_MENU[] = {
+    {"WiFi Modu", MENU_WIFI_MODE, nullptr},
+    {"Ag Adi (SSID)", MENU_WIFI_SSID, nullptr},
+    {"Sifre", MENU_WIFI_PASSWORD, nullptr},
+    {"Baglan", MENU_WIFI_CONNECT, nullptr},
+};
+
+#define MENU_NODE(state, items) { state, items, sizeof(items) / sizeof(items[0]) }
+
+// Düğümler ağaç sırasında (üst menü alt menülerinden önce)
+static constexpr MenuNode MENU_TREE[] = {
+    MENU_NODE(MENU_MAIN, MAIN_MENU),
+    MENU_NODE(MENU_INCUBATION_TYPE, INCUBATION_TYPE_MENU),
+    MENU_NODE(MENU_MANUAL_INCUBATION, MANUAL_INCUBATION_MENU),
+    MENU_NODE(MENU_PID_MODE, PID_MODE_MENU),
+    MENU_NODE(MENU_PID, PID_MANUAL_MENU),
+    MENU_NODE(MENU_MOTOR, MOTOR_MENU),
+    MENU_NODE(MENU_TIME_DATE, TIME_DATE_MENU),
+    MENU_NODE(MENU_CALIBRATION, CALIBRATION_MENU),
+    MENU_NODE(MENU_CALIBRATION_TEMP, TEMP_CALIBRATION_MENU),
+    MENU_NODE(MENU_CALIBRATION_HUMID, HUMID_CALIBRATION_MENU),
+    MENU_NODE(MENU_ALARM, ALARM_MENU),
+    MENU_NODE(MENU_ALARM_TEMP, TEMP_ALARM_MENU),
+    MENU_NODE(MENU_ALARM_HUMID, HUMID_ALARM_MENU),
+    MENU_NODE(MENU_WIFI_SETTINGS, WIFI_MENU),
+};
+
+#undef MENU_NODE
+
+static constexpr uint8_t MENU_TREE_SIZE = sizeof(MENU_TREE) / sizeof(MENU_TREE[0]);
+
+// Her düğüm görünüm dizisine sığmalı
+static constexpr bool menuNodesFit(uint8_t index) {
+    return index >= MENU_TREE_SIZE ||
+           (MENU_TREE[index].count <= MENU_MAX_ITEMS && menuNodesFit(index + 1));
+}
+static_assert(menuNodesFit(0), "MENU_MAX_ITEMS en uzun menü için yetersiz");
+
 MenuManager::MenuManager() {
     _currentState = MENU_NONE;
     _previousState = MENU_NONE;
@@ -23,161 +191,58 @@ MenuManager::MenuManager() {
     _timeField = 0;
     _dateField = 0;
     _lastInteractionTime = 0;
+    _trendSpan = TREND_SPAN_1H;
     _menuChanged = true;
     _menuOffset = 0;
     
-    // Menü öğelerini başlat
-    _initializeMenuItems();
+    // Menü ağacı dizinlerini üret
+    _buildMenuIndex();
 }
 
 bool MenuManager::begin() {
     return true;
 }
 
-void MenuManager::_initializeMenuItems() {
-    // Ana menü öğeleri
-    _mainMenuItems.clear();
-    _mainMenuItems.push_back({"Kulucka Tipleri", MENU_INCUBATION_TYPE});
-    _mainMenuItems.push_back({"Sicaklik", MENU_TEMPERATURE});
-    _mainMenuItems.push_back({"Nem", MENU_HUMIDITY});
-    _mainMenuItems.push_back({"PID Modu", MENU_PID_MODE});
-    _mainMenuItems.push_back({"Motor", MENU_MOTOR});
-    _mainMenuItems.push_back({"Saat ve Tarih", MENU_TIME_DATE});
-    _mainMenuItems.push_back({"Kalibrasyon", MENU_CALIBRATION});
-    _mainMenuItems.push_back({"Alarm", MENU_ALARM});
-    _mainMenuItems.push_back({"Sensor Degerleri", MENU_SENSOR_VALUES});
-    _mainMenuItems.push_back({"WiFi Ayarlari", MENU_WIFI_SETTINGS});
-    
-    // Kuluçka tipleri alt menüsü öğeleri - SADECE 4 TİP
-    _incubationTypeItems.clear();
-    _incubationTypeItems.push_back({"Tavuk", MENU_NONE});
-    _incubationTypeItems.push_back({"Bildircin", MENU_NONE});
-    _incubationTypeItems.push_back({"Kaz", MENU_NONE});
-    _incubationTypeItems.push_back({"Manuel", MENU_MANUAL_INCUBATION});
-    
-    // PID ayarları alt menüsü öğeleri (dinamik olarak güncellenecek)
-    updatePIDMenuItems();
-    
-    // PID manuel ayar alt menüsü öğeleri
-    _pidManualItems.clear();
-    _pidManualItems.push_back({"PID Kp", MENU_PID_KP});
-    _pidManualItems.push_back({"PID Ki", MENU_PID_KI});
-    _pidManualItems.push_back({"PID Kd", MENU_PID_KD});
-    _pidManualItems.push_back({"Manuel PID Baslat", MENU_PID_MANUAL_START});
-    
-    // Motor alt menüsü öğeleri
-    _motorItems.clear();
-    _motorItems.push_back({"Bekleme Suresi", MENU_MOTOR_WAIT});
-    _motorItems.push_back({"Calisma Suresi", MENU_MOTOR_RUN});
-    _motorItems.push_back({"Motor Test", MENU_MOTOR_TEST});
-    
-    // Saat ve tarih alt menüsü öğeleri
-    _timeDateItems.clear();
-    _timeDateItems.push_back({"Saati ayarla", MENU_SET_TIME});
-    _timeDateItems.push_back({"Tarihi ayarla", MENU_SET_DATE});
-    
-    // Kalibrasyon alt menüsü öğeleri
-    _calibrationItems.clear();
-    _calibrationItems.push_back({"Sicaklik Kalibrasyon", MENU_CALIBRATION_TEMP});
-    _calibrationItems.push_back({"Nem Kalibrasyon", MENU_CALIBRATION_HUMID});
-    
-    // Sıcaklık kalibrasyon alt menüsü öğeleri
-    _tempCalibrationItems.clear();
-    _tempCalibrationItems.push_back({"Sensor 1 Sicaklik", MENU_CALIBRATION_TEMP_1});
-    _tempCalibrationItems.push_back({"Sensor 2 Sicaklik", MENU_CALIBRATION_TEMP_2});
-    
-    // Nem kalibrasyon alt menüsü öğeleri
-    _humidCalibrationItems.clear();
-    _humidCalibrationItems.push_back({"Sensor 1 Nem", MENU_CALIBRATION_HUMID_1});
-    _humidCalibrationItems.push_back({"Sensor 2 Nem", MENU_CALIBRATION_HUMID_2});
-    
-    // Alarm alt menüsü öğeleri (dinamik olarak güncellenecek)
-    updateAlarmMenuItems();
-    
-    // Sıcaklık alarm alt menüsü öğeleri
-    _tempAlarmItems.clear();
-    _tempAlarmItems.push_back({"Dusuk Sicaklik", MENU_ALARM_TEMP_LOW});
-    _tempAlarmItems.push_back({"Yuksek Sicaklik", MENU_ALARM_TEMP_HIGH});
-    
-    // Nem alarm alt menüsü öğeleri
-    _humidAlarmItems.clear();
-    _humidAlarmItems.push_back({"Dusuk Nem", MENU_ALARM_HUMID_LOW});
-    _humidAlarmItems.push_back({"Yuksek Nem", MENU_ALARM_HUMID_HIGH});
-    
-    // Manuel kuluçka alt menüsü öğeleri
-    _manualIncubationItems.clear();
-    _manualIncubationItems.push_back({"Gelisim Sicakligi", MENU_MANUAL_DEV_TEMP});
-    _manualIncubationItems.push_back({"Cikim Sicakligi", MENU_MANUAL_HATCH_TEMP});
-    _manualIncubationItems.push_back({"Gelisim Nemi", MENU_MANUAL_DEV_HUMID});
-    _manualIncubationItems.push_back({"Cikim Nemi", MENU_MANUAL_HATCH_HUMID});
-    _manualIncubationItems.push_back({"Gelisim Gunleri", MENU_MANUAL_DEV_DAYS});
-    _manualIncubationItems.push_back({"Cikim Gunleri", MENU_MANUAL_HATCH_DAYS});
-    _manualIncubationItems.push_back({"Manuel Baslat", MENU_MANUAL_START});
-    
-    // WiFi ayarları alt menüsü öğeleri (dinamik olarak güncellenecek)
-    updateWiFiMenuItems();
-}
-
-void MenuManager::updatePIDMenuItems() {
-    // External PID controller referansını al
-    extern PIDController pidController;
-    
-    _pidItems.clear();
-    
-    // Mevcut PID modunu göster
-    String currentModeStr = pidController.getPIDModeString();
-    _pidItems.push_back({"Mevcut Mod: " + currentModeStr, MENU_NONE});
-    
-    // PID mod değiştirme seçenekleri
-    if (pidController.getPIDMode() != PID_MODE_MANUAL) {
-        _pidItems.push_back({"Manuel PID Baslat", MENU_PID_MANUAL_START});
-    }
-    
-    if (pidController.getPIDMode() != PID_MODE_AUTO_TUNE) {
-        _pidItems.push_back({"Otomatik Ayarlama", MENU_PID_AUTO_TUNE});
+void MenuManager::_buildMenuIndex() {
+    for (int state = 0; state < MENU_STATE_COUNT; state++) {
+        _nodeIndex[state] = -1;
+        _parentState[state] = MENU_MAIN; // Ağaçta üstü olmayan durumlar ana menüye döner
     }
     
-    if (pidController.getPIDMode() != PID_MODE_OFF) {
-        _pidItems.push_back({"PID'i Kapat", MENU_PID_OFF});
+    // Düğümler ağaç sırasında gezilir; birden fazla menüden açılan bir durumun
+    // üstü, onu ilk listeleyen menüdür
+    for (uint8_t node = 0; node < MENU_TREE_SIZE; node++) {
+        _nodeIndex[MENU_TREE[node].state] = node;
     }
-    
-    // PID parametreleri menüsü (sadece manuel modda veya kapalı modda)
-    if (pidController.getPIDMode() == PID_MODE_MANUAL || pidController.getPIDMode() == PID_MODE_OFF) {
-        _pidItems.push_back({"PID Parametreleri", MENU_PID});
+    for (int node = MENU_TREE_SIZE - 1; node >= 0; node--) {
+        for (uint8_t i = 0; i < MENU_TREE[node].count; i++) {
+            MenuState child = MENU_TREE[node].items[i].nextState;
+            if (child != MENU_NONE) {
+                _parentState[child] = MENU_TREE[node].state;
+            }
+        }
     }
-    
+}
+
+void MenuManager::updatePIDMenuItems() {
+    // Koşullu öğeler her okumada değerlendirilir; yalnızca yeniden çizim iste
     _menuChanged = true;
 }
 
 void MenuManager::updateWiFiMenuItems() {
-    _wifiItems.clear();
-    _wifiItems.push_back({"WiFi Modu", MENU_WIFI_MODE});
-    _wifiItems.push_back({"Ag Adi (SSID)", MENU_WIFI_SSID});
-    _wifiItems.push_back({"Sifre", MENU_WIFI_PASSWORD});
-    _wifiItems.push_back({"Baglan", MENU_WIFI_CONNECT});
+    // WiFi menüsü sabit; durum ekranları kendi değerlerini okur
 }
 
 void MenuManager::updateAlarmMenuItems() {
     // External referanslar ile alarm durumunu al
     extern AlarmManager alarmManager;
     
-    // Alarm ana menü öğelerini dinamik olarak güncelle
-    bool alarmsEnabled = alarmManager.areAlarmsEnabled();
-    String alarmToggleText = alarmsEnabled ? "Tum Alarmlari Kapat" : "Tum Alarmlari Ac";
-    MenuState alarmToggleState = alarmsEnabled ? MENU_ALARM_DISABLE_ALL : MENU_ALARM_ENABLE_ALL;
-    
-    _alarmItems.clear();
-    _alarmItems.push_back({alarmToggleText, alarmToggleState});
-    _alarmItems.push_back({"Sicaklik Alarmlari", MENU_ALARM_TEMP});
-    _alarmItems.push_back({"Nem Alarmlari", MENU_ALARM_HUMID});
-    _alarmItems.push_back({"Motor Alarmlari", MENU_ALARM_MOTOR});
-    
     _menuChanged = true; // Menünün yeniden çizilmesini sağla
     
-    Serial.println("Alarm menü öğeleri güncellendi. Mevcut durum: " + String(alarmsEnabled ? "AÇIK" : "KAPALI"));
+    Serial.println("Alarm menü öğeleri güncellendi. Mevcut durum: " + String(alarmManager.areAlarmsEnabled() ? "AÇIK" : "KAPALI"));
 }
 
-void MenuManager::update(JoystickDirection direction) {
+void MenuManager::update(JoystickDirection direction, uint16_t repeatCount) {
     updateInteractionTime();
     
     if (direction == JOYSTICK_NONE) {
@@ -210,11 +275,11 @@ void MenuManager::update(JoystickDirection direction) {
     if (_currentState == MENU_ADJUST_VALUE) {
         switch (direction) {
             case JOYSTICK_UP:
-                _adjustValue += _stepValue;
+                _adjustValue += _adjustStepForRepeat(repeatCount);
                 if (_adjustValue > _maxValue) _adjustValue = _maxValue;
                 break;
             case JOYSTICK_DOWN:
-                _adjustValue -= _stepValue;
+                _adjustValue -= _adjustStepForRepeat(repeatCount);
                 if (_adjustValue < _minValue) _adjustValue = _minValue;
                 break;
             case JOYSTICK_LEFT:
@@ -236,7 +301,11 @@ void MenuManager::update(JoystickDirection direction) {
     
     // Terminal menüler (ayar ekranları) - sadece geri dönüş izni
     if (_isTerminalMenu(_currentState)) {
-        if (direction == JOYSTICK_LEFT) {
+        if (_currentState == MENU_TREND && (direction == JOYSTICK_UP || direction == JOYSTICK_DOWN)) {
+            // Trend grafiği: aralıklar arasında döngüsel geçiş (1s -> 6s -> 24s)
+            int step = (direction == JOYSTICK_DOWN) ? 1 : TREND_SPAN_COUNT - 1;
+            _trendSpan = (TrendSpan)((_trendSpan + step) % TREND_SPAN_COUNT);
+        } else if (direction == JOYSTICK_LEFT) {
             MenuState backState = _getBackState(_currentState);
             _currentState = backState;
             _selectedIndex = 0;
@@ -250,7 +319,7 @@ void MenuManager::update(JoystickDirection direction) {
     }
     
     // Normal menü navigasyonu
-    std::vector<MenuItem> currentItems = _getCurrentMenuItems();
+    const MenuView& currentItems = _getCurrentMenuItems();
     
     if (currentItems.empty()) {
         if (_currentState != MENU_MAIN) {
@@ -317,10 +386,10 @@ void MenuManager::update(JoystickDirection direction) {
 }
 
 void MenuManager::_updateMenuOffset() {
-    const int maxVisibleItems = 6; // Ekranda maksimum görünebilir öğe sayısı
+    const int maxVisibleItems = MENU_VISIBLE_ITEMS; // Ekranda maksimum görünebilir öğe sayısı
     
     // DÜZELTME: Mevcut menü öğe sayısını al
-    std::vector<MenuItem> currentItems = _getCurrentMenuItems();
+    const MenuView& currentItems = _getCurrentMenuItems();
     int itemCount = currentItems.size();
     
     // DÜZELTME: Boş menü kontrolü
@@ -387,6 +456,7 @@ bool MenuManager::_isTerminalMenu(MenuState state) const {
         case MENU_ALARM_HUMID_HIGH:
         case MENU_ALARM_MOTOR:
         case MENU_SENSOR_VALUES:
+        case MENU_TREND:
         case MENU_MANUAL_DEV_TEMP:
         case MENU_MANUAL_HATCH_TEMP:
         case MENU_MANUAL_DEV_HUMID:
@@ -405,78 +475,11 @@ bool MenuManager::_isTerminalMenu(MenuState state) const {
 }
 
 MenuState MenuManager::_getBackState(MenuState currentState) {
-    switch (currentState) {
-        case MENU_INCUBATION_TYPE:
-        case MENU_PID_MODE:
-        case MENU_MOTOR:
-        case MENU_TIME_DATE:
-        case MENU_CALIBRATION:
-        case MENU_ALARM:
-        case MENU_SENSOR_VALUES:
-        case MENU_WIFI_SETTINGS:
-            return MENU_MAIN;
-            
-        case MENU_PID:
-        case MENU_PID_AUTO_TUNE:
-        case MENU_PID_MANUAL_START:
-        case MENU_PID_OFF:
-            return MENU_PID_MODE;
-            
-        case MENU_MOTOR_WAIT:
-        case MENU_MOTOR_RUN:
-        case MENU_MOTOR_TEST:
-            return MENU_MOTOR;
-            
-        case MENU_SET_TIME:
-        case MENU_SET_DATE:
-            return MENU_TIME_DATE;
-            
-        case MENU_CALIBRATION_TEMP:
-        case MENU_CALIBRATION_HUMID:
-            return MENU_CALIBRATION;
-            
-        case MENU_CALIBRATION_TEMP_1:
-        case MENU_CALIBRATION_TEMP_2:
-            return MENU_CALIBRATION_TEMP;
-            
-        case MENU_CALIBRATION_HUMID_1:
-        case MENU_CALIBRATION_HUMID_2:
-            return MENU_CALIBRATION_HUMID;
-            
-        case MENU_ALARM_ENABLE_ALL:    // YENİ EKLENDİ
-        case MENU_ALARM_DISABLE_ALL:   // YENİ EKLENDİ
-        case MENU_ALARM_TEMP:
-        case MENU_ALARM_HUMID:
-        case MENU_ALARM_MOTOR:
-            return MENU_ALARM;
-            
-        case MENU_ALARM_TEMP_LOW:
-        case MENU_ALARM_TEMP_HIGH:
-            return MENU_ALARM_TEMP;
-            
-        case MENU_ALARM_HUMID_LOW:
-        case MENU_ALARM_HUMID_HIGH:
-            return MENU_ALARM_HUMID;
-            
-        case MENU_MANUAL_INCUBATION:
-        case MENU_MANUAL_DEV_TEMP:
-        case MENU_MANUAL_HATCH_TEMP:
-        case MENU_MANUAL_DEV_HUMID:
-        case MENU_MANUAL_HATCH_HUMID:
-        case MENU_MANUAL_DEV_DAYS:
-        case MENU_MANUAL_HATCH_DAYS:
-        case MENU_MANUAL_START:
-            return MENU_INCUBATION_TYPE;
-            
-        case MENU_WIFI_MODE:
-        case MENU_WIFI_SSID:
-        case MENU_WIFI_PASSWORD:
-        case MENU_WIFI_CONNECT:
-            return MENU_WIFI_SETTINGS;
-            
-        default:
-            return MENU_MAIN;
+    // Üst durum menü ağacından üretilen dizinden okunur
+    if (currentState < 0 || currentState >= MENU_STATE_COUNT) {
+        return MENU_MAIN;
     }
+    return _parentState[currentState];
 }
 
 MenuState MenuManager::getCurrentState() const {
@@ -512,6 +515,17 @@ void MenuManager::showValueAdjustScreen(String title, float value, String unit,
     Serial.println("Değer ayarlama ekranı açıldı: " + title + " (Önceki: " + String(_previousState) + ")");
 }
 
+float MenuManager::_adjustStepForRepeat(uint16_t repeatCount) const {
+    // Basılı tutma uzadıkça adım büyür: önce tek tek, sonra 5'er, sonra 10'ar
+    if (repeatCount >= ADJUST_ACCEL_X10_REPEATS) {
+        return _stepValue * 10;
+    }
+    if (repeatCount >= ADJUST_ACCEL_X5_REPEATS) {
+        return _stepValue * 5;
+    }
+    return _stepValue;
+}
+
 void MenuManager::showTimeAdjustScreen(String title, int timeValue) {
     _previousState = MENU_TIME_DATE;  // HER ZAMAN TIME_DATE menüsünden geldiğimizi garanti et
     _currentState = MENU_SET_TIME;
@@ -590,15 +604,8 @@ void MenuManager::showConfirmation(String message) {
     // Şimdilik sadece tanımlandı
 }
 
-std::vector<String> MenuManager::getMenuItems() const {
-    std::vector<String> items;
-    std::vector<MenuItem> currentItems = _getCurrentMenuItems();
-    
-    for (const MenuItem& item : currentItems) {
-        items.push_back(item.name);
-    }
-    
-    return items;
+const MenuView& MenuManager::getCurrentMenuItems() const {
+    return _getCurrentMenuItems();
 }
 
 int MenuManager::getSelectedIndex() const {
@@ -610,7 +617,7 @@ int MenuManager::getMenuOffset() const {
 }
 
 bool MenuManager::selectMenuItem(int index) {
-    std::vector<MenuItem> currentItems = _getCurrentMenuItems();
+    const MenuView& currentItems = _getCurrentMenuItems();
     
     if (index >= 0 && index < currentItems.size()) {
         _selectedIndex = index;
@@ -663,6 +670,10 @@ bool MenuManager::isInDateAdjustScreen() const {
     return _currentState == MENU_SET_DATE;
 }
 
+TrendSpan MenuManager::getTrendSpan() const {
+    return _trendSpan;
+}
+
 unsigned long MenuManager::getLastInteractionTime() const {
     return _lastInteractionTime;
 }
@@ -682,7 +693,7 @@ void MenuManager::setCurrentState(MenuState state) {
 
 void MenuManager::setSelectedIndex(int index) {
     // İndeksin geçerli aralıkta olduğundan emin ol
-    std::vector<MenuItem> currentItems = _getCurrentMenuItems();
+    const MenuView& currentItems = _getCurrentMenuItems();
     
     if (!currentItems.empty() && index >= 0 && index < currentItems.size()) {
         _selectedIndex = index;
@@ -839,38 +850,21 @@ void MenuManager::_validateDateValue() {
     Serial.println("Tarih doğrulama: " + String(day) + "/" + String(month) + "/" + String(year));
 }
 
-std::vector<MenuItem> MenuManager::_getCurrentMenuItems() const {
-    switch (_currentState) {
-        case MENU_MAIN:
-            return _mainMenuItems;
-        case MENU_INCUBATION_TYPE:
-            return _incubationTypeItems;
-        case MENU_TIME_DATE:
-            return _timeDateItems;
-        case MENU_CALIBRATION:
-            return _calibrationItems;
-        case MENU_CALIBRATION_TEMP:
-            return _tempCalibrationItems;
-        case MENU_CALIBRATION_HUMID:
-            return _humidCalibrationItems;
-        case MENU_ALARM:
-            return _alarmItems;
-        case MENU_ALARM_TEMP:
-            return _tempAlarmItems;
-        case MENU_ALARM_HUMID:
-            return _humidAlarmItems;
-        case MENU_MOTOR:
-            return _motorItems;
-        case MENU_MANUAL_INCUBATION:
-            return _manualIncubationItems;
-        case MENU_PID_MODE:
-            return _pidItems;
-        case MENU_PID:
-            return _pidManualItems;
-        case MENU_WIFI_SETTINGS:
-            return _wifiItems;
-        // Terminal menü durumları için boş vector döndür
-        default:
-            return std::vector<MenuItem>(); // Boş liste
+const MenuView& MenuManager::_getCurrentMenuItems() const {
+    _view.count = 0;
+    
+    // Terminal menü durumları için boş liste
+    int8_t node = _nodeIndex[_currentState];
+    if (node < 0) {
+        return _view;
     }
-}
\ No newline at end of file
+    
+    // Koşulu sağlanan öğelerin işaretçileri (öğeler flash'ta kalır)
+    const MenuNode& menu = MENU_TREE[node];
+    for (uint8_t i = 0; i < menu.count; i++) {
+        if (menu.items[i].visible == nullptr || menu.items[i].visible()) {
+            _view.items[_view.count++] = &menu.items[i];
+        }
+    }
+    return _view;
+}
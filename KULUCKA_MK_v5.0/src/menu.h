@@ -8,9 +8,9 @@
 #define MENU_H
 
 #include <Arduino.h>
-#include <vector>
 #include "config.h"
 #include "joystick.h"
+#include "sensor_history.h"
 
 // Menü durumları
 enum MenuState {
@@ -55,6 +55,7 @@ enum MenuState {
     MENU_ALARM_HUMID_HIGH,  // Yüksek nem alarm ekranı
     MENU_ALARM_MOTOR,       // Motor alarm ayarları alt menüsü
     MENU_SENSOR_VALUES,     // Sensör değerleri görüntüleme
+    MENU_TREND,             // Sıcaklık/nem trend grafiği
     MENU_MANUAL_INCUBATION, // Manuel kuluçka ayarları alt menüsü
     MENU_MANUAL_DEV_TEMP,   // Manuel gelişim sıcaklığı ekranı
     MENU_MANUAL_HATCH_TEMP, // Manuel çıkım sıcaklığı ekranı
@@ -68,13 +69,35 @@ enum MenuState {
     MENU_WIFI_MODE,         // WiFi modu seçimi (AP/Station)
     MENU_WIFI_SSID,         // WiFi SSID ayarlama
     MENU_WIFI_PASSWORD,     // WiFi Password ayarlama
-    MENU_WIFI_CONNECT       // WiFi bağlantı ekranı
+    MENU_WIFI_CONNECT,      // WiFi bağlantı ekranı
+    MENU_STATE_COUNT        // Durum sayısı (dizin tabloları için)
 };
 
-// Menü öğesi yapısı
+// Dinamik öğeler için görünürlük koşulu (nullptr: her zaman görünür)
+typedef bool (*MenuItemCondition)();
+
+// Menü öğesi yapısı (flash'ta sabit)
 struct MenuItem {
-    String name;           // Menü öğesi adı
-    MenuState nextState;   // Bu öğeye tıklayınca geçilecek menü durumu
+    const char* label;            // Menü öğesi adı
+    MenuState nextState;          // Bu öğeye tıklayınca geçilecek menü durumu
+    MenuItemCondition visible;    // Görünürlük koşulu
+};
+
+// Menü ağacı düğümü: bir menü durumunun öğe listesi
+struct MenuNode {
+    MenuState state;
+    const MenuItem* items;
+    uint8_t count;
+};
+
+// O anda görünen öğeler (koşullar uygulanmış, öğelerin kendisi flash'ta)
+struct MenuView {
+    const MenuItem* items[MENU_MAX_ITEMS];
+    uint8_t count;
+    
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const MenuItem& operator[](size_t index) const { return *items[index]; }
 };
 
 class MenuManager {
@@ -85,8 +108,8 @@ public:
     // Menü yönetimini başlat
     bool begin();
     
-    // Menüyü güncelle
-    void update(JoystickDirection direction);
+    // Menüyü güncelle (repeatCount: basılı tutarken kaçıncı otomatik tekrar)
+    void update(JoystickDirection direction, uint16_t repeatCount = 0);
     
     // Mevcut menü durumunu al
     MenuState getCurrentState() const;
@@ -142,8 +165,8 @@ public:
     // Onay mesajı göster
     void showConfirmation(String message);
     
-    // Menü listesini al
-    std::vector<String> getMenuItems() const;
+    // Mevcut menünün görünen öğeleri (bellek ayırmaz; terminal durumlarda boş)
+    const MenuView& getCurrentMenuItems() const;
     
     // Seçili menü öğesi indeksini al
     int getSelectedIndex() const;
@@ -175,16 +198,19 @@ public:
     // Kullanıcı etkileşimi son ne zaman oldu?
     unsigned long getLastInteractionTime() const;
     
+    // Trend grafiğinde seçili zaman aralığı
+    TrendSpan getTrendSpan() const;
+    
     // Zamanı güncelle
     void updateInteractionTime();
     
-    // PID durumu için menü öğelerini güncelle (YENİDEN YAPILANDIRILDI)
+    // PID durumu değişti: koşullu öğeler yeniden değerlendirilir
     void updatePIDMenuItems();
     
-    // WiFi durumu için menü öğelerini güncelle
+    // WiFi durumu değişti
     void updateWiFiMenuItems();
 
-    // Alarm durumu için menü öğelerini güncelle 
+    // Alarm durumu değişti: koşullu öğeler yeniden değerlendirilir
     void updateAlarmMenuItems();    
 
     // Geri dönüş durumunu al 
@@ -203,47 +229,12 @@ private:
     // Menü kaydırma offset'i
     int _menuOffset;
     
-    // Ana menü öğeleri
-    std::vector<MenuItem> _mainMenuItems;
-    
-    // Kuluçka tipleri alt menüsü öğeleri
-    std::vector<MenuItem> _incubationTypeItems;
-    
-    // Saat ve tarih alt menüsü öğeleri
-    std::vector<MenuItem> _timeDateItems;
-    
-    // Kalibrasyon alt menüsü öğeleri
-    std::vector<MenuItem> _calibrationItems;
-    
-    // Sıcaklık kalibrasyon alt menüsü öğeleri
-    std::vector<MenuItem> _tempCalibrationItems;
+    // Menü ağacından üretilen dizinler: durum -> düğüm, durum -> üst durum
+    int8_t _nodeIndex[MENU_STATE_COUNT];
+    MenuState _parentState[MENU_STATE_COUNT];
     
-    // Nem kalibrasyon alt menüsü öğeleri
-    std::vector<MenuItem> _humidCalibrationItems;
-    
-    // Alarm alt menüsü öğeleri
-    std::vector<MenuItem> _alarmItems;
-    
-    // Sıcaklık alarm alt menüsü öğeleri
-    std::vector<MenuItem> _tempAlarmItems;
-    
-    // Nem alarm alt menüsü öğeleri
-    std::vector<MenuItem> _humidAlarmItems;
-    
-    // Motor alt menüsü öğeleri
-    std::vector<MenuItem> _motorItems;
-    
-    // Manuel kuluçka alt menüsü öğeleri
-    std::vector<MenuItem> _manualIncubationItems;
-    
-    // PID ana menü öğeleri (YENİDEN YAPILANDIRILDI)
-    std::vector<MenuItem> _pidItems;
-    
-    // PID manuel ayar alt menüsü öğeleri
-    std::vector<MenuItem> _pidManualItems;
-    
-    // WiFi ayarları alt menüsü öğeleri
-    std::vector<MenuItem> _wifiItems;
+    // Görünen öğeler (her okumada koşullar yeniden değerlendirilir)
+    mutable MenuView _view;
     
     // Değer ayarlama
     float _adjustValue;
@@ -265,11 +256,17 @@ private:
     // Son kullanıcı etkileşim zamanı
     unsigned long _lastInteractionTime;
     
-    // Menü bölmelerini başlat
-    void _initializeMenuItems();
+    // Trend grafiği aralığı (yukarı/aşağı ile değişir)
+    TrendSpan _trendSpan;
+    
+    // Menü ağacı dizinlerini üret
+    void _buildMenuIndex();
     
     // Mevcut durum için menü öğelerini al
-    std::vector<MenuItem> _getCurrentMenuItems() const;
+    const MenuView& _getCurrentMenuItems() const;
+
+    // Otomatik tekrar sayısına göre hızlandırılmış ayar adımı
+    float _adjustStepForRepeat(uint16_t repeatCount) const;
 
     // Geri dönüş durumunu belirle
     MenuState _getBackState(MenuState currentState);
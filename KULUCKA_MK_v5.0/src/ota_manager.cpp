@@ -1,16 +1,34 @@
 #include "ota_manager.h"
 #include <esp_ota_ops.h>
+#include <esp_heap_caps.h>
 
 // FIRMWARE_VERSION tanımlaması kaldırıldı - config.h'tan gelecek
 
+// Yazıcı her zaman blok sınırından okur; halka blok katı olunca bloklar bitişik kalır
+static_assert(OTA_RING_BUFFER_SIZE % OTA_BLOCK_SIZE == 0, "OTA_RING_BUFFER_SIZE, OTA_BLOCK_SIZE'ın katı olmalı");
+
 OTAManager::OTAManager() {
     _state = OTA_IDLE;
     _totalSize = 0;
+    _sizeHint = 0;
     _writtenSize = 0;
+    _receivedSize = 0;
+    _sha256Hex[0] = '\0';
     _storage = nullptr;
     _watchdog = nullptr;
     _updateStartTime = 0;
     _lastProgressReport = 0;
+    _partition = nullptr;
+    _otaHandle = 0;
+    _ring = nullptr;
+    _ringHead.store(0);
+    _ringTail.store(0);
+    _writerTask = nullptr;
+    _writerRunning.store(false);
+    _inputClosed.store(false);
+    _abortRequested.store(false);
+    _writerFailed.store(false);
+    _writerError = ESP_OK;
 }
 
 bool OTAManager::begin() {
@@ -32,13 +50,21 @@ bool OTAManager::begin() {
     return true;
 }
 
-bool OTAManager::startUpdate(size_t contentLength, String md5) {
+bool OTAManager::startUpdate(size_t contentLength, String md5, String sha256, size_t sizeHint) {
     if (_state == OTA_UPLOADING) {
         _errorMessage = "Güncelleme zaten devam ediyor";
         return false;
     }
     
-    if (contentLength < MIN_FIRMWARE_SIZE || contentLength > MAX_FIRMWARE_SIZE) {
+    // Önceki denemenin yazıcısı flash yazımında takılı kaldıysa yeni boru hattı kurulmaz
+    if (!_reapWriter()) {
+        _errorMessage = "Önceki yazıcı görev henüz sonlanmadı";
+        _state = OTA_ERROR;
+        return false;
+    }
+    
+    // Multipart yüklemede boyut başta bilinmez (0); sınırlar yazarken ve sonda denetlenir
+    if (contentLength != 0 && (contentLength < MIN_FIRMWARE_SIZE || contentLength > MAX_FIRMWARE_SIZE)) {
         _errorMessage = "Geçersiz firmware boyutu: " + String(contentLength);
         _state = OTA_ERROR;
         return false;
@@ -59,21 +85,65 @@ bool OTAManager::startUpdate(size_t contentLength, String md5) {
         _watchdog->beginOperation(OP_CUSTOM, "OTA Güncelleme");
     }
     
-    if (!Update.begin(contentLength)) {
-        _errorMessage = String("Başlatma hatası: ") + Update.errorString();
-        _state = OTA_ERROR;
-        Serial.println("OTA: " + _errorMessage);
+    _partition = esp_ota_get_next_update_partition(NULL);
+    if (!_partition) {
+        _releasePipeline();
+        _fail("Güncelleme bölümü bulunamadı");
         return false;
     }
     
+    _ring = (uint8_t*)heap_caps_malloc(OTA_RING_BUFFER_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!_ring) {
+        _releasePipeline();
+        _fail("OTA tamponu ayrılamadı");
+        return false;
+    }
+    
+    // Sıralı yazım: bölüm baştan silinmez, her sektör yazılmadan hemen önce silinir
+    esp_err_t err = esp_ota_begin(_partition, OTA_WITH_SEQUENTIAL_WRITES, &_otaHandle);
+    if (err != ESP_OK) {
+        _otaHandle = 0;
+        _releasePipeline();
+        _fail("Başlatma hatası", err);
+        return false;
+    }
+    
+    mbedtls_sha256_init(&_sha256);
+    mbedtls_sha256_starts(&_sha256, 0);
+    _sha256Hex[0] = '\0';
+    
+    _expectedMD5 = md5;
+    _expectedSHA256 = sha256;
     if (md5.length() > 0) {
-        Update.setMD5(md5.c_str());
-        _expectedMD5 = md5;
+        _md5.begin();
         Serial.println("OTA: MD5 doğrulaması aktif");
     }
+    if (sha256.length() > 0) {
+        Serial.println("OTA: SHA-256 doğrulaması aktif");
+    }
     
+    _ringHead.store(0);
+    _ringTail.store(0);
+    _inputClosed.store(false);
+    _abortRequested.store(false);
+    _writerFailed.store(false);
+    _writerError = ESP_OK;
     _totalSize = contentLength;
+    _sizeHint = sizeHint;
     _writtenSize = 0;
+    _receivedSize = 0;
+    
+    // Yazıcı görev loop'tan farklı çekirdekte çalışır
+    _writerRunning.store(true);
+    if (xTaskCreatePinnedToCore(_writerTaskEntry, "ota_writer", OTA_WRITER_STACK_SIZE, this,
+                                OTA_WRITER_PRIORITY, &_writerTask, OTA_WRITER_CORE) != pdPASS) {
+        _writerRunning.store(false);
+        _writerTask = nullptr;
+        _releasePipeline();
+        _fail("Yazıcı görev başlatılamadı");
+        return false;
+    }
+    
     _state = OTA_UPLOADING;
     _updateStartTime = millis();
     _lastProgressReport = millis();
@@ -89,28 +159,127 @@ bool OTAManager::writeChunk(uint8_t* data, size_t length) {
     }
     
     if (millis() - _updateStartTime > UPDATE_TIMEOUT) {
-        _errorMessage = "Güncelleme zaman aşımı";
-        abortUpdate();
+        _abortWithError("Güncelleme zaman aşımı");
         return false;
     }
     
-    size_t written = Update.write(data, length);
-    if (written != length) {
-        _errorMessage = String("Yazma hatası: ") + Update.errorString();
-        _state = OTA_ERROR;
-        abortUpdate();
+    if (_writerFailed.load()) {
+        _abortWithError("Flash yazma hatası", _writerError);
         return false;
     }
     
-    _writtenSize += written;
+    if (_receivedSize + length > _partition->size || _receivedSize + length > MAX_FIRMWARE_SIZE) {
+        _abortWithError("Firmware güncelleme bölümünden büyük");
+        return false;
+    }
+    
+    size_t offset = 0;
+    unsigned long waitStart = 0;
+    
+    while (offset < length) {
+        size_t head = _ringHead.load(std::memory_order_relaxed);
+        size_t space = OTA_RING_BUFFER_SIZE - (head - _ringTail.load(std::memory_order_acquire));
+        
+        if (space == 0) {
+            // Sunucu akış denetimine rağmen dolduysa yazıcıyı kısa süre bekle
+            if (waitStart == 0) {
+                waitStart = millis();
+            }
+            if (_writerFailed.load() || millis() - waitStart > OTA_RING_WAIT_MS) {
+                _abortWithError("Flash yazımı alım hızına yetişemedi", _writerError);
+                return false;
+            }
+            vTaskDelay(1);
+            continue;
+        }
+        
+        // Halkanın sonuna kadar olan bitişik kısmı kopyala
+        size_t position = head % OTA_RING_BUFFER_SIZE;
+        size_t count = length - offset;
+        if (count > space) count = space;
+        if (count > OTA_RING_BUFFER_SIZE - position) count = OTA_RING_BUFFER_SIZE - position;
+        
+        memcpy(_ring + position, data + offset, count);
+        _ringHead.store(head + count, std::memory_order_release);
+        offset += count;
+        
+        xTaskNotifyGive(_writerTask);
+    }
+    
+    _receivedSize += length;
     
-    if (_watchdog && millis() - _lastProgressReport > 1000) {
-        _watchdog->feed();
+    if (millis() - _lastProgressReport > 1000) {
+        if (_watchdog) {
+            _watchdog->feed();
+        }
         _lastProgressReport = millis();
         
-        int progress = getProgress();
-        Serial.printf("OTA: İlerleme %d%% (%d/%d bytes)\n", 
-                      progress, _writtenSize, _totalSize);
+        Serial.printf("OTA: Alınan %u bytes, yazılan %u bytes\n", 
+                      (unsigned)_receivedSize, (unsigned)_writtenSize);
+    }
+    
+    return true;
+}
+
+void OTAManager::_writerTaskEntry(void* arg) {
+    static_cast<OTAManager*>(arg)->_writerLoop();
+    
+    // Hata ya da bitişte kendini silmez: writeChunk/endUpdate hâlâ bildirim
+    // gönderebilir. _reapWriter silene kadar bildirimleri tüketerek bekler.
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+
+void OTAManager::_writerLoop() {
+    while (!_abortRequested.load()) {
+        // Önce kapanış bayrağı, sonra baş sayacı: kapanmadan önce yazılan her bayt görülür
+        bool closed = _inputClosed.load(std::memory_order_acquire);
+        size_t tail = _ringTail.load(std::memory_order_relaxed);
+        size_t available = _ringHead.load(std::memory_order_acquire) - tail;
+        
+        if (available >= OTA_BLOCK_SIZE || (closed && available > 0)) {
+            size_t count = available < OTA_BLOCK_SIZE ? available : OTA_BLOCK_SIZE;
+            uint8_t* block = _ring + (tail % OTA_RING_BUFFER_SIZE);
+            
+            mbedtls_sha256_update(&_sha256, block, count);
+            if (_expectedMD5.length() > 0) {
+                _md5.add(block, count);
+            }
+            
+            esp_err_t err = esp_ota_write(_otaHandle, block, count);
+            if (err != ESP_OK) {
+                _writerError = err;
+                _writerFailed.store(true);
+                break;
+            }
+            
+            _ringTail.store(tail + count, std::memory_order_release);
+            _writtenSize += count;
+            continue;
+        }
+        
+        if (closed) {
+            break; // Her şey yazıldı
+        }
+        
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(50));
+    }
+    
+    _writerRunning.store(false);
+}
+
+bool OTAManager::_waitForWriter(unsigned long timeoutMs) {
+    unsigned long start = millis();
+    
+    while (_writerRunning.load()) {
+        if (millis() - start > timeoutMs) {
+            return false;
+        }
+        if (_watchdog) {
+            _watchdog->feed();
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
     }
     
     return true;
@@ -125,20 +294,61 @@ bool OTAManager::endUpdate() {
     _state = OTA_VALIDATING;
     Serial.println("OTA: Güncelleme tamamlanıyor ve doğrulanıyor...");
     
-    if (!Update.end(true)) {
-        _errorMessage = String("Tamamlama hatası: ") + Update.errorString();
-        _state = OTA_ERROR;
-        Serial.println("OTA: " + _errorMessage);
+    // Kalan baytları yazıcıya bırak ve bitmesini bekle (en fazla bir halka dolusu)
+    _inputClosed.store(true, std::memory_order_release);
+    xTaskNotifyGive(_writerTask);
+    
+    if (!_waitForWriter(OTA_FINISH_TIMEOUT)) {
+        _abortWithError("Son bloklar zamanında yazılamadı");
         return false;
     }
     
-    _state = OTA_SUCCESS;
-    Serial.println("OTA: Güncelleme başarıyla tamamlandı!");
+    if (_writerFailed.load()) {
+        _abortWithError("Flash yazma hatası", _writerError);
+        return false;
+    }
     
-    if (_watchdog) {
-        _watchdog->endOperation();
+    if (_writtenSize < MIN_FIRMWARE_SIZE || (_totalSize != 0 && _writtenSize != _totalSize)) {
+        _abortWithError("Eksik ya da geçersiz firmware");
+        return false;
+    }
+    
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&_sha256, digest);
+    for (int i = 0; i < 32; i++) {
+        sprintf(_sha256Hex + i * 2, "%02x", digest[i]);
+    }
+    Serial.println(String("OTA: SHA-256 ") + _sha256Hex);
+    
+    if (_expectedSHA256.length() > 0 && !_expectedSHA256.equalsIgnoreCase(_sha256Hex)) {
+        _abortWithError("SHA-256 uyuşmazlığı");
+        return false;
     }
     
+    if (_expectedMD5.length() > 0) {
+        _md5.calculate();
+        if (!_expectedMD5.equalsIgnoreCase(_md5.toString())) {
+            _abortWithError("MD5 uyuşmazlığı");
+            return false;
+        }
+    }
+    
+    // esp_ota_end imajı doğrular ve tutamacı her durumda serbest bırakır
+    esp_err_t err = esp_ota_end(_otaHandle);
+    _otaHandle = 0;
+    if (err == ESP_OK) {
+        err = esp_ota_set_boot_partition(_partition);
+    }
+    if (err != ESP_OK) {
+        _abortWithError("Tamamlama hatası", err);
+        return false;
+    }
+    
+    _releasePipeline();
+    
+    _state = OTA_SUCCESS;
+    Serial.println("OTA: Güncelleme başarıyla tamamlandı!");
+    
     _clearUpdateFlags();
     
     delay(1000);
@@ -150,21 +360,91 @@ bool OTAManager::endUpdate() {
 
 void OTAManager::abortUpdate() {
     if (_state == OTA_UPLOADING) {
-        Update.abort();
+        _releasePipeline();
         _state = OTA_ERROR;
         
-        if (_watchdog) {
-            _watchdog->endOperation();
-        }
-        
         _restoreSystemState();
         Serial.println("OTA: Güncelleme iptal edildi");
     }
 }
 
+void OTAManager::_abortWithError(const char* message, esp_err_t error) {
+    _releasePipeline();
+    _restoreSystemState();
+    _fail(message, error);
+}
+
+void OTAManager::_releasePipeline() {
+    // Yazıcıyı durdur (flash yazımı sürüyorsa o blok bitene kadar bekler)
+    if (_writerRunning.load()) {
+        _abortRequested.store(true);
+        xTaskNotifyGive(_writerTask);
+        _waitForWriter(OTA_FINISH_TIMEOUT);
+    }
+    
+    // Yazıcı hâlâ flash'a yazıyorsa tutamaç, özet bağlamı ve tampon onda kalır;
+    // bir sonraki startUpdate görevi yeniden dener
+    if (!_reapWriter()) {
+        Serial.println("OTA: Yazıcı görev zamanında durmadı, kaynaklar sonra bırakılacak");
+    }
+    
+    if (_watchdog) {
+        _watchdog->endOperation();
+    }
+}
+
+bool OTAManager::_reapWriter() {
+    if (_writerRunning.load()) {
+        return false;
+    }
+    
+    // Görev döngüden çıkmış ve park etmiştir; silmek güvenlidir
+    if (_writerTask != nullptr) {
+        vTaskDelete(_writerTask);
+        _writerTask = nullptr;
+    }
+    
+    if (_otaHandle != 0) {
+        esp_ota_abort(_otaHandle);
+        _otaHandle = 0;
+    }
+    
+    mbedtls_sha256_free(&_sha256);
+    
+    if (_ring) {
+        heap_caps_free(_ring);
+        _ring = nullptr;
+    }
+    return true;
+}
+
+void OTAManager::_fail(const char* message, esp_err_t error) {
+    _errorMessage = message;
+    if (error != ESP_OK) {
+        _errorMessage += " (";
+        _errorMessage += esp_err_to_name(error);
+        _errorMessage += ")";
+    }
+    _state = OTA_ERROR;
+    Serial.println("OTA: " + _errorMessage);
+}
+
+size_t OTAManager::getReceiveWindow() const {
+    if (_state != OTA_UPLOADING || !_ring) {
+        return SIZE_MAX;
+    }
+    return OTA_RING_BUFFER_SIZE - (_ringHead.load() - _ringTail.load());
+}
+
 int OTAManager::getProgress() const {
-    if (_totalSize == 0) return 0;
-    return (_writtenSize * 100) / _totalSize;
+    if (_totalSize != 0) {
+        return (_writtenSize * 100) / _totalSize;
+    }
+    
+    // Multipart: istek boyutu zarfı da içerdiği için tahmin bitişe kadar %99'da tutulur
+    if (_sizeHint == 0) return 0;
+    int progress = (_writtenSize * 100) / _sizeHint;
+    return progress > 99 ? 99 : progress;
 }
 
 void OTAManager::checkRollback() {
@@ -2,7 +2,10 @@
 #define OTA_MANAGER_H
 
 #include <Arduino.h>
-#include <Update.h>
+#include <atomic>
+#include <esp_ota_ops.h>
+#include <mbedtls/sha256.h>
+#include <MD5Builder.h>
 #include <ArduinoJson.h>
 #include "config.h"
 #include "storage.h"
@@ -16,6 +19,10 @@ enum OTAState {
     OTA_VALIDATING
 };
 
+// Boru hattı: upload handler (loop) alınan baytları halka tampona kopyalar,
+// ayrı çekirdekteki yazıcı görev tampondan 4 KB'lık bloklar alıp SHA-256'yı
+// artımlı günceller ve flash'a yazar. Loop hiçbir zaman flash yazımını
+// beklemez; tampon dolarsa sunucu okumayı kısar (getReceiveWindow).
 class OTAManager {
 public:
     OTAManager();
@@ -25,7 +32,9 @@ public:
     void setStorage(Storage* storage) { _storage = storage; }
     void setWatchdog(WatchdogManager* watchdog) { _watchdog = watchdog; }
     
-    bool startUpdate(size_t contentLength, String md5 = "");
+    // contentLength 0 ise boyut bilinmiyor demektir (multipart yükleme); o durumda
+    // sizeHint (istek Content-Length'i, zarf dahil) yalnızca ilerleme tahmini için kullanılır
+    bool startUpdate(size_t contentLength, String md5 = "", String sha256 = "", size_t sizeHint = 0);
     bool writeChunk(uint8_t* data, size_t length);
     bool endUpdate();
     void abortUpdate();
@@ -36,11 +45,18 @@ public:
     
     bool isUpdateInProgress() const { return _state == OTA_UPLOADING; }
     
+    // Halka tamponda şu an yer olan bayt (sunucu akış denetimi için)
+    size_t getReceiveWindow() const;
+    
     void checkRollback();
     bool validateFirmware();
     
     size_t getTotalSize() const { return _totalSize; }
     size_t getWrittenSize() const { return _writtenSize; }
+    size_t getReceivedSize() const { return _receivedSize; }
+    
+    // Son güncellemenin SHA-256 özeti (hex, tamamlanmadıysa boş)
+    const char* getSha256() const { return _sha256Hex; }
     
     String getFirmwareVersion() const { return FIRMWARE_VERSION; }
     String getBuildDate() const { return __DATE__ " " __TIME__; }
@@ -48,9 +64,13 @@ public:
 private:
     OTAState _state;
     size_t _totalSize;
-    size_t _writtenSize;
+    size_t _sizeHint;
+    volatile size_t _writtenSize;
+    size_t _receivedSize;
     String _errorMessage;
     String _expectedMD5;
+    String _expectedSHA256;
+    char _sha256Hex[65];
     
     Storage* _storage;
     WatchdogManager* _watchdog;
@@ -58,10 +78,51 @@ private:
     unsigned long _updateStartTime;
     unsigned long _lastProgressReport;
     
+    // Flash hedefi
+    const esp_partition_t* _partition;
+    esp_ota_handle_t _otaHandle;
+    
+    // Halka tampon: baytlar serbest akan sayaçlarla izlenir
+    uint8_t* _ring;
+    std::atomic<size_t> _ringHead;       // Loop ilerletir (alınan)
+    std::atomic<size_t> _ringTail;       // Yazıcı ilerletir (flash'a yazılan)
+    
+    // Yazıcı görev. Döngüden çıkınca kendini silmez, park eder; yalnızca
+    // _reapWriter siler. Böylece bildirimler hiçbir zaman silinmiş göreve gitmez.
+    TaskHandle_t _writerTask;
+    std::atomic<bool> _writerRunning;
+    std::atomic<bool> _inputClosed;
+    std::atomic<bool> _abortRequested;
+    std::atomic<bool> _writerFailed;
+    volatile esp_err_t _writerError;
+    
+    // Artımlı özetler (yalnızca yazıcı görev günceller)
+    mbedtls_sha256_context _sha256;
+    MD5Builder _md5;
+    
     bool _saveSystemState();
     bool _restoreSystemState();
     void _clearUpdateFlags();
     
+    // Yazıcı görev gövdesi
+    static void _writerTaskEntry(void* arg);
+    void _writerLoop();
+    
+    // Yazıcının bitmesini bekle (watchdog beslenerek)
+    bool _waitForWriter(unsigned long timeoutMs);
+    
+    // Boru hattını durdur ve kaynakları bırak
+    void _releasePipeline();
+    
+    // Park etmiş yazıcı görevi sil ve tamponu bırak (yazıcı hâlâ çalışıyorsa false)
+    bool _reapWriter();
+    
+    // Hata durumuna geç (mesaj yalnızca hata anında oluşturulur)
+    void _fail(const char* message, esp_err_t error = ESP_OK);
+    
+    // Boru hattını bırak, sistem durumunu geri yükle ve hata durumuna geç
+    void _abortWithError(const char* message, esp_err_t error = ESP_OK);
+    
     static const size_t MIN_FIRMWARE_SIZE = 100000;  // 100KB minimum
     static const size_t MAX_FIRMWARE_SIZE = 1900000; // 1.9MB maximum
     static const unsigned long UPDATE_TIMEOUT = 300000; // 5 dakika
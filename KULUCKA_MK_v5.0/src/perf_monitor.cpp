@@ -0,0 +1,195 @@
+/**
+ * @file perf_monitor.cpp
+ * @brief Kontrol döngüsü gecikme ölçümü uygulaması
+ * @version 1.0
+ */
+
+#include "perf_monitor.h"
+
+static const char* const PERF_STAGE_NAMES[PERF_STAGE_COUNT] = {
+    "sensorRead",
+    "pidCompute",
+    "pidToRelay",
+    "sampleToRelay",
+    "displayUpdate",
+    "wifiHandle",
+    "loop",
+    "displayFlush",
+    "inputLatency"
+};
+
+// *** LatencyHistogram ***
+
+LatencyHistogram::LatencyHistogram() {
+    reset();
+}
+
+void LatencyHistogram::record(uint32_t value) {
+    _buckets[_bucketIndex(value)]++;
+    _count++;
+    _sum += value;
+    if (value > _max) {
+        _max = value;
+    }
+}
+
+uint32_t LatencyHistogram::getPercentile(float percentile) const {
+    if (_count == 0) {
+        return 0;
+    }
+    
+    // İstenen sıradaki ölçümü içeren kovayı bul
+    uint32_t rank = (uint32_t)ceil(_count * percentile / 100.0);
+    if (rank == 0) {
+        rank = 1;
+    }
+    
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+        seen += _buckets[i];
+        if (seen >= rank) {
+            return min(_bucketUpperBound(i), _max);
+        }
+    }
+    return _max;
+}
+
+uint32_t LatencyHistogram::getMax() const {
+    return _max;
+}
+
+uint32_t LatencyHistogram::getCount() const {
+    return _count;
+}
+
+uint32_t LatencyHistogram::getMean() const {
+    return _count > 0 ? (uint32_t)(_sum / _count) : 0;
+}
+
+void LatencyHistogram::reset() {
+    memset(_buckets, 0, sizeof(_buckets));
+    _count = 0;
+    _max = 0;
+    _sum = 0;
+}
+
+uint8_t LatencyHistogram::_bucketIndex(uint32_t value) {
+    // 0-3 µs doğrudan, sonrası oktav başına 4 alt kova
+    if (value < 4) {
+        return value;
+    }
+    uint8_t msb = 31 - __builtin_clz(value);
+    uint8_t sub = (value >> (msb - 2)) & 0x03;
+    uint16_t index = (msb - 1) * 4 + sub;
+    return (index < PERF_HISTOGRAM_BUCKETS) ? index : PERF_HISTOGRAM_BUCKETS - 1;
+}
+
+uint32_t LatencyHistogram::_bucketUpperBound(uint8_t index) {
+    if (index < 4) {
+        return index;
+    }
+    uint8_t msb = index / 4 + 1;
+    uint8_t sub = index % 4;
+    uint32_t lower = (uint32_t)(4 + sub) << (msb - 2);
+    return lower + (1UL << (msb - 2)) - 1;
+}
+
+// *** PerfMonitor ***
+
+PerfMonitor::PerfMonitor() {
+    reset();
+}
+
+void PerfMonitor::begin() {
+    reset();
+    Serial.println("Perf: Gecikme ölçümü başlatıldı - Bütçe: " + 
+                   String(PERF_HEATER_LATENCY_BUDGET_US / 1000) + " ms");
+}
+
+void PerfMonitor::reset() {
+    for (uint8_t i = 0; i < PERF_STAGE_COUNT; i++) {
+        _histograms[i].reset();
+    }
+    _sampleStart = 0;
+    _sampleReady = 0;
+    _pidDone = 0;
+    _pendingActuation = false;
+    _budgetViolations = 0;
+}
+
+void PerfMonitor::record(PerfStage stage, uint32_t duration) {
+    if (stage < PERF_STAGE_COUNT) {
+        _histograms[stage].record(duration);
+    }
+}
+
+void PerfMonitor::markSampleStart() {
+    _sampleStart = micros();
+}
+
+void PerfMonitor::markSampleReady() {
+    _sampleReady = micros();
+    record(PERF_SENSOR_READ, _sampleReady - _sampleStart);
+}
+
+void PerfMonitor::markPidDone() {
+    _pidDone = micros();
+    record(PERF_PID_COMPUTE, _pidDone - _sampleReady);
+    _pendingActuation = true;
+}
+
+void PerfMonitor::markHeaterActuated() {
+    // Yalnızca yeni bir PID sonucundan sonraki ilk röle güncellemesi ölçülür
+    if (!_pendingActuation) {
+        return;
+    }
+    _pendingActuation = false;
+    
+    uint32_t now = micros();
+    record(PERF_PID_TO_RELAY, now - _pidDone);
+    
+    uint32_t endToEnd = now - _sampleStart;
+    record(PERF_SAMPLE_TO_RELAY, endToEnd);
+    
+    if (endToEnd > PERF_HEATER_LATENCY_BUDGET_US) {
+        _budgetViolations++;
+        Serial.println("Perf: Isıtıcı gecikme bütçesi aşıldı - " + String(endToEnd / 1000.0, 1) + " ms");
+    }
+}
+
+const LatencyHistogram& PerfMonitor::getHistogram(PerfStage stage) const {
+    return _histograms[stage < PERF_STAGE_COUNT ? stage : PERF_LOOP];
+}
+
+const char* PerfMonitor::getStageName(PerfStage stage) {
+    return stage < PERF_STAGE_COUNT ? PERF_STAGE_NAMES[stage] : "unknown";
+}
+
+uint32_t PerfMonitor::getBudget() const {
+    return PERF_HEATER_LATENCY_BUDGET_US;
+}
+
+uint32_t PerfMonitor::getBudgetViolations() const {
+    return _budgetViolations;
+}
+
+void PerfMonitor::dump() const {
+    Serial.println("=== KONTROL DÖNGÜSÜ GECİKMELERİ (µs) ===");
+    Serial.println("Aşama           Adet      p50      p99      Maks");
+    
+    for (uint8_t i = 0; i < PERF_STAGE_COUNT; i++) {
+        const LatencyHistogram& h = _histograms[i];
+        char line[80];
+        snprintf(line, sizeof(line), "%-14s %6lu %8lu %8lu %9lu",
+                 PERF_STAGE_NAMES[i],
+                 (unsigned long)h.getCount(),
+                 (unsigned long)h.getPercentile(50),
+                 (unsigned long)h.getPercentile(99),
+                 (unsigned long)h.getMax());
+        Serial.println(line);
+    }
+    
+    Serial.println("Bütçe: " + String(PERF_HEATER_LATENCY_BUDGET_US) + " µs, Aşım: " + 
+                   String(_budgetViolations));
+    Serial.println("========================================");
+}
@@ -0,0 +1,93 @@
+/**
+ * @file perf_monitor.h
+ * @brief Sensör -> PID -> röle yolu için gecikme ve titreşim ölçümü
+ * @version 1.0
+ */
+
+#ifndef PERF_MONITOR_H
+#define PERF_MONITOR_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Ölçülen aşamalar
+enum PerfStage {
+    PERF_SENSOR_READ,       // SHT31 okuma süresi
+    PERF_PID_COMPUTE,       // Örnek hazır -> PID hesabı tamam
+    PERF_PID_TO_RELAY,      // PID hesabı tamam -> relays.setHeater()
+    PERF_SAMPLE_TO_RELAY,   // Örnek başlangıcı -> relays.setHeater() (uçtan uca)
+    PERF_DISPLAY_UPDATE,    // Ana ekran güncelleme süresi
+    PERF_WIFI_HANDLE,       // WiFi istek işleme süresi
+    PERF_LOOP,              // Ana döngü süresi
+    PERF_DISPLAY_FLUSH,     // Ekran tamponu DMA gönderim adımı
+    PERF_INPUT_LATENCY,     // Joystick olayı algılandı -> işlendi
+    PERF_STAGE_COUNT
+};
+
+// Sabit boyutlu logaritmik histogram (oktav başına 4 kova, µs çözünürlük).
+// Yüzdelikler kova üst sınırından raporlanır, yani her zaman tutucudur.
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+    
+    // Bir ölçüm ekle (µs)
+    void record(uint32_t value);
+    
+    // İstenen yüzdelik (0-100) için üst sınır değeri (µs)
+    uint32_t getPercentile(float percentile) const;
+    
+    uint32_t getMax() const;
+    uint32_t getCount() const;
+    uint32_t getMean() const;
+    
+    void reset();
+
+private:
+    uint32_t _buckets[PERF_HISTOGRAM_BUCKETS];
+    uint32_t _count;
+    uint32_t _max;
+    uint64_t _sum;
+    
+    static uint8_t _bucketIndex(uint32_t value);
+    static uint32_t _bucketUpperBound(uint8_t index);
+};
+
+class PerfMonitor {
+public:
+    PerfMonitor();
+    
+    // Ölçümleri sıfırla
+    void begin();
+    void reset();
+    
+    // Bir aşama süresini doğrudan kaydet (µs)
+    void record(PerfStage stage, uint32_t duration);
+    
+    // Sensör -> PID -> röle yolu zaman damgaları
+    void markSampleStart();
+    void markSampleReady();
+    void markPidDone();
+    void markHeaterActuated();
+    
+    // Aşama istatistikleri
+    const LatencyHistogram& getHistogram(PerfStage stage) const;
+    static const char* getStageName(PerfStage stage);
+    
+    // Bütçe aşımı bilgileri
+    uint32_t getBudget() const;
+    uint32_t getBudgetViolations() const;
+    
+    // Tüm histogramları seri porta yazdır
+    void dump() const;
+
+private:
+    LatencyHistogram _histograms[PERF_STAGE_COUNT];
+    
+    uint32_t _sampleStart;
+    uint32_t _sampleReady;
+    uint32_t _pidDone;
+    bool _pendingActuation;
+    uint32_t _budgetViolations;
+};
+
+#endif // PERF_MONITOR_H
@@ -21,6 +21,22 @@ PIDController::PIDController() {
     _modeChangeTime = 0;
     _stabilizationTime = 2000; // 2 saniye stabilizasyon süresi
     
+    // Kazanç tablosu başlangıçta kapalı, temel parametrelerden doldurulur
+    _stage = 0;
+    _activeBand = 0;
+    _activeKp = _kp;
+    _activeKi = _ki;
+    _activeKd = _kd;
+    _lastScheduleUpdate = 0;
+    _autoTuneResultPending = false;
+    _schedule.enabled = false;
+    resetGainSchedule();
+    
+    // İleri besleme başlangıç katkıları
+    _feedForwardEnabled = FF_ENABLED_DEFAULT;
+    _humidFeedForward.begin(FF_HUMID_INITIAL_BIAS);
+    _motorFeedForward.begin(FF_MOTOR_INITIAL_BIAS);
+    
     // PID nesnesi başlangıçta NULL
     _pid = nullptr;
 }
@@ -54,22 +70,34 @@ bool PIDController::begin() {
     return true;
 }
 
-void PIDController::setTunings(double kp, double ki, double kd) {
+bool PIDController::setTunings(double kp, double ki, double kd) {
     // Parametre geçerliliğini kontrol et
     if (kp < 0 || ki < 0 || kd < 0) {
         Serial.println("PID: Geçersiz parametre değerleri!");
-        return;
+        return false;
+    }
+    
+    // Kazanç tablosu etkinken aktif kazançları tablo belirler; temel
+    // parametre yazımı etkisiz kalacağından sessizce kabul edilmez
+    if (_schedule.enabled) {
+        Serial.println("PID: Kazanç tablosu etkin, temel parametre değişikliği reddedildi");
+        return false;
     }
     
     _kp = kp;
     _ki = ki;
     _kd = kd;
     
+    _activeKp = kp;
+    _activeKi = ki;
+    _activeKd = kd;
+    
     if (_pid != nullptr) {
         _pid->SetTunings(kp, ki, kd);
         Serial.println("PID: Parametreler güncellendi - Kp:" + String(kp) + 
                       " Ki:" + String(ki) + " Kd:" + String(kd));
     }
+    return true;
 }
 
 void PIDController::setSetpoint(double setpoint) {
@@ -164,9 +192,16 @@ void PIDController::compute(double input) {
         
         // Otomatik ayarlama tamamlandıysa PID parametrelerini güncelle
         if (_autoTuner.isFinished()) {
+            // Kullanıcının düzenlediği kapalı tabloya dokunulmaz; yalnızca eski temel
+            // kazançlardan türetilmiş (varsayılan) ya da etkin tablo yeniden üretilir
+            bool reseedSchedule = _schedule.enabled || _isDefaultGainSchedule();
+            
             _kp = _autoTuner.getKp();
             _ki = _autoTuner.getKi();
             _kd = _autoTuner.getKd();
+            _activeKp = _kp;
+            _activeKi = _ki;
+            _activeKd = _kd;
             
             // PID parametrelerini güncelle
             if (_pid != nullptr) {
@@ -178,6 +213,14 @@ void PIDController::compute(double input) {
             Serial.println("  Ki: " + String(_ki));
             Serial.println("  Kd: " + String(_kd));
             
+            if (reseedSchedule) {
+                resetGainSchedule();
+                Serial.println("PID: Kazanç tablosu yeni kazançlardan yeniden üretildi");
+            } else {
+                Serial.println("PID: Düzenlenmiş kazanç tablosu korundu");
+            }
+            _autoTuneResultPending = true;
+            
             // Otomatik ayarlama bittikten sonra manuel moda geç
             setAutoTuneMode(false);
         }
@@ -186,12 +229,27 @@ void PIDController::compute(double input) {
         _output = _heaterState ? 1.0 : 0.0;
         
     } else if (_currentMode == PID_MODE_MANUAL && _active && _pid != nullptr) {
+        // Kazanç tablosu etkinse aşama ve hata bandına göre kazançları güncelle
+        if (_schedule.enabled) {
+            _updateScheduledGains();
+        }
+        
         // Normal manuel PID modu
         _pid->Compute();
         
+        // Bozucu olaylardan ileri besleme katkısını öğren
+        if (_feedForwardEnabled) {
+            _humidFeedForward.learn(_input);
+            _motorFeedForward.learn(_input);
+        }
+        
     } else {
         // PID kapalı - çıkışı sıfırla
         _output = 0.0;
+        
+        // Kapalı kontrol altında gözlenen düşüşler modele katılmasın
+        _humidFeedForward.abortEpisode();
+        _motorFeedForward.abortEpisode();
     }
 }
 
@@ -225,8 +283,8 @@ bool PIDController::isOutputActive() const {
     } 
     
     if (_currentMode == PID_MODE_MANUAL && _active) {
-        // Manuel modda: PID çıkışı veya sıcaklık farkına göre
-        return (_output > 0.5) || (_lastError >= _activationThreshold);
+        // Manuel modda: PID çıkışı (ileri besleme dahil) veya sıcaklık farkına göre
+        return (_output + getFeedForwardBias() > 0.5) || (_lastError >= _activationThreshold);
     }
     
     return false;
@@ -259,6 +317,177 @@ bool PIDController::isManualModeActive() const {
     return (_currentMode == PID_MODE_MANUAL && _active);
 }
 
+void PIDController::setGainScheduleEnabled(bool enabled) {
+    if (_schedule.enabled == enabled) {
+        return;
+    }
+    
+    _schedule.enabled = enabled;
+    _lastScheduleUpdate = millis();
+    
+    if (!enabled) {
+        // Temel parametrelere geri dön
+        _activeKp = _kp;
+        _activeKi = _ki;
+        _activeKd = _kd;
+        _applyActiveGains();
+    }
+    
+    Serial.println("PID: Kazanç tablosu " + String(enabled ? "etkinleştirildi" : "devre dışı bırakıldı"));
+}
+
+bool PIDController::isGainScheduleEnabled() const {
+    return _schedule.enabled;
+}
+
+void PIDController::setGainSchedule(const PIDGainSchedule& schedule) {
+    bool wasEnabled = _schedule.enabled;
+    _schedule = schedule;
+    
+    // Etkinlik durumu setGainScheduleEnabled() üzerinden değişsin
+    _schedule.enabled = wasEnabled;
+    setGainScheduleEnabled(schedule.enabled);
+}
+
+const PIDGainSchedule& PIDController::getGainSchedule() const {
+    return _schedule;
+}
+
+// Varsayılan tablo temel kazançlardan türetilir: yakın bantta daha yumuşak,
+// uzak bantta daha güçlü P; uzak bantta integral birikimini sınırlamak için
+// Ki düşürülür. Çıkım aşamasında nemlendirici kaynaklı soğuma daha sık
+// olduğundan P ve I biraz artırılır.
+static const float bandKpFactor[PID_SCHEDULE_BAND_COUNT] = {0.7, 1.0, 1.3};
+static const float bandKiFactor[PID_SCHEDULE_BAND_COUNT] = {1.0, 1.0, 0.5};
+static const float bandKdFactor[PID_SCHEDULE_BAND_COUNT] = {0.8, 1.0, 1.2};
+static const float stageFactor[PID_SCHEDULE_STAGE_COUNT] = {1.0, 1.15};
+
+void PIDController::_defaultGainEntry(uint8_t stage, uint8_t band, PIDGainEntry& entry) const {
+    entry.kp = constrain(_kp * bandKpFactor[band] * stageFactor[stage], PID_KP_MIN, PID_KP_MAX);
+    entry.ki = constrain(_ki * bandKiFactor[band] * stageFactor[stage], PID_KI_MIN, PID_KI_MAX);
+    entry.kd = constrain(_kd * bandKdFactor[band], PID_KD_MIN, PID_KD_MAX);
+}
+
+void PIDController::resetGainSchedule() {
+    for (uint8_t stage = 0; stage < PID_SCHEDULE_STAGE_COUNT; stage++) {
+        for (uint8_t band = 0; band < PID_SCHEDULE_BAND_COUNT; band++) {
+            _defaultGainEntry(stage, band, _schedule.entries[stage][band]);
+        }
+    }
+}
+
+bool PIDController::_isDefaultGainSchedule() const {
+    // Kayıttan gelen float değerler için küçük bağıl pay
+    for (uint8_t stage = 0; stage < PID_SCHEDULE_STAGE_COUNT; stage++) {
+        for (uint8_t band = 0; band < PID_SCHEDULE_BAND_COUNT; band++) {
+            PIDGainEntry expected;
+            _defaultGainEntry(stage, band, expected);
+            const PIDGainEntry& entry = _schedule.entries[stage][band];
+            if (fabs(entry.kp - expected.kp) > 0.001f * (fabs(expected.kp) + 1.0f) ||
+                fabs(entry.ki - expected.ki) > 0.001f * (fabs(expected.ki) + 1.0f) ||
+                fabs(entry.kd - expected.kd) > 0.001f * (fabs(expected.kd) + 1.0f)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool PIDController::isValidScheduledGains(uint8_t stage, uint8_t band, float kp, float ki, float kd) const {
+    if (stage >= PID_SCHEDULE_STAGE_COUNT || band >= PID_SCHEDULE_BAND_COUNT) {
+        return false;
+    }
+    
+    return kp >= PID_KP_MIN && kp <= PID_KP_MAX &&
+           ki >= PID_KI_MIN && ki <= PID_KI_MAX &&
+           kd >= PID_KD_MIN && kd <= PID_KD_MAX;
+}
+
+bool PIDController::setScheduledGains(uint8_t stage, uint8_t band, float kp, float ki, float kd) {
+    if (!isValidScheduledGains(stage, band, kp, ki, kd)) {
+        Serial.println("PID: Geçersiz kazanç tablosu hücresi ya da değer sınır dışı!");
+        return false;
+    }
+    
+    PIDGainEntry& entry = _schedule.entries[stage][band];
+    entry.kp = kp;
+    entry.ki = ki;
+    entry.kd = kd;
+    return true;
+}
+
+bool PIDController::consumeAutoTuneResult() {
+    bool pending = _autoTuneResultPending;
+    _autoTuneResultPending = false;
+    return pending;
+}
+
+void PIDController::setStage(uint8_t stage) {
+    if (stage >= PID_SCHEDULE_STAGE_COUNT || stage == _stage) {
+        return;
+    }
+    
+    // Yeni aşamanın kazançlarına _updateScheduledGains() içinde yumuşak geçilir
+    _stage = stage;
+    Serial.println("PID: Kazanç tablosu aşaması: " + String(stage == 0 ? "Gelişim" : "Çıkım"));
+}
+
+uint8_t PIDController::getStage() const {
+    return _stage;
+}
+
+double PIDController::getActiveKp() const {
+    return _activeKp;
+}
+
+double PIDController::getActiveKi() const {
+    return _activeKi;
+}
+
+double PIDController::getActiveKd() const {
+    return _activeKd;
+}
+
+uint8_t PIDController::getActiveBand() const {
+    return _activeBand;
+}
+
+void PIDController::setFeedForwardEnabled(bool enabled) {
+    if (_feedForwardEnabled == enabled) {
+        return;
+    }
+    
+    _feedForwardEnabled = enabled;
+    _humidFeedForward.abortEpisode();
+    _motorFeedForward.abortEpisode();
+    
+    Serial.println("PID: İleri besleme " + String(enabled ? "etkinleştirildi" : "devre dışı bırakıldı"));
+}
+
+bool PIDController::isFeedForwardEnabled() const {
+    return _feedForwardEnabled;
+}
+
+void PIDController::setDisturbanceStates(bool humidifierOn, bool motorOn) {
+    _humidFeedForward.setDisturbance(humidifierOn);
+    _motorFeedForward.setDisturbance(motorOn);
+}
+
+double PIDController::getFeedForwardBias() const {
+    if (!_feedForwardEnabled) {
+        return 0.0;
+    }
+    return _humidFeedForward.getActiveBias() + _motorFeedForward.getActiveBias();
+}
+
+FeedForward& PIDController::getHumidifierFeedForward() {
+    return _humidFeedForward;
+}
+
+FeedForward& PIDController::getMotorFeedForward() {
+    return _motorFeedForward;
+}
+
 // *** YENİ PRIVATE METODLAR ***
 
 void PIDController::_stopPID() {
@@ -337,4 +566,45 @@ String PIDController::_getModeString(PIDMode mode) const {
         default:
             return "Bilinmeyen";
     }
+}
+
+void PIDController::_updateScheduledGains() {
+    unsigned long now = millis();
+    unsigned long elapsed = now - _lastScheduleUpdate;
+    _lastScheduleUpdate = now;
+    
+    // Hatanın bantlar arasındaki konumu (0 = yakın, BAND_COUNT-1 = uzak)
+    double absError = fabs(_lastError);
+    double position = (absError - PID_SCHEDULE_BAND_NEAR) /
+                      (PID_SCHEDULE_BAND_FAR - PID_SCHEDULE_BAND_NEAR) *
+                      (PID_SCHEDULE_BAND_COUNT - 1);
+    position = constrain(position, 0.0, (double)(PID_SCHEDULE_BAND_COUNT - 1));
+    
+    uint8_t lower = (uint8_t)position;
+    uint8_t upper = min((uint8_t)(lower + 1), (uint8_t)(PID_SCHEDULE_BAND_COUNT - 1));
+    double fraction = position - lower;
+    _activeBand = (fraction < 0.5) ? lower : upper;
+    
+    // Komşu iki bant arasında doğrusal interpolasyon
+    const PIDGainEntry& a = _schedule.entries[_stage][lower];
+    const PIDGainEntry& b = _schedule.entries[_stage][upper];
+    double targetKp = a.kp + (b.kp - a.kp) * fraction;
+    double targetKi = a.ki + (b.ki - a.ki) * fraction;
+    double targetKd = a.kd + (b.kd - a.kd) * fraction;
+    
+    // Darbesiz geçiş: aktif kazançlar hedefe PID_SCHEDULE_BLEND_TIME içinde yaklaşır.
+    // Integral terimi PID kütüphanesinde birikmiş çıkış olarak tutulduğundan
+    // Ki değişimi çıkışta sıçrama yapmaz.
+    double alpha = min(1.0, (double)elapsed / PID_SCHEDULE_BLEND_TIME);
+    _activeKp += (targetKp - _activeKp) * alpha;
+    _activeKi += (targetKi - _activeKi) * alpha;
+    _activeKd += (targetKd - _activeKd) * alpha;
+    
+    _applyActiveGains();
+}
+
+void PIDController::_applyActiveGains() {
+    if (_pid != nullptr) {
+        _pid->SetTunings(_activeKp, _activeKi, _activeKd);
+    }
 }
\ No newline at end of file
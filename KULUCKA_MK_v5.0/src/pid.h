@@ -11,6 +11,8 @@
 #include <PID_v1.h>
 #include "config.h"
 #include "pid_auto_tune.h"
+#include "storage.h"
+#include "feed_forward.h"
 
 // PID çalışma modları
 enum PIDMode {
@@ -30,8 +32,8 @@ public:
     // PID kontrolünü başlat
     bool begin();
     
-    // PID parametrelerini ayarla
-    void setTunings(double kp, double ki, double kd);
+    // PID parametrelerini ayarla (kazanç tablosu etkinse reddedilir, false döner)
+    bool setTunings(double kp, double ki, double kd);
     
     // PID hedef değerini ayarla
     void setSetpoint(double setpoint);
@@ -86,6 +88,50 @@ public:
     
     // Manuel mod aktif mi?
     bool isManualModeActive() const;
+    
+    // Kazanç tablosu (gain scheduling) kontrolü
+    void setGainScheduleEnabled(bool enabled);
+    bool isGainScheduleEnabled() const;
+    
+    // Kazanç tablosunu yükle / al
+    void setGainSchedule(const PIDGainSchedule& schedule);
+    const PIDGainSchedule& getGainSchedule() const;
+    
+    // Tabloyu mevcut temel parametrelerden varsayılan değerlerle doldur
+    void resetGainSchedule();
+    
+    // Tek bir tablo hücresini doğrula / güncelle
+    bool isValidScheduledGains(uint8_t stage, uint8_t band, float kp, float ki, float kd) const;
+    bool setScheduledGains(uint8_t stage, uint8_t band, float kp, float ki, float kd);
+    
+    // Otomatik ayarlama yeni kazanç ürettiyse bir kez true döner (kaydetmek için)
+    bool consumeAutoTuneResult();
+    
+    // Kuluçka aşamasını bildir (0=Gelişim, 1=Çıkım)
+    void setStage(uint8_t stage);
+    uint8_t getStage() const;
+    
+    // Şu an uygulanan (karışım sonrası) kazançlar
+    double getActiveKp() const;
+    double getActiveKi() const;
+    double getActiveKd() const;
+    
+    // Mevcut hataya en yakın bant
+    uint8_t getActiveBand() const;
+    
+    // İleri besleme (nemlendirici / motor) kontrolü
+    void setFeedForwardEnabled(bool enabled);
+    bool isFeedForwardEnabled() const;
+    
+    // Bozucu rölelerin durumunu bildir (ısıtıcı kararından önce çağrılmalı)
+    void setDisturbanceStates(bool humidifierOn, bool motorOn);
+    
+    // Şu an PID çıkışına eklenen toplam ısıtıcı katkısı
+    double getFeedForwardBias() const;
+    
+    // Kaynak bazında ileri besleme bilgileri
+    FeedForward& getHumidifierFeedForward();
+    FeedForward& getMotorFeedForward();
 
 private:
     // PID parametreleri
@@ -125,6 +171,21 @@ private:
     // Mod değişimi zamanlaması
     unsigned long _modeChangeTime;
     unsigned long _stabilizationTime;
+    
+    // Kazanç tablosu değişkenleri
+    PIDGainSchedule _schedule;
+    uint8_t _stage;
+    uint8_t _activeBand;
+    double _activeKp;
+    double _activeKi;
+    double _activeKd;
+    unsigned long _lastScheduleUpdate;
+    bool _autoTuneResultPending;
+    
+    // İleri besleme değişkenleri
+    bool _feedForwardEnabled;
+    FeedForward _humidFeedForward;
+    FeedForward _motorFeedForward;
 
     // Private helper fonksiyonlar
     void _stopPID();
@@ -133,6 +194,10 @@ private:
     void _stopManualPID();
     void _stopAutoTune();
     String _getModeString(PIDMode mode) const;
+    void _defaultGainEntry(uint8_t stage, uint8_t band, PIDGainEntry& entry) const;
+    bool _isDefaultGainSchedule() const;
+    void _updateScheduledGains();
+    void _applyActiveGains();
 };
 
 #endif // PID_H
\ No newline at end of file
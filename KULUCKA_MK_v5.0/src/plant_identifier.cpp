@@ -0,0 +1,273 @@
+/**
+ * @file plant_identifier.cpp
+ * @brief Çevrimiçi proses tanımlama ve sapma tespiti uygulaması
+ * @version 1.0
+ */
+
+#include "plant_identifier.h"
+
+// Aday seçiminde kullanılan tahmin hatası ortalamasının yumuşatma katsayısı
+static const double IDENT_ERROR_SMOOTHING = 0.05;
+
+PlantIdentifier::PlantIdentifier() {
+    _name = "";
+    reset();
+}
+
+void PlantIdentifier::begin(const char* name) {
+    _name = name;
+    reset();
+}
+
+void PlantIdentifier::setInput(bool on) {
+    unsigned long now = millis();
+    
+    // Önceki durumun süresini mevcut örneğe ekle
+    if (_input && _initialized) {
+        _slotOnTime += now - _lastInputTime;
+    }
+    _input = on;
+    _lastInputTime = now;
+}
+
+void PlantIdentifier::update(double output) {
+    unsigned long now = millis();
+    
+    if (!_initialized) {
+        _offset = output;
+        _lastOutput = 0.0;
+        _slotStart = now;
+        _slotOnTime = 0;
+        _lastInputTime = now;
+        _initialized = true;
+        return;
+    }
+    
+    if (now - _slotStart < IDENT_SAMPLE_TIME) {
+        return;
+    }
+    
+    // Örnek içindeki son röle durumunu da hesaba kat
+    setInput(_input);
+    float duty = min(1.0f, (float)_slotOnTime / (now - _slotStart));
+    _slotOnTime = 0;
+    _slotStart = now;
+    
+    _inputHead = (_inputHead + 1) % IDENT_DELAY_CANDIDATES;
+    _inputHistory[_inputHead] = duty;
+    
+    double y = output - _offset;
+    
+    // Her aday kendi ölü zamanı kadar önceki girişle güncellenir
+    for (uint8_t d = 0; d < IDENT_DELAY_CANDIDATES; d++) {
+        double phi[3] = {_lastOutput, _inputAt(d), 1.0};
+        _updateCandidate(_candidates[d], phi, y);
+    }
+    _lastOutput = y;
+    _samples++;
+    
+    // Geçerli adaylar arasında hatası en düşük olanı seç
+    uint8_t best = _best;
+    for (uint8_t d = 0; d < IDENT_DELAY_CANDIDATES; d++) {
+        if (_isValid(_candidates[d]) &&
+            (!_isValid(_candidates[best]) || _candidates[d].errorMean < _candidates[best].errorMean)) {
+            best = d;
+        }
+    }
+    _best = best;
+    
+    if (isConverged()) {
+        if (!_hasReference) {
+            captureReference();
+        }
+        _checkDrift();
+    }
+}
+
+bool PlantIdentifier::isConverged() const {
+    return _samples >= IDENT_MIN_SAMPLES && _isValid(_candidates[_best]);
+}
+
+double PlantIdentifier::getGain() const {
+    const Candidate& c = _candidates[_best];
+    if (!_isValid(c)) {
+        return 0.0;
+    }
+    return c.theta[1] / (1.0 - c.theta[0]);
+}
+
+unsigned long PlantIdentifier::getTimeConstant() const {
+    const Candidate& c = _candidates[_best];
+    if (!_isValid(c)) {
+        return 0;
+    }
+    return (unsigned long)(-(double)IDENT_SAMPLE_TIME / log(c.theta[0]));
+}
+
+unsigned long PlantIdentifier::getDeadTime() const {
+    return (unsigned long)_best * IDENT_SAMPLE_TIME;
+}
+
+double PlantIdentifier::getPredictionError() const {
+    return sqrt(_candidates[_best].errorMean);
+}
+
+uint32_t PlantIdentifier::getSampleCount() const {
+    return _samples;
+}
+
+void PlantIdentifier::captureReference() {
+    if (!isConverged()) {
+        return;
+    }
+    
+    _refGain = getGain();
+    _refTau = getTimeConstant();
+    _hasReference = true;
+    _driftCount = 0;
+    _drifting = false;
+    
+    Serial.println(String("Tanımlama (") + _name + "): Referans alındı - K: " + String(_refGain, 3) + 
+                   ", Tau: " + String(_refTau / 1000.0, 0) + " sn, Ölü zaman: " + 
+                   String(getDeadTime() / 1000) + " sn");
+}
+
+bool PlantIdentifier::hasReference() const {
+    return _hasReference;
+}
+
+double PlantIdentifier::getReferenceGain() const {
+    return _refGain;
+}
+
+unsigned long PlantIdentifier::getReferenceTimeConstant() const {
+    return (unsigned long)_refTau;
+}
+
+double PlantIdentifier::getGainDrift() const {
+    if (!_hasReference || _refGain == 0.0) {
+        return 0.0;
+    }
+    return (getGain() - _refGain) / _refGain;
+}
+
+double PlantIdentifier::getTimeConstantDrift() const {
+    if (!_hasReference || _refTau == 0.0) {
+        return 0.0;
+    }
+    return ((double)getTimeConstant() - _refTau) / _refTau;
+}
+
+bool PlantIdentifier::isDrifting() const {
+    return _drifting;
+}
+
+void PlantIdentifier::reset() {
+    for (uint8_t d = 0; d < IDENT_DELAY_CANDIDATES; d++) {
+        _resetCandidate(_candidates[d]);
+        _inputHistory[d] = 0.0;
+    }
+    _best = 0;
+    _inputHead = 0;
+    _input = false;
+    _slotStart = 0;
+    _slotOnTime = 0;
+    _lastInputTime = 0;
+    _initialized = false;
+    _offset = 0.0;
+    _lastOutput = 0.0;
+    _samples = 0;
+    _hasReference = false;
+    _refGain = 0.0;
+    _refTau = 0.0;
+    _driftCount = 0;
+    _drifting = false;
+}
+
+void PlantIdentifier::_resetCandidate(Candidate& candidate) {
+    // Başlangıç tahmini: yavaş, kazançsız bir süreç
+    candidate.theta[0] = 0.9;
+    candidate.theta[1] = 0.0;
+    candidate.theta[2] = 0.0;
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = 0; j < 3; j++) {
+            candidate.P[i][j] = (i == j) ? 1000.0 : 0.0;
+        }
+    }
+    candidate.errorMean = 0.0;
+}
+
+void PlantIdentifier::_updateCandidate(Candidate& candidate, const double phi[3], double y) {
+    double Pphi[3];
+    double denom = IDENT_FORGETTING;
+    for (uint8_t i = 0; i < 3; i++) {
+        Pphi[i] = 0.0;
+        for (uint8_t j = 0; j < 3; j++) {
+            Pphi[i] += candidate.P[i][j] * phi[j];
+        }
+        denom += phi[i] * Pphi[i];
+    }
+    
+    // A-priori tahmin hatası, aday seçimi için de kullanılır
+    double predicted = 0.0;
+    for (uint8_t i = 0; i < 3; i++) {
+        predicted += candidate.theta[i] * phi[i];
+    }
+    double residual = y - predicted;
+    candidate.errorMean += (residual * residual - candidate.errorMean) * IDENT_ERROR_SMOOTHING;
+    
+    double gain[3];
+    for (uint8_t i = 0; i < 3; i++) {
+        gain[i] = Pphi[i] / denom;
+        candidate.theta[i] += gain[i] * residual;
+    }
+    
+    // Uyarım yokken kovaryansın patlamasını önle
+    double trace = candidate.P[0][0] + candidate.P[1][1] + candidate.P[2][2];
+    double lambda = (trace > IDENT_COVARIANCE_LIMIT) ? 1.0 : IDENT_FORGETTING;
+    
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = 0; j < 3; j++) {
+            candidate.P[i][j] = (candidate.P[i][j] - gain[i] * Pphi[j]) / lambda;
+        }
+    }
+}
+
+float PlantIdentifier::_inputAt(uint8_t stepsAgo) const {
+    if (stepsAgo >= IDENT_DELAY_CANDIDATES) {
+        return 0.0;
+    }
+    uint8_t index = (_inputHead + IDENT_DELAY_CANDIDATES - stepsAgo) % IDENT_DELAY_CANDIDATES;
+    return _inputHistory[index];
+}
+
+bool PlantIdentifier::_isValid(const Candidate& candidate) const {
+    // Kararlı, pozitif kazançlı ve fiziksel anlamı olan model
+    return candidate.theta[0] > 0.0 && candidate.theta[0] < 1.0 && candidate.theta[1] > 0.0;
+}
+
+void PlantIdentifier::_checkDrift() {
+    bool outside = fabs(getGainDrift()) > IDENT_DRIFT_BAND ||
+                   fabs(getTimeConstantDrift()) > IDENT_DRIFT_BAND;
+    
+    if (outside) {
+        if (_driftCount < IDENT_DRIFT_PERSIST) {
+            _driftCount++;
+        }
+    } else {
+        _driftCount = 0;
+    }
+    
+    bool drifting = (_driftCount >= IDENT_DRIFT_PERSIST);
+    if (drifting != _drifting) {
+        _drifting = drifting;
+        if (drifting) {
+            Serial.println(String("UYARI: Tanımlama (") + _name + "): Proses modeli referanstan saptı - K: " + 
+                           String(getGain(), 3) + " (" + String(getGainDrift() * 100.0, 0) + "%), Tau: " + 
+                           String(getTimeConstant() / 1000) + " sn (" + 
+                           String(getTimeConstantDrift() * 100.0, 0) + "%). Yeniden ayar önerilir.");
+        } else {
+            Serial.println(String("Tanımlama (") + _name + "): Proses modeli referans bandına döndü");
+        }
+    }
+}
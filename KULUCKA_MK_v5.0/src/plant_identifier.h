@@ -0,0 +1,106 @@
+/**
+ * @file plant_identifier.h
+ * @brief Isıtıcı ve nemlendirici döngüleri için çevrimiçi proses tanımlama ve sapma tespiti
+ * @version 1.0
+ */
+
+#ifndef PLANT_IDENTIFIER_H
+#define PLANT_IDENTIFIER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Röle geçmişi ve sensör ölçümlerinden birinci derece + ölü zaman modeli
+// tanımlayan özyinelemeli en küçük kareler (RLS) tahmincisi.
+//
+// Ayrık model: y[k+1] = a * y[k] + b * u[k-d] + c
+//   Kazanç        K   = b / (1 - a)
+//   Zaman sabiti  tau = -Ts / ln(a)
+//   Ölü zaman         = d * Ts
+// Her ölü zaman adayı için ayrı bir RLS çalışır, tahmin hatası en düşük
+// aday seçilir. İlk yakınsamada alınan referansa göre kazanç veya zaman
+// sabiti bandın dışına çıkıp orada kalırsa sapma uyarısı verilir.
+class PlantIdentifier {
+public:
+    // Yapılandırıcı
+    PlantIdentifier();
+    
+    // Tanımlayıcıyı başlat (isim seri port mesajları için)
+    void begin(const char* name);
+    
+    // Röle durumunu bildir (her döngüde çağrılır)
+    void setInput(bool on);
+    
+    // Ölçümü işle, örnekleme süresi dolduysa modeli güncelle
+    void update(double output);
+    
+    // Tahmin yeterince örnekle yakınsadı mı?
+    bool isConverged() const;
+    
+    // Tahmin edilen model parametreleri
+    double getGain() const;
+    unsigned long getTimeConstant() const;
+    unsigned long getDeadTime() const;
+    
+    // Seçili adayın ortalama karesel tahmin hatasının karekökü
+    double getPredictionError() const;
+    
+    // İşlenen örnek sayısı
+    uint32_t getSampleCount() const;
+    
+    // Sapma referansı
+    void captureReference();
+    bool hasReference() const;
+    double getReferenceGain() const;
+    unsigned long getReferenceTimeConstant() const;
+    
+    // Referansa göre bağıl sapmalar ve uyarı durumu
+    double getGainDrift() const;
+    double getTimeConstantDrift() const;
+    bool isDrifting() const;
+    
+    // Tahmini tamamen sıfırla
+    void reset();
+
+private:
+    // Tek bir ölü zaman adayı için RLS durumu
+    struct Candidate {
+        double theta[3];    // a, b, c
+        double P[3][3];     // Kovaryans matrisi
+        double errorMean;   // Üstel ortalama karesel tahmin hatası
+    };
+    
+    const char* _name;
+    Candidate _candidates[IDENT_DELAY_CANDIDATES];
+    uint8_t _best;
+    
+    // Örnek bazında röle doluluk oranı geçmişi (0-1)
+    float _inputHistory[IDENT_DELAY_CANDIDATES];
+    uint8_t _inputHead;
+    bool _input;
+    unsigned long _slotStart;
+    unsigned long _slotOnTime;
+    unsigned long _lastInputTime;
+    
+    // Ölçüm, ilk örneğe göre merkezlenir
+    bool _initialized;
+    double _offset;
+    double _lastOutput;
+    uint32_t _samples;
+    
+    // Sapma tespiti
+    bool _hasReference;
+    double _refGain;
+    double _refTau;
+    uint16_t _driftCount;
+    bool _drifting;
+    
+    // Yardımcı fonksiyonlar
+    void _resetCandidate(Candidate& candidate);
+    void _updateCandidate(Candidate& candidate, const double phi[3], double y);
+    float _inputAt(uint8_t stepsAgo) const;
+    bool _isValid(const Candidate& candidate) const;
+    void _checkDrift();
+};
+
+#endif // PLANT_IDENTIFIER_H
@@ -0,0 +1,268 @@
+/**
+ * @file sensor_history.cpp
+ * @brief Sıcaklık/nem geçmiş halkası ve trend grafiği için seyreltme uygulaması
+ * @version 1.0
+ */
+
+#include "sensor_history.h"
+#include <esp_heap_caps.h>
+
+static const uint16_t TREND_SPAN_MINUTES[TREND_SPAN_COUNT] = { 60, 360, 1440 };
+static const char* const TREND_SPAN_LABELS[TREND_SPAN_COUNT] = { "1 SAAT", "6 SAAT", "24 SAAT" };
+
+static_assert(HISTORY_BUCKET_COUNT >= 1440, "Geçmiş halkası en uzun aralığı (24 saat) karşılamalı");
+
+// 0.1 birime yuvarla
+static int16_t toTenths(float value) {
+    return (int16_t)lroundf(value * 10.0f);
+}
+
+SensorHistory::SensorHistory() {
+    _buckets = nullptr;
+    _head = 0;
+    _count = 0;
+    _version = 0;
+    _tempMin = 0;
+    _tempMax = 0;
+    _tempSum = 0;
+    _humidMin = 0;
+    _humidMax = 0;
+    _humidSum = 0;
+    _sampleCount = 0;
+    _bucketStart = 0;
+    _cache = nullptr;
+}
+
+SensorHistory::~SensorHistory() {
+    if (_buckets) {
+        heap_caps_free(_buckets);
+    }
+    if (_cache) {
+        heap_caps_free(_cache);
+    }
+}
+
+bool SensorHistory::begin() {
+    size_t bucketBytes = sizeof(HistoryBucket) * HISTORY_BUCKET_COUNT;
+    size_t cacheBytes = sizeof(TrendData) * TREND_SPAN_COUNT;
+    
+    // Geçmiş nadiren okunur ve yalnızca PSRAM'de tutulur. ~21 KB dahili RAM,
+    // web sunucusu ve DMA tamponlarından alınmaya değmez; PSRAM yoksa trend
+    // grafiği kapalıdır (boş grafik gösterilir).
+    _buckets = (HistoryBucket*)heap_caps_malloc(bucketBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    _cache = (TrendData*)heap_caps_malloc(cacheBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    
+    if (!_buckets || !_cache) {
+        if (_buckets) {
+            heap_caps_free(_buckets);
+            _buckets = nullptr;
+        }
+        if (_cache) {
+            heap_caps_free(_cache);
+            _cache = nullptr;
+        }
+        Serial.println("Sensör geçmişi için PSRAM yok, trend grafiği kapalı");
+        return false;
+    }
+    Serial.println("Sensör geçmişi ayrıldı: " + String(bucketBytes + cacheBytes) + " bayt (PSRAM)");
+    
+    // Önbellek sürümleri geçersiz başlar
+    for (int span = 0; span < TREND_SPAN_COUNT; span++) {
+        _cache[span].version = 0xFFFFFFFF;
+    }
+    
+    _bucketStart = millis();
+    return true;
+}
+
+void SensorHistory::addSample(float temperature, float humidity) {
+    if (!_buckets) {
+        return;
+    }
+    
+    // Önce biten dakikaları kapat; örnek süren dakikaya eklenir
+    update();
+    
+    if (_sampleCount == 0) {
+        _tempMin = _tempMax = temperature;
+        _humidMin = _humidMax = humidity;
+        _tempSum = 0;
+        _humidSum = 0;
+    } else {
+        if (temperature < _tempMin) _tempMin = temperature;
+        if (temperature > _tempMax) _tempMax = temperature;
+        if (humidity < _humidMin) _humidMin = humidity;
+        if (humidity > _humidMax) _humidMax = humidity;
+    }
+    _tempSum += temperature;
+    _humidSum += humidity;
+    _sampleCount++;
+}
+
+void SensorHistory::update() {
+    if (!_buckets) {
+        return;
+    }
+    
+    // Zaman ekseni örneklerden bağımsız ilerler: kesintide geçen her dakika
+    // geçersiz kayıt olarak yazılır, grafik sıkışmaz
+    const unsigned long bucketMs = HISTORY_BUCKET_SECONDS * 1000UL;
+    unsigned long now = millis();
+    uint16_t committed = 0;
+    
+    while (now - _bucketStart >= bucketMs) {
+        _commitBucket();
+        _bucketStart += bucketMs;
+        
+        // Halkadan uzun boşlukta tüm kayıtlar zaten geçersiz; sınırı yeniden hizala
+        if (++committed >= HISTORY_BUCKET_COUNT) {
+            _bucketStart = now;
+            break;
+        }
+    }
+}
+
+void SensorHistory::_commitBucket() {
+    HistoryBucket& bucket = _buckets[_head];
+    
+    if (_sampleCount > 0) {
+        bucket.tempMin = toTenths(_tempMin);
+        bucket.tempMax = toTenths(_tempMax);
+        bucket.tempMean = toTenths(_tempSum / _sampleCount);
+        bucket.humidMin = toTenths(_humidMin);
+        bucket.humidMax = toTenths(_humidMax);
+        bucket.humidMean = toTenths(_humidSum / _sampleCount);
+    } else {
+        bucket.tempMin = INT16_MAX;
+        bucket.tempMax = INT16_MIN;
+        bucket.tempMean = 0;
+        bucket.humidMin = INT16_MAX;
+        bucket.humidMax = INT16_MIN;
+        bucket.humidMean = 0;
+    }
+    
+    _head = (_head + 1) % HISTORY_BUCKET_COUNT;
+    if (_count < HISTORY_BUCKET_COUNT) {
+        _count++;
+    }
+    
+    _sampleCount = 0;
+    _version++;
+}
+
+const TrendData& SensorHistory::getTrend(TrendSpan span) {
+    // Bellek ayrılamadıysa boş grafik
+    static TrendData emptyTrend = {};
+    if (!_cache) {
+        return emptyTrend;
+    }
+    
+    TrendData& data = _cache[span];
+    if (data.version != _version) {
+        _decimate(span, data);
+        data.version = _version;
+    }
+    return data;
+}
+
+void SensorHistory::_decimate(TrendSpan span, TrendData& data) {
+    const uint16_t spanBuckets = getSpanMinutes(span) * 60 / HISTORY_BUCKET_SECONDS;
+    
+    data.temp.validColumns = 0;
+    data.humid.validColumns = 0;
+    
+    for (uint16_t column = 0; column < TREND_COLUMNS; column++) {
+        // Sütunun kapsadığı kayıtlar (en eski solda). Aralık sütundan kısaysa
+        // her kayıt birden fazla sütuna yayılır.
+        uint16_t first = (uint32_t)column * spanBuckets / TREND_COLUMNS;
+        uint16_t last = (uint32_t)(column + 1) * spanBuckets / TREND_COLUMNS;
+        if (last <= first) {
+            last = first + 1;
+        }
+        
+        int16_t tempMin = INT16_MAX, tempMax = INT16_MIN;
+        int16_t humidMin = INT16_MAX, humidMax = INT16_MIN;
+        int32_t tempSum = 0, humidSum = 0;
+        uint16_t used = 0;
+        
+        for (uint16_t position = first; position < last; position++) {
+            // Konumdan yaşa: 0 en yeni kayıt
+            uint16_t age = spanBuckets - 1 - position;
+            if (age >= _count) {
+                continue;
+            }
+            
+            const HistoryBucket& bucket = _buckets[(_head + HISTORY_BUCKET_COUNT - 1 - age) % HISTORY_BUCKET_COUNT];
+            if (bucket.tempMin > bucket.tempMax) {
+                continue; // Kesinti dakikası: sütun yalnızca bunlardan oluşuyorsa boş kalır
+            }
+            if (bucket.tempMin < tempMin) tempMin = bucket.tempMin;
+            if (bucket.tempMax > tempMax) tempMax = bucket.tempMax;
+            if (bucket.humidMin < humidMin) humidMin = bucket.humidMin;
+            if (bucket.humidMax > humidMax) humidMax = bucket.humidMax;
+            tempSum += bucket.tempMean;
+            humidSum += bucket.humidMean;
+            used++;
+        }
+        
+        data.temp.min[column] = tempMin;
+        data.temp.max[column] = tempMax;
+        data.humid.min[column] = humidMin;
+        data.humid.max[column] = humidMax;
+        
+        if (used > 0) {
+            data.temp.mean[column] = (int16_t)(tempSum / used);
+            data.humid.mean[column] = (int16_t)(humidSum / used);
+            data.temp.validColumns++;
+            data.humid.validColumns++;
+        }
+    }
+    
+    _computeScale(data.temp, TREND_TEMP_MIN_RANGE);
+    _computeScale(data.humid, TREND_HUMID_MIN_RANGE);
+}
+
+void SensorHistory::_computeScale(TrendSeries& series, int16_t minRange) {
+    int16_t low = INT16_MAX;
+    int16_t high = INT16_MIN;
+    
+    for (uint16_t column = 0; column < TREND_COLUMNS; column++) {
+        if (series.min[column] > series.max[column]) {
+            continue;
+        }
+        if (series.min[column] < low) low = series.min[column];
+        if (series.max[column] > high) high = series.max[column];
+    }
+    
+    if (series.validColumns == 0) {
+        series.scaleLow = 0;
+        series.scaleHigh = minRange;
+        return;
+    }
+    
+    // Düz bir eğri ekranı gürültüyle doldurmasın: en az minRange aralık göster
+    if (high - low < minRange) {
+        int16_t center = (high + low) / 2;
+        low = center - minRange / 2;
+        high = low + minRange;
+    }
+    
+    series.scaleLow = low;
+    series.scaleHigh = high;
+}
+
+uint32_t SensorHistory::getVersion() const {
+    return _version;
+}
+
+uint16_t SensorHistory::getBucketCount() const {
+    return _count;
+}
+
+uint16_t SensorHistory::getSpanMinutes(TrendSpan span) {
+    return TREND_SPAN_MINUTES[span];
+}
+
+const char* SensorHistory::getSpanLabel(TrendSpan span) {
+    return TREND_SPAN_LABELS[span];
+}
@@ -0,0 +1,111 @@
+/**
+ * @file sensor_history.h
+ * @brief Sıcaklık/nem geçmiş halkası ve trend grafiği için seyreltme
+ * @version 1.0
+ */
+
+#ifndef SENSOR_HISTORY_H
+#define SENSOR_HISTORY_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Trend grafiği zaman aralıkları
+enum TrendSpan {
+    TREND_SPAN_1H,
+    TREND_SPAN_6H,
+    TREND_SPAN_24H,
+    TREND_SPAN_COUNT
+};
+
+// Bir dakikalık geçmiş kaydı (değerler 0.1 birim: 375 = 37.5).
+// min > max olan kayıtta o dakika geçerli örnek yoktur (sensör kesintisi).
+struct HistoryBucket {
+    int16_t tempMin;
+    int16_t tempMax;
+    int16_t tempMean;
+    int16_t humidMin;
+    int16_t humidMax;
+    int16_t humidMean;
+};
+
+// Tek ölçümün grafik sütunları (sütun başına min/max zarfı ve ortalama).
+// min > max olan sütunda veri yoktur.
+struct TrendSeries {
+    int16_t min[TREND_COLUMNS];
+    int16_t max[TREND_COLUMNS];
+    int16_t mean[TREND_COLUMNS];
+    int16_t scaleLow;       // Dikey eksen alt sınırı (0.1 birim)
+    int16_t scaleHigh;      // Dikey eksen üst sınırı (0.1 birim)
+    uint8_t validColumns;   // Veri içeren sütun sayısı
+};
+
+// Bir zaman aralığı için hazır grafik verisi
+struct TrendData {
+    TrendSeries temp;
+    TrendSeries humid;
+    uint32_t version;       // Üretildiği geçmiş sürümü
+};
+
+// Sensör örneklerini dakikalık min/max/ortalama kayıtlarına toplayıp son
+// 24 saati halka tamponda tutar. Grafik verisi her aralık için bir kez
+// seyreltilip önbelleğe alınır; yeni kayıt eklenmedikçe aralıklar arasında
+// geçiş yalnızca bir ekran çizimine mal olur.
+class SensorHistory {
+public:
+    // Yapılandırıcı
+    SensorHistory();
+    ~SensorHistory();
+    
+    // Halka tamponu PSRAM'de ayır (PSRAM yoksa geçmiş kapalı kalır, false döner)
+    bool begin();
+    
+    // Geçerli bir sensör örneği ekle (her sensör okumasında)
+    void addSample(float temperature, float humidity);
+    
+    // Örnek gelmese de geçen her dakika için kayıt yaz (sensör hatasında çağrılır)
+    void update();
+    
+    // Aralık için seyreltilmiş grafik verisi (gerekirse yeniden üretilir)
+    const TrendData& getTrend(TrendSpan span);
+    
+    // Her yeni dakika kaydında artar (ekran önbelleği için)
+    uint32_t getVersion() const;
+    
+    // Kayıtlı dakika sayısı
+    uint16_t getBucketCount() const;
+    
+    // Aralığın süresi (dakika) ve ekran etiketi
+    static uint16_t getSpanMinutes(TrendSpan span);
+    static const char* getSpanLabel(TrendSpan span);
+
+private:
+    HistoryBucket* _buckets;
+    uint16_t _head;             // Sıradaki yazılacak kayıt
+    uint16_t _count;            // Dolu kayıt sayısı
+    uint32_t _version;
+    
+    // Süren dakikanın birikimi
+    float _tempMin;
+    float _tempMax;
+    float _tempSum;
+    float _humidMin;
+    float _humidMax;
+    float _humidSum;
+    uint16_t _sampleCount;
+    unsigned long _bucketStart;
+    
+    // Aralık başına grafik önbelleği (sürümü eskiyen aralık ilk okumada yenilenir)
+    TrendData* _cache;
+    
+    // Süren dakikayı halkaya yaz (örnek yoksa geçersiz kayıt)
+    void _commitBucket();
+    
+    // Halkadan aralık için sütunları üret
+    void _decimate(TrendSpan span, TrendData& data);
+    
+    // Sütunlardan dikey ölçeği belirle
+    static void _computeScale(TrendSeries& series, int16_t minRange);
+};
+
+#endif // SENSOR_HISTORY_H
@@ -0,0 +1,161 @@
+/**
+ * @file status_frame.cpp
+ * @brief İkili durum çerçevesi şeması ve yardımcıları
+ * @version 1.0
+ */
+
+#include "status_frame.h"
+
+#define STATUS_FIELD(name, type, member, param) \
+    { name, type, (uint8_t)offsetof(StatusFrame, member), param }
+#define STATUS_FLAG(name, bit) \
+    { name, STATUS_FIELD_FLAG, (uint8_t)offsetof(StatusFrame, flags), bit }
+
+// /api/status JSON'undaki her anahtarın çerçevedeki yeri. JSON'da aynı değeri
+// taşıyan tekrarlı anahtarlar (displayDay, sensörlerin kalibrasyonları) aynı
+// konumu gösterir; böylece çerçeve JSON belgesine birebir geri çevrilebilir.
+const StatusFieldDescriptor STATUS_FRAME_FIELDS[] = {
+    STATUS_FIELD("stateVersion", STATUS_FIELD_U32, stateVersion, 1),
+    
+    STATUS_FIELD("temperature", STATUS_FIELD_I16, temperature, 100),
+    STATUS_FIELD("humidity", STATUS_FIELD_I16, humidity, 100),
+    STATUS_FLAG("heaterState", STATUS_FLAG_HEATER),
+    STATUS_FLAG("humidifierState", STATUS_FLAG_HUMIDIFIER),
+    STATUS_FLAG("motorState", STATUS_FLAG_MOTOR),
+    
+    STATUS_FIELD("sensors.sensor1.temperature", STATUS_FIELD_I16, temp1, 100),
+    STATUS_FIELD("sensors.sensor1.humidity", STATUS_FIELD_I16, humid1, 100),
+    STATUS_FLAG("sensors.sensor1.working", STATUS_FLAG_SENSOR1_WORKING),
+    STATUS_FIELD("sensors.sensor1.tempCalibration", STATUS_FIELD_I16, tempCalibration1, 100),
+    STATUS_FIELD("sensors.sensor1.humidCalibration", STATUS_FIELD_I16, humidCalibration1, 100),
+    STATUS_FIELD("sensors.sensor2.temperature", STATUS_FIELD_I16, temp2, 100),
+    STATUS_FIELD("sensors.sensor2.humidity", STATUS_FIELD_I16, humid2, 100),
+    STATUS_FLAG("sensors.sensor2.working", STATUS_FLAG_SENSOR2_WORKING),
+    STATUS_FIELD("sensors.sensor2.tempCalibration", STATUS_FIELD_I16, tempCalibration2, 100),
+    STATUS_FIELD("sensors.sensor2.humidCalibration", STATUS_FIELD_I16, humidCalibration2, 100),
+    
+    STATUS_FIELD("currentDay", STATUS_FIELD_I16, currentDay, 1),
+    STATUS_FIELD("totalDays", STATUS_FIELD_I16, totalDays, 1),
+    STATUS_FIELD("targetTemp", STATUS_FIELD_I16, targetTemp, 100),
+    STATUS_FIELD("targetHumid", STATUS_FIELD_I16, targetHumid, 100),
+    STATUS_FLAG("isIncubationRunning", STATUS_FLAG_INCUBATION_RUNNING),
+    STATUS_FLAG("isIncubationCompleted", STATUS_FLAG_INCUBATION_COMPLETED),
+    STATUS_FIELD("actualDay", STATUS_FIELD_I16, actualDay, 1),
+    STATUS_FIELD("displayDay", STATUS_FIELD_I16, currentDay, 1),
+    
+    STATUS_FIELD("pidMode", STATUS_FIELD_U8, pidMode, 1),
+    STATUS_FIELD("pidKp", STATUS_FIELD_F32, pidKp, 1),
+    STATUS_FIELD("pidKi", STATUS_FIELD_F32, pidKi, 1),
+    STATUS_FIELD("pidKd", STATUS_FIELD_F32, pidKd, 1),
+    
+    STATUS_FLAG("alarms.enabled", STATUS_FLAG_ALARMS_ENABLED),
+    STATUS_FIELD("alarms.tempLow", STATUS_FIELD_I16, tempLowAlarm, 100),
+    STATUS_FIELD("alarms.tempHigh", STATUS_FIELD_I16, tempHighAlarm, 100),
+    STATUS_FIELD("alarms.humidLow", STATUS_FIELD_I16, humidLowAlarm, 100),
+    STATUS_FIELD("alarms.humidHigh", STATUS_FIELD_I16, humidHighAlarm, 100),
+    
+    STATUS_FIELD("motorWaitTime", STATUS_FIELD_U32, motorWaitTime, 1),
+    STATUS_FIELD("motorRunTime", STATUS_FIELD_U32, motorRunTime, 1),
+    
+    STATUS_FIELD("tempCalibration1", STATUS_FIELD_I16, tempCalibration1, 100),
+    STATUS_FIELD("tempCalibration2", STATUS_FIELD_I16, tempCalibration2, 100),
+    STATUS_FIELD("humidCalibration1", STATUS_FIELD_I16, humidCalibration1, 100),
+    STATUS_FIELD("humidCalibration2", STATUS_FIELD_I16, humidCalibration2, 100),
+    
+    STATUS_FIELD("manualDevTemp", STATUS_FIELD_I16, manualDevTemp, 100),
+    STATUS_FIELD("manualHatchTemp", STATUS_FIELD_I16, manualHatchTemp, 100),
+    STATUS_FIELD("manualDevHumid", STATUS_FIELD_U8, manualDevHumid, 1),
+    STATUS_FIELD("manualHatchHumid", STATUS_FIELD_U8, manualHatchHumid, 1),
+    STATUS_FIELD("manualDevDays", STATUS_FIELD_U8, manualDevDays, 1),
+    STATUS_FIELD("manualHatchDays", STATUS_FIELD_U8, manualHatchDays, 1),
+    
+    STATUS_FIELD("wifiStatus", STATUS_FIELD_U8, wifiStatus, 1),
+    STATUS_FIELD("ipAddress", STATUS_FIELD_IPV4, ipAddress, 1),
+    STATUS_FLAG("wifiModeAP", STATUS_FLAG_WIFI_MODE_AP),
+    STATUS_FIELD("signalStrength", STATUS_FIELD_I8, signalStrength, 1),
+    
+    STATUS_FIELD("timestamp", STATUS_FIELD_U32, timestamp, 1),
+    STATUS_FIELD("freeHeap", STATUS_FIELD_U32, freeHeap, 1),
+    STATUS_FIELD("uptime", STATUS_FIELD_U32, uptime, 1),
+    
+    STATUS_FIELD("reliability.lastSave", STATUS_FIELD_U32, lastSave, 1),
+    STATUS_FIELD("reliability.pendingChanges", STATUS_FIELD_U16, pendingChanges, 1),
+    STATUS_FLAG("reliability.autoSaveEnabled", STATUS_FLAG_AUTO_SAVE),
+    STATUS_FLAG("reliability.criticalParamsProtected", STATUS_FLAG_CRITICAL_PROTECTED)
+};
+
+const size_t STATUS_FRAME_FIELD_COUNT = sizeof(STATUS_FRAME_FIELDS) / sizeof(STATUS_FRAME_FIELDS[0]);
+
+#undef STATUS_FIELD
+#undef STATUS_FLAG
+
+static const char* const STATUS_FIELD_TYPE_NAMES[] = {
+    "u8", "i8", "u16", "i16", "u32", "f32", "flag", "ipv4"
+};
+
+int16_t statusFrameCenti(float value) {
+    float scaled = value * 100.0f;
+    if (isnan(scaled)) {
+        return 0;
+    }
+    if (scaled > 32767.0f) {
+        return 32767;
+    }
+    if (scaled < -32768.0f) {
+        return -32768;
+    }
+    return (int16_t)lroundf(scaled);
+}
+
+size_t statusFrameAppendString(uint8_t* buffer, size_t size, size_t length, const char* text) {
+    size_t textLength = strlen(text);
+    if (textLength > STATUS_FRAME_MAX_STRING) {
+        textLength = STATUS_FRAME_MAX_STRING;
+    }
+    
+    if (length == 0 || length + 1 + textLength > size) {
+        return 0;
+    }
+    
+    buffer[length++] = (uint8_t)textLength;
+    memcpy(buffer + length, text, textLength);
+    return length + textLength;
+}
+
+size_t statusFrameLength(const char* incubationType, const char* ssid) {
+    return sizeof(StatusFrame) +
+           1 + min(strlen(incubationType), (size_t)STATUS_FRAME_MAX_STRING) +
+           1 + min(strlen(ssid), (size_t)STATUS_FRAME_MAX_STRING);
+}
+
+size_t writeStatusFrameSchema(char* buffer, size_t size) {
+    size_t length = 0;
+    
+#define SCHEMA_APPEND(...) \
+    do { \
+        int written = snprintf(buffer + length, size - length, __VA_ARGS__); \
+        if (written < 0 || (size_t)written >= size - length) return 0; \
+        length += written; \
+    } while (0)
+    
+    // Alanlar [ad, tip, konum, ölçek/bit] dizileri olarak verilir
+    SCHEMA_APPEND("{\"contentType\":\"%s\",\"magic\":%u,\"version\":%u,\"size\":%u,"
+                  "\"byteOrder\":\"little\",\"fields\":[",
+                  STATUS_FRAME_CONTENT_TYPE, (unsigned)STATUS_FRAME_MAGIC,
+                  (unsigned)STATUS_FRAME_VERSION, (unsigned)sizeof(StatusFrame));
+    
+    for (size_t i = 0; i < STATUS_FRAME_FIELD_COUNT; i++) {
+        const StatusFieldDescriptor& field = STATUS_FRAME_FIELDS[i];
+        SCHEMA_APPEND("%s[\"%s\",\"%s\",%u,%u]", (i > 0) ? "," : "", field.name,
+                      STATUS_FIELD_TYPE_NAMES[field.type], field.offset, field.param);
+    }
+    
+    // wifiStatus kodları WiFiConnectionStatus sırasını izler
+    SCHEMA_APPEND("],\"strings\":[\"incubationType\",\"ssid\"],"
+                  "\"enums\":{\"wifiStatus\":[\"disconnected\",\"connecting\",\"connected\",\"failed\",\"apMode\"]},"
+                  "\"constants\":{\"firmwareVersion\":\"5.0\"}}");
+    
+#undef SCHEMA_APPEND
+    
+    return length;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file status_frame.h
+ * @brief /api/status için sürümlü, sabit düzenli ikili durum çerçevesi
+ * @version 1.0
+ */
+
+#ifndef STATUS_FRAME_H
+#define STATUS_FRAME_H
+
+#include <Arduino.h>
+#include <stddef.h>
+
+#define STATUS_FRAME_MAGIC 0x534B          // "KS" (little-endian)
+#define STATUS_FRAME_VERSION 1
+#define STATUS_FRAME_CONTENT_TYPE "application/x-kulucka-status"
+#define STATUS_FRAME_MAX_STRING 32         // Sondaki metin alanlarının en fazla uzunluğu
+
+// Bayrak bitleri (StatusFrame::flags)
+enum StatusFrameFlag {
+    STATUS_FLAG_HEATER = 0,
+    STATUS_FLAG_HUMIDIFIER,
+    STATUS_FLAG_MOTOR,
+    STATUS_FLAG_SENSOR1_WORKING,
+    STATUS_FLAG_SENSOR2_WORKING,
+    STATUS_FLAG_INCUBATION_RUNNING,
+    STATUS_FLAG_INCUBATION_COMPLETED,
+    STATUS_FLAG_ALARMS_ENABLED,
+    STATUS_FLAG_WIFI_MODE_AP,
+    STATUS_FLAG_AUTO_SAVE,
+    STATUS_FLAG_CRITICAL_PROTECTED
+};
+
+// Sabit kısım; ardından sırasıyla uzunluk önekli (uint8) incubationType ve
+// ssid metinleri gelir. Sıcaklık, nem ve kalibrasyonlar 0.01 çözünürlüklü
+// int16 olarak taşınır. Yeni alanlar yalnızca sona eklenir ve sürüm artırılır;
+// "size" alanı eski istemcilerin bilinmeyen alanları atlamasını sağlar.
+struct __attribute__((packed)) StatusFrame {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t size;
+    uint32_t stateVersion;
+    uint16_t flags;
+    
+    int16_t temperature;
+    int16_t humidity;
+    int16_t temp1;
+    int16_t humid1;
+    int16_t temp2;
+    int16_t humid2;
+    int16_t tempCalibration1;
+    int16_t humidCalibration1;
+    int16_t tempCalibration2;
+    int16_t humidCalibration2;
+    int16_t targetTemp;
+    int16_t targetHumid;
+    int16_t tempLowAlarm;
+    int16_t tempHighAlarm;
+    int16_t humidLowAlarm;
+    int16_t humidHighAlarm;
+    int16_t manualDevTemp;
+    int16_t manualHatchTemp;
+    
+    float pidKp;
+    float pidKi;
+    float pidKd;
+    
+    int16_t currentDay;
+    int16_t totalDays;
+    int16_t actualDay;
+    uint8_t pidMode;
+    uint8_t manualDevHumid;
+    uint8_t manualHatchHumid;
+    uint8_t manualDevDays;
+    uint8_t manualHatchDays;
+    uint32_t motorWaitTime;
+    uint32_t motorRunTime;
+    
+    uint8_t wifiStatus;
+    int8_t signalStrength;
+    uint8_t ipAddress[4];
+    
+    uint32_t timestamp;
+    uint32_t freeHeap;
+    uint32_t uptime;
+    uint32_t lastSave;
+    uint16_t pendingChanges;
+};
+
+// Şema tanımı için alan tipleri
+enum StatusFieldType {
+    STATUS_FIELD_U8,
+    STATUS_FIELD_I8,
+    STATUS_FIELD_U16,
+    STATUS_FIELD_I16,
+    STATUS_FIELD_U32,
+    STATUS_FIELD_F32,
+    STATUS_FIELD_FLAG,
+    STATUS_FIELD_IPV4
+};
+
+// JSON yolundaki bir alanın çerçevedeki karşılığı
+struct StatusFieldDescriptor {
+    const char* name;       // /api/status JSON yolu ("sensors.sensor1.temperature")
+    uint8_t type;           // StatusFieldType
+    uint8_t offset;         // Çerçeve içindeki bayt konumu
+    uint8_t param;          // Ölçek böleni (sayısal) veya bit numarası (bayrak)
+};
+
+extern const StatusFieldDescriptor STATUS_FRAME_FIELDS[];
+extern const size_t STATUS_FRAME_FIELD_COUNT;
+
+// 0.01 çözünürlüklü sabit noktaya çevir (taşmada sınırla)
+int16_t statusFrameCenti(float value);
+
+// Uzunluk önekli metni çerçevenin arkasına ekle; yeni uzunluğu döndürür (sığmazsa 0)
+size_t statusFrameAppendString(uint8_t* buffer, size_t size, size_t length, const char* text);
+
+// Sondaki metinlerle birlikte çerçevenin toplam uzunluğu
+size_t statusFrameLength(const char* incubationType, const char* ssid);
+
+// Şemayı JSON olarak yaz (yazılan uzunluk, sığmazsa 0)
+size_t writeStatusFrameSchema(char* buffer, size_t size);
+
+#endif // STATUS_FRAME_H
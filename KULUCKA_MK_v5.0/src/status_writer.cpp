@@ -0,0 +1,202 @@
+/**
+ * @file status_writer.cpp
+ * @brief /api/status yazıcılarının uygulaması
+ * @version 1.0
+ */
+
+#include "status_writer.h"
+#include "json_writer.h"
+
+size_t writeStatusJson(const StatusSnapshot& status, char* buffer, size_t size) {
+    JsonWriter json(buffer, size);
+    char ip[16];
+    
+    snprintf(ip, sizeof(ip), "%u.%u.%u.%u", status.ipAddress[0], status.ipAddress[1],
+             status.ipAddress[2], status.ipAddress[3]);
+    
+    json.beginObject();
+    
+    // Temel sensör verileri
+    json.addFloat("temperature", status.currentTemp);
+    json.addFloat("humidity", status.currentHumid);
+    json.addBool("heaterState", status.heaterState);
+    json.addBool("humidifierState", status.humidifierState);
+    json.addBool("motorState", status.motorState);
+    
+    // Detaylı sensör verileri
+    json.beginObject("sensors");
+    json.beginObject("sensor1");
+    json.addFloat("temperature", status.temp1);
+    json.addFloat("humidity", status.humid1);
+    json.addBool("working", status.sensor1Working);
+    json.addFloat("tempCalibration", status.tempCalibration1);
+    json.addFloat("humidCalibration", status.humidCalibration1);
+    json.endObject();
+    
+    json.beginObject("sensor2");
+    json.addFloat("temperature", status.temp2);
+    json.addFloat("humidity", status.humid2);
+    json.addBool("working", status.sensor2Working);
+    json.addFloat("tempCalibration", status.tempCalibration2);
+    json.addFloat("humidCalibration", status.humidCalibration2);
+    json.endObject();
+    json.endObject();
+    
+    // Kuluçka verileri
+    json.addInt("currentDay", status.currentDay);
+    json.addInt("totalDays", status.totalDays);
+    json.addString("incubationType", status.incubationType);
+    
+    // ÖNEMLİ: Gerçek hedef değerleri kullan
+    json.addFloat("targetTemp", status.targetTemp);
+    json.addFloat("targetHumid", status.targetHumid);
+    
+    json.addBool("isIncubationRunning", status.isIncubationRunning);
+    json.addBool("isIncubationCompleted", status.isIncubationCompleted);
+    json.addInt("actualDay", status.actualDay);
+    json.addInt("displayDay", status.currentDay);
+    
+    // PID verileri
+    json.addInt("pidMode", status.pidMode);
+    json.addFloat("pidKp", status.pidKp);
+    json.addFloat("pidKi", status.pidKi);
+    json.addFloat("pidKd", status.pidKd);
+    
+    // Alarm verileri - DETAYLI
+    json.beginObject("alarms");
+    json.addBool("enabled", status.alarmEnabled);
+    json.addFloat("tempLow", status.tempLowAlarm);
+    json.addFloat("tempHigh", status.tempHighAlarm);
+    json.addFloat("humidLow", status.humidLowAlarm);
+    json.addFloat("humidHigh", status.humidHighAlarm);
+    json.endObject();
+    
+    // Motor ayarları
+    json.addUInt("motorWaitTime", status.motorWaitTime);
+    json.addUInt("motorRunTime", status.motorRunTime);
+    
+    // Kalibrasyon verileri
+    json.addFloat("tempCalibration1", status.tempCalibration1);
+    json.addFloat("tempCalibration2", status.tempCalibration2);
+    json.addFloat("humidCalibration1", status.humidCalibration1);
+    json.addFloat("humidCalibration2", status.humidCalibration2);
+    
+    // Manuel kuluçka parametreleri
+    json.addFloat("manualDevTemp", status.manualDevTemp);
+    json.addFloat("manualHatchTemp", status.manualHatchTemp);
+    json.addUInt("manualDevHumid", status.manualDevHumid);
+    json.addUInt("manualHatchHumid", status.manualHatchHumid);
+    json.addUInt("manualDevDays", status.manualDevDays);
+    json.addUInt("manualHatchDays", status.manualHatchDays);
+    
+    // WiFi bilgileri
+    json.addString("wifiStatus", status.wifiStatusText);
+    json.addString("ipAddress", ip);
+    json.addString("wifiMode", status.wifiModeAP ? "AP" : "Station");
+    json.addString("ssid", status.ssid);
+    json.addInt("signalStrength", status.signalStrength);
+    
+    // Sistem bilgileri
+    json.addUInt("timestamp", status.timestamp);
+    json.addUInt("freeHeap", status.freeHeap);
+    json.addUInt("uptime", status.uptime);
+    json.addString("firmwareVersion", "5.0");
+    
+    // Sistem güvenilirlik bilgisi - YENİ
+    json.beginObject("reliability");
+    json.addUInt("lastSave", status.lastSave);
+    json.addUInt("pendingChanges", status.pendingChanges);
+    json.addBool("autoSaveEnabled", true);
+    json.addBool("criticalParamsProtected", true);
+    json.endObject();
+    
+    json.endObject();
+    
+    if (json.overflowed()) {
+        Serial.println("WiFi: Durum JSON buffer'a sığmadı!");
+    }
+    return json.length();
+}
+
+size_t writeStatusFrame(const StatusSnapshot& status, uint32_t stateVersion, uint8_t* buffer, size_t size) {
+    if (size < sizeof(StatusFrame)) {
+        return 0;
+    }
+    
+    StatusFrame frame;
+    memset(&frame, 0, sizeof(frame));
+    
+    frame.magic = STATUS_FRAME_MAGIC;
+    frame.version = STATUS_FRAME_VERSION;
+    frame.size = sizeof(StatusFrame);
+    frame.stateVersion = stateVersion;
+    
+    uint16_t flags = 0;
+    if (status.heaterState) flags |= (1 << STATUS_FLAG_HEATER);
+    if (status.humidifierState) flags |= (1 << STATUS_FLAG_HUMIDIFIER);
+    if (status.motorState) flags |= (1 << STATUS_FLAG_MOTOR);
+    if (status.sensor1Working) flags |= (1 << STATUS_FLAG_SENSOR1_WORKING);
+    if (status.sensor2Working) flags |= (1 << STATUS_FLAG_SENSOR2_WORKING);
+    if (status.isIncubationRunning) flags |= (1 << STATUS_FLAG_INCUBATION_RUNNING);
+    if (status.isIncubationCompleted) flags |= (1 << STATUS_FLAG_INCUBATION_COMPLETED);
+    if (status.alarmEnabled) flags |= (1 << STATUS_FLAG_ALARMS_ENABLED);
+    if (status.wifiModeAP) flags |= (1 << STATUS_FLAG_WIFI_MODE_AP);
+    flags |= (1 << STATUS_FLAG_AUTO_SAVE);
+    flags |= (1 << STATUS_FLAG_CRITICAL_PROTECTED);
+    frame.flags = flags;
+    
+    // Sensör ve hedef değerleri (0.01 çözünürlük)
+    frame.temperature = statusFrameCenti(status.currentTemp);
+    frame.humidity = statusFrameCenti(status.currentHumid);
+    frame.temp1 = statusFrameCenti(status.temp1);
+    frame.humid1 = statusFrameCenti(status.humid1);
+    frame.temp2 = statusFrameCenti(status.temp2);
+    frame.humid2 = statusFrameCenti(status.humid2);
+    frame.tempCalibration1 = statusFrameCenti(status.tempCalibration1);
+    frame.humidCalibration1 = statusFrameCenti(status.humidCalibration1);
+    frame.tempCalibration2 = statusFrameCenti(status.tempCalibration2);
+    frame.humidCalibration2 = statusFrameCenti(status.humidCalibration2);
+    frame.targetTemp = statusFrameCenti(status.targetTemp);
+    frame.targetHumid = statusFrameCenti(status.targetHumid);
+    frame.tempLowAlarm = statusFrameCenti(status.tempLowAlarm);
+    frame.tempHighAlarm = statusFrameCenti(status.tempHighAlarm);
+    frame.humidLowAlarm = statusFrameCenti(status.humidLowAlarm);
+    frame.humidHighAlarm = statusFrameCenti(status.humidHighAlarm);
+    frame.manualDevTemp = statusFrameCenti(status.manualDevTemp);
+    frame.manualHatchTemp = statusFrameCenti(status.manualHatchTemp);
+    
+    frame.pidKp = status.pidKp;
+    frame.pidKi = status.pidKi;
+    frame.pidKd = status.pidKd;
+    
+    // Kuluçka ve motor
+    frame.currentDay = status.currentDay;
+    frame.totalDays = status.totalDays;
+    frame.actualDay = status.actualDay;
+    frame.pidMode = status.pidMode;
+    frame.manualDevHumid = status.manualDevHumid;
+    frame.manualHatchHumid = status.manualHatchHumid;
+    frame.manualDevDays = status.manualDevDays;
+    frame.manualHatchDays = status.manualHatchDays;
+    frame.motorWaitTime = status.motorWaitTime;
+    frame.motorRunTime = status.motorRunTime;
+    
+    // WiFi
+    frame.wifiStatus = status.wifiStatus;
+    frame.signalStrength = (int8_t)status.signalStrength;
+    memcpy(frame.ipAddress, status.ipAddress, sizeof(frame.ipAddress));
+    
+    // Sistem
+    frame.timestamp = status.timestamp;
+    frame.freeHeap = status.freeHeap;
+    frame.uptime = status.uptime;
+    frame.lastSave = status.lastSave;
+    frame.pendingChanges = status.pendingChanges;
+    
+    memcpy(buffer, &frame, sizeof(frame));
+    
+    size_t length = sizeof(frame);
+    length = statusFrameAppendString(buffer, size, length, status.incubationType);
+    length = statusFrameAppendString(buffer, size, length, status.ssid);
+    return length;
+}
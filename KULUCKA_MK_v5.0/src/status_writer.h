@@ -0,0 +1,84 @@
+/**
+ * @file status_writer.h
+ * @brief /api/status JSON ve ikili çerçeve yazıcıları
+ * @version 1.0
+ */
+
+#ifndef STATUS_WRITER_H
+#define STATUS_WRITER_H
+
+#include <Arduino.h>
+#include "status_frame.h"
+
+// /api/status'un yayınladığı tüm alanların anlık kopyası. WiFiManager doldurur;
+// yazıcılar donanıma ve WiFi yığınına dokunmadığı için yerel testlerde de
+// aynı kod çalışır. Metin işaretçileri yazma süresince geçerli kalmalıdır.
+struct StatusSnapshot {
+    float currentTemp;
+    float currentHumid;
+    bool heaterState;
+    bool humidifierState;
+    bool motorState;
+    
+    float temp1;
+    float humid1;
+    float temp2;
+    float humid2;
+    bool sensor1Working;
+    bool sensor2Working;
+    float tempCalibration1;
+    float humidCalibration1;
+    float tempCalibration2;
+    float humidCalibration2;
+    
+    int currentDay;
+    int totalDays;
+    int actualDay;
+    const char* incubationType;
+    float targetTemp;
+    float targetHumid;
+    bool isIncubationRunning;
+    bool isIncubationCompleted;
+    
+    int pidMode;
+    float pidKp;
+    float pidKi;
+    float pidKd;
+    
+    bool alarmEnabled;
+    float tempLowAlarm;
+    float tempHighAlarm;
+    float humidLowAlarm;
+    float humidHighAlarm;
+    
+    uint32_t motorWaitTime;
+    uint32_t motorRunTime;
+    
+    float manualDevTemp;
+    float manualHatchTemp;
+    uint8_t manualDevHumid;
+    uint8_t manualHatchHumid;
+    uint8_t manualDevDays;
+    uint8_t manualHatchDays;
+    
+    uint8_t wifiStatus;             // WiFiConnectionStatus kodu
+    const char* wifiStatusText;
+    uint8_t ipAddress[4];
+    bool wifiModeAP;
+    const char* ssid;
+    int signalStrength;
+    
+    uint32_t timestamp;
+    uint32_t freeHeap;
+    uint32_t uptime;
+    uint32_t lastSave;
+    uint32_t pendingChanges;
+};
+
+// JSON belgesini buffer'a yaz (yazılan uzunluk, sığmazsa 0)
+size_t writeStatusJson(const StatusSnapshot& status, char* buffer, size_t size);
+
+// İkili durum çerçevesini buffer'a yaz (yazılan uzunluk, sığmazsa 0)
+size_t writeStatusFrame(const StatusSnapshot& status, uint32_t stateVersion, uint8_t* buffer, size_t size);
+
+#endif // STATUS_WRITER_H
@@ -17,6 +17,8 @@ Storage::Storage() {
     _retryCount = 0;
     _dataCorrupted = false;
     _lastValidationCode = 0;
+    _inTransaction = false;
+    _criticalDeferred = false;
     
     // Storage tipini belirle
 #if USE_FRAM
@@ -63,7 +65,7 @@ bool Storage::begin() {
 }
 
 void Storage::processQueue() {
-    if (!_isInitialized || !_saveScheduled) {
+    if (!_isInitialized || !_saveScheduled || _inTransaction) {
         return;
     }
     
@@ -155,6 +157,7 @@ void Storage::loadDefaults() {
     _data.pidKi = PID_KI;
     _data.pidKd = PID_KD;
     _data.pidMode = 0;       // YENİ: Varsayılan olarak PID kapalı
+    _data.humidControlMode = HUMID_CONTROL_MODE_DEFAULT;
     
     _data.motorWaitTime = DEFAULT_MOTOR_WAIT_TIME;
     _data.motorRunTime = DEFAULT_MOTOR_RUN_TIME;
@@ -207,6 +210,18 @@ void Storage::setPidMode(uint8_t mode) {
     markCriticalChange();
 }
 
+uint8_t Storage::getHumidControlMode() const {
+    // Alan eski kayıtlarda dolgu baytıydı; tanımsız değer varsayılana döner
+    if (_data.humidControlMode > HUMID_CONTROL_PREDICTIVE) {
+        return HUMID_CONTROL_MODE_DEFAULT;
+    }
+    return _data.humidControlMode;
+}
+
+void Storage::setHumidControlMode(uint8_t mode) {
+    _data.humidControlMode = mode;
+}
+
 uint8_t Storage::getIncubationType() const {
     return _data.incubationType;
 }
@@ -853,6 +868,12 @@ void Storage::_saveCriticalData() {
 #if USE_FRAM
     if (_storageType != STORAGE_TYPE_FRAM) return;
     
+    // Toplu güncellemede yazım commit'e kadar ertelenir
+    if (_inTransaction) {
+        _criticalDeferred = true;
+        return;
+    }
+    
     CriticalData critical;
     critical.targetTemp = _data.targetTemperature;
     critical.targetHumid = _data.targetHumidity;
@@ -877,6 +898,80 @@ void Storage::_saveCriticalData() {
 #endif
 }
 
+void Storage::beginTransaction() {
+    _inTransaction = true;
+    _criticalDeferred = false;
+}
+
+void Storage::commitTransaction() {
+    if (!_inTransaction) {
+        return;
+    }
+    
+    _inTransaction = false;
+    
+    if (_criticalDeferred) {
+        _criticalDeferred = false;
+        _saveCriticalData();
+    }
+    
+    saveStateNow();
+}
+
+bool Storage::saveGainSchedule(const PIDGainSchedule& schedule) {
+#if USE_FRAM
+    if (_storageType != STORAGE_TYPE_FRAM) {
+        Serial.println("Storage: Kazanç tablosu sadece FRAM'de saklanabilir");
+        return false;
+    }
+    
+    PIDGainSchedule data = schedule;
+    data.validationCode = GAIN_SCHEDULE_CODE;
+    data.crc16 = _calculateCRC16((uint8_t*)&data, offsetof(PIDGainSchedule, crc16));
+    
+    bool result = _fram.writeObject(FRAM_GAIN_SCHEDULE_START, data);
+    if (result) {
+        Serial.println("Storage: PID kazanç tablosu FRAM'e kaydedildi");
+    } else {
+        Serial.println("Storage: PID kazanç tablosu yazma hatası!");
+    }
+    return result;
+#else
+    return false;
+#endif
+}
+
+bool Storage::loadGainSchedule(PIDGainSchedule& schedule) {
+#if USE_FRAM
+    if (_storageType != STORAGE_TYPE_FRAM) {
+        return false;
+    }
+    
+    PIDGainSchedule data;
+    if (!_fram.readObject(FRAM_GAIN_SCHEDULE_START, data)) {
+        Serial.println("Storage: PID kazanç tablosu okuma hatası!");
+        return false;
+    }
+    
+    if (data.validationCode != GAIN_SCHEDULE_CODE) {
+        Serial.println("Storage: Kayıtlı PID kazanç tablosu yok");
+        return false;
+    }
+    
+    // CRC, crc16 alanına kadar olan baytları kapsar (sondaki dolgu hariç)
+    uint16_t calculatedCRC = _calculateCRC16((uint8_t*)&data, offsetof(PIDGainSchedule, crc16));
+    if (calculatedCRC != data.crc16) {
+        Serial.println("Storage: PID kazanç tablosu CRC hatası!");
+        return false;
+    }
+    
+    schedule = data;
+    return true;
+#else
+    return false;
+#endif
+}
+
 uint16_t Storage::_calculateCRC16(const uint8_t* data, size_t length) {
     uint16_t crc = 0xFFFF;
     
@@ -33,6 +33,21 @@ struct CriticalData {
     uint16_t crc16;
 };
 
+// PID kazanç tablosunun tek hücresi
+struct PIDGainEntry {
+    float kp;
+    float ki;
+    float kd;
+};
+
+// Aşama ve hata bandına göre PID kazanç tablosu (FRAM'de saklanır)
+struct PIDGainSchedule {
+    PIDGainEntry entries[PID_SCHEDULE_STAGE_COUNT][PID_SCHEDULE_BAND_COUNT];
+    bool enabled;                     // Kazanç tablosu etkin mi?
+    uint32_t validationCode;
+    uint16_t crc16;
+};
+
 // Saklama veri yapısı
 struct StorageData {
     // Kuluçka ayarları
@@ -53,6 +68,7 @@ struct StorageData {
     float pidKi;                      // PID Ki değeri
     float pidKd;                      // PID Kd değeri
     uint8_t pidMode;                  // YENİ: PID modu (0=OFF, 1=MANUAL, 2=AUTO_TUNE)
+    uint8_t humidControlMode;         // Nem kontrol modu (eski kayıtlardaki dolgu baytına oturur)
 
     // Motor ayarları
     uint32_t motorWaitTime;           // Motor bekleme süresi (dakika)
@@ -156,6 +172,10 @@ public:
     uint8_t getPidMode() const;
     void setPidMode(uint8_t mode);
     
+    // Nem kontrol modu (0=Histerezis, 1=Öngörülü)
+    uint8_t getHumidControlMode() const;
+    void setHumidControlMode(uint8_t mode);
+    
     float getPidKp() const;
     void setPidKp(float kp);
     
@@ -236,11 +256,23 @@ public:
 
     uint8_t getStorageType() const { return _storageType; }
 
+    // PID kazanç tablosu (sadece FRAM)
+    bool saveGainSchedule(const PIDGainSchedule& schedule);
+    bool loadGainSchedule(PIDGainSchedule& schedule);
+    
+    // Toplu güncelleme: işlem boyunca ara FRAM yazımları ertelenir,
+    // commitTransaction() değişiklikleri tek seferde kaydeder
+    void beginTransaction();
+    void commitTransaction();
+    bool isInTransaction() const { return _inTransaction; }
+
 private:
     StorageData _data;
     bool _isInitialized;
 
     static const uint16_t FRAM_CRITICAL_START = 8192;  // Kritik veriler için özel alan
+    static const uint16_t FRAM_GAIN_SCHEDULE_START = 8448; // PID kazanç tablosu alanı
+    static const uint32_t GAIN_SCHEDULE_CODE = 0x47534348; // "GSCH"
     void _saveCriticalData();
     bool _loadCriticalData();
     uint16_t _calculateCRC16(const uint8_t* data, size_t length);
@@ -281,6 +313,10 @@ private:
 
     bool _hasCriticalChanges;  // Kritik değişiklik bayrağı
     
+    // Toplu güncelleme durumu
+    bool _inTransaction;
+    bool _criticalDeferred;    // İşlem sırasında ertelenen kritik veri yazımı
+    
     // Kritik parametreleri işaretle
     void markCriticalChange() { _hasCriticalChanges = true; }
 
@@ -0,0 +1,321 @@
+/**
+ * @file telemetry_stream.cpp
+ * @brief Server-Sent Events telemetri yayın kanalı uygulaması
+ * @version 1.0
+ */
+
+#include "telemetry_stream.h"
+#include "json_writer.h"
+#include <lwip/sockets.h>
+
+static const char SSE_RESPONSE_HEADERS[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/event-stream\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "Access-Control-Allow-Origin: *\r\n"
+    "\r\n"
+    "retry: 3000\n\n";
+
+static const char SSE_NOT_FOUND[] =
+    "HTTP/1.1 404 Not Found\r\n"
+    "Content-Length: 0\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+
+static const char SSE_KEEPALIVE[] = ": ping\n\n";
+
+TelemetryStream::TelemetryStream() {
+    _server = nullptr;
+    _hasLast = false;
+    _lastPublish = 0;
+    _lastKeepAlive = 0;
+    _sentFrames = 0;
+    _droppedFrames = 0;
+    
+    for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+        _subscribers[i].state = SUBSCRIBER_FREE;
+    }
+}
+
+bool TelemetryStream::begin(uint16_t port) {
+    if (_server != nullptr) {
+        return true;
+    }
+    
+    _server = new WiFiServer(port);
+    if (_server == nullptr) {
+        Serial.println("SSE: Sunucu oluşturulamadı!");
+        return false;
+    }
+    
+    _server->begin();
+    _server->setNoDelay(true);
+    _hasLast = false;
+    _lastKeepAlive = millis();
+    
+    Serial.println("SSE: Telemetri akışı başlatıldı - Port: " + String(port));
+    return true;
+}
+
+void TelemetryStream::stop() {
+    for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+        _close(_subscribers[i]);
+    }
+    
+    if (_server != nullptr) {
+        _server->stop();
+        delete _server;
+        _server = nullptr;
+        Serial.println("SSE: Telemetri akışı durduruldu");
+    }
+}
+
+void TelemetryStream::handle() {
+    if (_server == nullptr) {
+        return;
+    }
+    
+    _acceptClients();
+    
+    unsigned long now = millis();
+    bool keepAliveDue = (now - _lastKeepAlive >= SSE_KEEPALIVE_INTERVAL);
+    if (keepAliveDue) {
+        _lastKeepAlive = now;
+    }
+    
+    for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+        Subscriber& subscriber = _subscribers[i];
+        
+        if (subscriber.state == SUBSCRIBER_FREE) {
+            continue;
+        }
+        
+        if (!subscriber.client.connected()) {
+            _close(subscriber);
+            continue;
+        }
+        
+        if (subscriber.state == SUBSCRIBER_HANDSHAKE) {
+            _processHandshake(subscriber);
+        } else if (keepAliveDue) {
+            // Kopan bağlantıları tespit etmek için yorum satırı gönder
+            _send(subscriber, SSE_KEEPALIVE, sizeof(SSE_KEEPALIVE) - 1);
+        }
+    }
+}
+
+bool TelemetryStream::isPublishDue() const {
+    return getClientCount() > 0 && (millis() - _lastPublish >= SSE_MIN_INTERVAL);
+}
+
+void TelemetryStream::publish(const TelemetrySnapshot& snapshot, uint32_t version) {
+    _lastPublish = millis();
+    
+    // Delta çerçevesi bir kez hazırlanır, tüm eşitlenmiş istemcilere gider
+    size_t deltaLength = 0;
+    if (_hasLast) {
+        deltaLength = _buildFrame(_deltaFrame, snapshot, &_last, version);
+    }
+    
+    // Tam çerçeve yalnızca ihtiyaç duyan istemci varsa, yine bir kez hazırlanır
+    size_t fullLength = 0;
+    bool fullBuilt = false;
+    
+    for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+        Subscriber& subscriber = _subscribers[i];
+        if (subscriber.state != SUBSCRIBER_STREAMING) {
+            continue;
+        }
+        
+        if (subscriber.needsFull || !_hasLast) {
+            if (!fullBuilt) {
+                fullLength = _buildFrame(_fullFrame, snapshot, nullptr, version);
+                fullBuilt = true;
+            }
+            if (fullLength > 0 && _send(subscriber, _fullFrame, fullLength)) {
+                subscriber.needsFull = false;
+            }
+        } else if (deltaLength > 0) {
+            _send(subscriber, _deltaFrame, deltaLength);
+        }
+    }
+    
+    _last = snapshot;
+    _hasLast = true;
+}
+
+uint8_t TelemetryStream::getClientCount() const {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+        if (_subscribers[i].state == SUBSCRIBER_STREAMING) {
+            count++;
+        }
+    }
+    return count;
+}
+
+uint32_t TelemetryStream::getSentFrames() const {
+    return _sentFrames;
+}
+
+uint32_t TelemetryStream::getDroppedFrames() const {
+    return _droppedFrames;
+}
+
+void TelemetryStream::_acceptClients() {
+    WiFiClient client = _server->available();
+    if (!client) {
+        return;
+    }
+    
+    for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+        Subscriber& subscriber = _subscribers[i];
+        if (subscriber.state == SUBSCRIBER_FREE) {
+            subscriber.client = client;
+            subscriber.state = SUBSCRIBER_HANDSHAKE;
+            subscriber.since = millis();
+            subscriber.needsFull = true;
+            subscriber.drops = 0;
+            subscriber.requestLength = 0;
+            subscriber.requestLine[0] = '\0';
+            subscriber.requestLineDone = false;
+            subscriber.tail = 0;
+            return;
+        }
+    }
+    
+    // Boş yer yok
+    client.print("HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+    client.stop();
+    Serial.println("SSE: İstemci sınırı dolu, bağlantı reddedildi");
+}
+
+void TelemetryStream::_processHandshake(Subscriber& subscriber) {
+    // İstek parça parça gelebilir; döngüyü bekletmeden mevcut baytları oku
+    while (subscriber.client.available() > 0) {
+        char c = subscriber.client.read();
+        
+        if (!subscriber.requestLineDone) {
+            if (c == '\r' || c == '\n') {
+                subscriber.requestLineDone = true;
+            } else if (subscriber.requestLength < sizeof(subscriber.requestLine) - 1) {
+                subscriber.requestLine[subscriber.requestLength++] = c;
+                subscriber.requestLine[subscriber.requestLength] = '\0';
+            }
+        }
+        
+        subscriber.tail = (subscriber.tail << 8) | (uint8_t)c;
+        if (subscriber.tail == 0x0D0A0D0A) {
+            // Başlıklar tamamlandı
+            if (strncmp(subscriber.requestLine, "GET /events", 11) == 0 ||
+                strncmp(subscriber.requestLine, "GET / ", 6) == 0) {
+                subscriber.client.write((const uint8_t*)SSE_RESPONSE_HEADERS, sizeof(SSE_RESPONSE_HEADERS) - 1);
+                subscriber.state = SUBSCRIBER_STREAMING;
+                subscriber.needsFull = true;
+                Serial.println("SSE: Yeni izleyici - Toplam: " + String(getClientCount()));
+            } else {
+                subscriber.client.write((const uint8_t*)SSE_NOT_FOUND, sizeof(SSE_NOT_FOUND) - 1);
+                _close(subscriber);
+            }
+            return;
+        }
+    }
+    
+    if (millis() - subscriber.since > SSE_HANDSHAKE_TIMEOUT) {
+        _close(subscriber);
+    }
+}
+
+size_t TelemetryStream::_buildFrame(char* buffer, const TelemetrySnapshot& snapshot,
+                                    const TelemetrySnapshot* previous, uint32_t version) {
+    const bool full = (previous == nullptr);
+    
+    int header = snprintf(buffer, SSE_FRAME_SIZE, "id: %lu\nevent: %s\ndata: ",
+                          (unsigned long)version, full ? "full" : "delta");
+    if (header <= 0 || header >= SSE_FRAME_SIZE) {
+        return 0;
+    }
+    
+    // Gövde, başlığın hemen arkasına yazılır; sona "\n\n" için yer bırakılır
+    JsonWriter json(buffer + header, SSE_FRAME_SIZE - header - 2);
+    uint8_t fields = 0;
+    
+    json.beginObject();
+    
+#define SSE_FLOAT_FIELD(name) \
+    if (full || snapshot.name != previous->name) { json.addFloat(#name, snapshot.name, 2); fields++; }
+#define SSE_BOOL_FIELD(name) \
+    if (full || snapshot.name != previous->name) { json.addBool(#name, snapshot.name); fields++; }
+#define SSE_INT_FIELD(name) \
+    if (full || snapshot.name != previous->name) { json.addInt(#name, snapshot.name); fields++; }
+    
+    SSE_FLOAT_FIELD(temperature)
+    SSE_FLOAT_FIELD(humidity)
+    SSE_FLOAT_FIELD(temp1)
+    SSE_FLOAT_FIELD(temp2)
+    SSE_FLOAT_FIELD(humid1)
+    SSE_FLOAT_FIELD(humid2)
+    SSE_FLOAT_FIELD(targetTemp)
+    SSE_FLOAT_FIELD(targetHumid)
+    SSE_BOOL_FIELD(heaterState)
+    SSE_BOOL_FIELD(humidifierState)
+    SSE_BOOL_FIELD(motorState)
+    SSE_BOOL_FIELD(sensor1Working)
+    SSE_BOOL_FIELD(sensor2Working)
+    SSE_BOOL_FIELD(isIncubationRunning)
+    SSE_INT_FIELD(currentDay)
+    SSE_INT_FIELD(totalDays)
+    SSE_INT_FIELD(pidMode)
+    
+#undef SSE_FLOAT_FIELD
+#undef SSE_BOOL_FIELD
+#undef SSE_INT_FIELD
+    
+    json.endObject();
+    
+    // Değişiklik yoksa delta gönderilmez
+    if (json.overflowed() || (!full && fields == 0)) {
+        return 0;
+    }
+    
+    size_t length = header + json.length();
+    buffer[length++] = '\n';
+    buffer[length++] = '\n';
+    buffer[length] = '\0';
+    return length;
+}
+
+bool TelemetryStream::_send(Subscriber& subscriber, const char* data, size_t length) {
+    // Engellemeyen gönderim: soket buffer'ı doluysa istemci yavaştır
+    int sent = lwip_send(subscriber.client.fd(), data, length, MSG_DONTWAIT);
+    
+    if (sent == (int)length) {
+        subscriber.drops = 0;
+        _sentFrames++;
+        return true;
+    }
+    
+    if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        // Çerçeveyi düşür, istemciyi sonraki güncellemede tam durumla eşitle
+        _droppedFrames++;
+        subscriber.needsFull = true;
+        if (++subscriber.drops >= SSE_MAX_DROPPED_FRAMES) {
+            Serial.println("SSE: Yavaş istemci bağlantısı kesildi");
+            _close(subscriber);
+        }
+        return false;
+    }
+    
+    // Kısmi gönderim akışı bozar; hata durumunda da bağlantıyı kapat
+    _close(subscriber);
+    return false;
+}
+
+void TelemetryStream::_close(Subscriber& subscriber) {
+    if (subscriber.state != SUBSCRIBER_FREE) {
+        subscriber.client.stop();
+        subscriber.client = WiFiClient();
+        subscriber.state = SUBSCRIBER_FREE;
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * @file telemetry_stream.h
+ * @brief Canlı telemetri için Server-Sent Events (SSE) yayın kanalı
+ * @version 1.0
+ */
+
+#ifndef TELEMETRY_STREAM_H
+#define TELEMETRY_STREAM_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include "config.h"
+
+// Yayınlanan canlı değerlerin anlık görüntüsü
+struct TelemetrySnapshot {
+    float temperature;
+    float humidity;
+    float temp1;
+    float temp2;
+    float humid1;
+    float humid2;
+    float targetTemp;
+    float targetHumid;
+    bool heaterState;
+    bool humidifierState;
+    bool motorState;
+    bool sensor1Working;
+    bool sensor2Working;
+    bool isIncubationRunning;
+    int16_t currentDay;
+    int16_t totalDays;
+    uint8_t pidMode;
+};
+
+// Ayrı bir portta çalışan, HTTP sunucusunun bağlantı slotlarını meşgul etmeyen SSE yayıncısı.
+// Her güncellemede yalnızca değişen alanlardan oluşan tek bir "delta"
+// çerçevesi hazırlanır ve tüm istemcilere aynı buffer gönderilir. Soket
+// dolu olan yavaş istemcilerde çerçeve düşürülür ve istemci bir sonraki
+// güncellemede tam durum ("full") çerçevesiyle yeniden eşitlenir.
+class TelemetryStream {
+public:
+    // Yapılandırıcı
+    TelemetryStream();
+    
+    // Yayını başlat / durdur
+    bool begin(uint16_t port = SSE_PORT);
+    void stop();
+    
+    // Yeni bağlantıları, el sıkışmaları ve canlı tutmayı işle
+    void handle();
+    
+    // İzleyen istemci var ve yayın aralığı doldu mu?
+    bool isPublishDue() const;
+    
+    // Anlık görüntüyü yayınla (değişiklik yoksa çerçeve gönderilmez)
+    void publish(const TelemetrySnapshot& snapshot, uint32_t version);
+    
+    // İstatistikler
+    uint8_t getClientCount() const;
+    uint32_t getSentFrames() const;
+    uint32_t getDroppedFrames() const;
+
+private:
+    enum SubscriberState {
+        SUBSCRIBER_FREE,
+        SUBSCRIBER_HANDSHAKE,
+        SUBSCRIBER_STREAMING
+    };
+    
+    struct Subscriber {
+        WiFiClient client;
+        SubscriberState state;
+        unsigned long since;
+        bool needsFull;
+        uint8_t drops;
+        char requestLine[48];
+        uint8_t requestLength;
+        bool requestLineDone;
+        uint32_t tail;              // Son 4 bayt ("\r\n\r\n" tespiti)
+    };
+    
+    WiFiServer* _server;
+    Subscriber _subscribers[SSE_MAX_CLIENTS];
+    
+    TelemetrySnapshot _last;
+    bool _hasLast;
+    unsigned long _lastPublish;
+    unsigned long _lastKeepAlive;
+    
+    uint32_t _sentFrames;
+    uint32_t _droppedFrames;
+    
+    // Tüm istemcilerle paylaşılan çerçeve buffer'ları
+    char _deltaFrame[SSE_FRAME_SIZE];
+    char _fullFrame[SSE_FRAME_SIZE];
+    
+    // Yardımcı fonksiyonlar
+    void _acceptClients();
+    void _processHandshake(Subscriber& subscriber);
+    size_t _buildFrame(char* buffer, const TelemetrySnapshot& snapshot,
+                       const TelemetrySnapshot* previous, uint32_t version);
+    bool _send(Subscriber& subscriber, const char* data, size_t length);
+    void _close(Subscriber& subscriber);
+};
+
+#endif // TELEMETRY_STREAM_H
@@ -0,0 +1,24 @@
+/**
+ * @file web_assets.h
+ * @brief Derleme sırasında gzip ile sıkıştırılan web arayüzü dosyaları
+ * @version 1.0
+ */
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+// scripts/pre_build.py, web/ klasöründeki dosyaları sıkıştırıp web_assets_gz.cpp
+// dosyasını üretir. Veriler flash'ta kalır ve yanıt heap'e kopyalanmadan gönderilir.
+struct WebAsset {
+    const char* contentType;
+    const uint8_t* data;        // gzip ile sıkıştırılmış içerik
+    size_t length;
+    const char* etag;           // İçerik özetinden türetilen ETag (tırnaklı)
+};
+
+extern const WebAsset WEB_ASSET_INDEX;      // web/index.html -> "/"
+extern const WebAsset WEB_ASSET_WIFI;       // web/wifi.html  -> "/wifi"
+
+#endif // WEB_ASSETS_H
@@ -0,0 +1,258 @@
+/**
+ * @file widgets.cpp
+ * @brief Ana ekran için kalıcı (retained) ekran öğeleri uygulaması
+ * @version 1.0
+ */
+
+#include "widgets.h"
+
+// Varsayılan GFX yazı tipinde bir karakterin genişliği/yüksekliği (boyut 1)
+#define WIDGET_CHAR_WIDTH  6
+#define WIDGET_CHAR_HEIGHT 8
+
+// *** Widget ***
+
+Widget::Widget() : _x(0), _y(0), _w(0), _h(0), _dirty(true) {
+}
+
+void Widget::setBounds(int16_t x, int16_t y, int16_t w, int16_t h) {
+    _x = x;
+    _y = y;
+    _w = w;
+    _h = h;
+    _dirty = true;
+}
+
+void Widget::invalidate() {
+    _dirty = true;
+}
+
+bool Widget::isDirty() const {
+    return _dirty;
+}
+
+bool Widget::render(Adafruit_GFX& gfx) {
+    if (!_dirty) {
+        return false;
+    }
+    
+    draw(gfx);
+    _dirty = false;
+    return true;
+}
+
+// *** TextLabel ***
+
+TextLabel::TextLabel() : _textSize(1), _align(WIDGET_ALIGN_LEFT), _color(COLOR_TEXT) {
+    _text[0] = '\0';
+}
+
+void TextLabel::configure(int16_t x, int16_t y, int16_t w, uint8_t textSize,
+                          WidgetAlign align, uint16_t color) {
+    _textSize = textSize;
+    _align = align;
+    _color = color;
+    setBounds(x, y, w, WIDGET_CHAR_HEIGHT * textSize);
+}
+
+void TextLabel::setText(const char* text) {
+    if (text == nullptr) {
+        text = "";
+    }
+    
+    // Dikdörtgene sığan karakter sayısı
+    size_t maxChars = _w / (WIDGET_CHAR_WIDTH * _textSize);
+    if (maxChars > sizeof(_text) - 1) {
+        maxChars = sizeof(_text) - 1;
+    }
+    
+    size_t length = strnlen(text, maxChars);
+    if (strncmp(_text, text, length) == 0 && _text[length] == '\0') {
+        return; // Görünür metin aynı
+    }
+    
+    memcpy(_text, text, length);
+    _text[length] = '\0';
+    _dirty = true;
+}
+
+void TextLabel::setColor(uint16_t color) {
+    if (color != _color) {
+        _color = color;
+        _dirty = true;
+    }
+}
+
+const char* TextLabel::getText() const {
+    return _text;
+}
+
+void TextLabel::draw(Adafruit_GFX& gfx) {
+    // Önceki içeriği yalnızca kendi dikdörtgeni içinde sil
+    gfx.fillRect(_x, _y, _w, _h, COLOR_BACKGROUND);
+    
+    if (_text[0] == '\0') {
+        return;
+    }
+    
+    int16_t textWidth = strlen(_text) * WIDGET_CHAR_WIDTH * _textSize;
+    int16_t x = _x;
+    if (_align == WIDGET_ALIGN_CENTER) {
+        x = _x + (_w - textWidth) / 2;
+    } else if (_align == WIDGET_ALIGN_RIGHT) {
+        x = _x + _w - textWidth;
+    }
+    
+    gfx.setTextWrap(false);
+    gfx.setTextSize(_textSize);
+    gfx.setTextColor(_color);
+    gfx.setCursor(x, _y);
+    gfx.print(_text);
+}
+
+// *** DigitLabel ***
+
+DigitLabel::DigitLabel() : _sink(nullptr), _drawnX(0), _drawnValid(false),
+                           _align(WIDGET_ALIGN_LEFT), _color(COLOR_TEXT) {
+    _text[0] = '\0';
+    _drawnText[0] = '\0';
+}
+
+void DigitLabel::configure(GlyphSink* sink, int16_t x, int16_t y, int16_t w,
+                           WidgetAlign align, uint16_t color) {
+    _sink = sink;
+    _align = align;
+    _color = color;
+    _drawnValid = false;
+    setBounds(x, y, w, GLYPH_LARGE_HEIGHT);
+}
+
+void DigitLabel::setText(const char* text) {
+    if (text == nullptr) {
+        text = "";
+    }
+    
+    // Dikdörtgene sığan karakter sayısı
+    size_t length = 0;
+    int16_t width = 0;
+    while (text[length] && length < sizeof(_text) - 1) {
+        const GlyphInfo* glyph = findGlyph(GLYPH_ATLAS_LARGE, text[length]);
+        int16_t glyphWidth = glyph ? glyph->width : 0;
+        if (width + glyphWidth > _w) {
+            break;
+        }
+        width += glyphWidth;
+        length++;
+    }
+    
+    if (strncmp(_text, text, length) == 0 && _text[length] == '\0') {
+        return; // Görünür metin aynı
+    }
+    
+    memcpy(_text, text, length);
+    _text[length] = '\0';
+    _dirty = true;
+}
+
+void DigitLabel::setColor(uint16_t color) {
+    if (color != _color) {
+        _color = color;
+        _drawnValid = false; // Tüm glifler yeni renkle yeniden yazılmalı
+        _dirty = true;
+    }
+}
+
+const char* DigitLabel::getText() const {
+    return _text;
+}
+
+void DigitLabel::invalidate() {
+    _drawnValid = false;
+    Widget::invalidate();
+}
+
+void DigitLabel::draw(Adafruit_GFX& gfx) {
+    if (_sink == nullptr) {
+        return;
+    }
+    
+    const GlyphAtlas& atlas = GLYPH_ATLAS_LARGE;
+    int16_t textWidth = measureGlyphText(atlas, _text);
+    int16_t x = _x;
+    if (_align == WIDGET_ALIGN_CENTER) {
+        x = _x + (_w - textWidth) / 2;
+    } else if (_align == WIDGET_ALIGN_RIGHT) {
+        x = _x + _w - textWidth;
+    }
+    
+    // Başlangıç noktası ve her konumdaki glif genişliği aynıysa kısmi çizim
+    bool partial = _drawnValid && x == _drawnX && strlen(_text) == strlen(_drawnText);
+    for (size_t i = 0; partial && _text[i]; i++) {
+        if (_text[i] != _drawnText[i]) {
+            const GlyphInfo* now = findGlyph(atlas, _text[i]);
+            const GlyphInfo* before = findGlyph(atlas, _drawnText[i]);
+            partial = (now ? now->width : 0) == (before ? before->width : 0);
+        }
+    }
+    
+    if (!partial) {
+        // Metnin solunda ve sağında kalan şeritleri temizle
+        if (x > _x) {
+            gfx.fillRect(_x, _y, x - _x, _h, COLOR_BACKGROUND);
+        }
+        int16_t right = x + textWidth;
+        if (right < _x + _w) {
+            gfx.fillRect(right, _y, _x + _w - right, _h, COLOR_BACKGROUND);
+        }
+    }
+    
+    uint16_t palette[16];
+    buildGlyphPalette(_color, COLOR_BACKGROUND, palette);
+    
+    uint16_t cell[GLYPH_LARGE_MAX_WIDTH * GLYPH_LARGE_HEIGHT];
+    int16_t cursor = x;
+    for (size_t i = 0; _text[i]; i++) {
+        const GlyphInfo* glyph = findGlyph(atlas, _text[i]);
+        if (glyph == nullptr) {
+            continue;
+        }
+        if (!partial || _text[i] != _drawnText[i]) {
+            renderGlyph(atlas, *glyph, palette, cell);
+            _sink->blit(cursor, _y, glyph->width, GLYPH_LARGE_HEIGHT, cell);
+        }
+        cursor += glyph->width;
+    }
+    
+    strcpy(_drawnText, _text);
+    _drawnX = x;
+    _drawnValid = true;
+}
+
+// *** WidgetScreen ***
+
+WidgetScreen::WidgetScreen() : _count(0) {
+}
+
+bool WidgetScreen::add(Widget* widget) {
+    if (widget == nullptr || _count >= WIDGET_SCREEN_CAPACITY) {
+        return false;
+    }
+    _widgets[_count++] = widget;
+    return true;
+}
+
+void WidgetScreen::invalidateAll() {
+    for (uint8_t i = 0; i < _count; i++) {
+        _widgets[i]->invalidate();
+    }
+}
+
+uint8_t WidgetScreen::render(Adafruit_GFX& gfx) {
+    uint8_t drawn = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+        if (_widgets[i]->render(gfx)) {
+            drawn++;
+        }
+    }
+    return drawn;
+}
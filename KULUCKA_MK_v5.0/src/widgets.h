@@ -0,0 +1,145 @@
+/**
+ * @file widgets.h
+ * @brief Ana ekran için kalıcı (retained) ekran öğeleri
+ * @version 1.0
+ */
+
+#ifndef WIDGETS_H
+#define WIDGETS_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include "config.h"
+#include "glyph_atlas.h"
+
+// Metin hizalama
+enum WidgetAlign {
+    WIDGET_ALIGN_LEFT,
+    WIDGET_ALIGN_CENTER,
+    WIDGET_ALIGN_RIGHT
+};
+
+// Ekran öğesi temel sınıfı. Her öğe kendi dikdörtgenine sahiptir ve yalnızca
+// görünür durumu değiştiğinde kirli işaretlenir. render() kirli öğeyi kendi
+// dikdörtgeni içinde yeniden çizer; dışına asla taşmaz. Zemin temizliği öğenin
+// kendi işidir (draw() içinde).
+class Widget {
+public:
+    // Yapılandırıcı
+    Widget();
+    virtual ~Widget() {}
+    
+    // Öğenin ekrandaki yeri
+    void setBounds(int16_t x, int16_t y, int16_t w, int16_t h);
+    
+    // Sonraki render() çağrısında yeniden çizilmesini zorla
+    virtual void invalidate();
+    
+    // Yeniden çizim bekliyor mu?
+    bool isDirty() const;
+    
+    // Kirliyse çiz; çizim yapıldıysa true döner
+    bool render(Adafruit_GFX& gfx);
+
+protected:
+    // Alt sınıflar içeriği çizer
+    virtual void draw(Adafruit_GFX& gfx) = 0;
+    
+    int16_t _x;
+    int16_t _y;
+    int16_t _w;
+    int16_t _h;
+    bool _dirty;
+};
+
+// Tek satırlık metin etiketi. Metin veya renk gerçekten değişmedikçe
+// setText()/setColor() öğeyi kirletmez; aynı değerin tekrar yazılması
+// SPI trafiği üretmez.
+class TextLabel : public Widget {
+public:
+    // Yapılandırıcı
+    TextLabel();
+    
+    // Konum, yazı boyutu, hizalama ve renk (yükseklik yazı boyutundan gelir)
+    void configure(int16_t x, int16_t y, int16_t w, uint8_t textSize,
+                   WidgetAlign align, uint16_t color);
+    
+    // Metni ayarla (sığmayan karakterler kırpılır)
+    void setText(const char* text);
+    
+    // Yazı rengini ayarla
+    void setColor(uint16_t color);
+    
+    // Mevcut metin
+    const char* getText() const;
+
+protected:
+    void draw(Adafruit_GFX& gfx) override;
+
+private:
+    char _text[WIDGET_TEXT_LENGTH];
+    uint8_t _textSize;
+    WidgetAlign _align;
+    uint16_t _color;
+};
+
+// Büyük rakam göstergesi (sıcaklık, nem, sayaçlar). Metin önceden taranmış
+// kenar yumuşatmalı glif atlasıyla çizilir: her glif tek blok olarak hedefe
+// yazılır. Yerleşim değişmediyse yalnızca değişen karakterlerin glifleri
+// yeniden yazılır; 37.5 -> 37.6 geçişi tek glif bloğudur.
+class DigitLabel : public Widget {
+public:
+    // Yapılandırıcı
+    DigitLabel();
+    
+    // Blok hedefi, konum, hizalama ve renk (yükseklik glif yüksekliğidir)
+    void configure(GlyphSink* sink, int16_t x, int16_t y, int16_t w,
+                   WidgetAlign align, uint16_t color);
+    
+    // Metni ayarla (sığmayan karakterler kırpılır)
+    void setText(const char* text);
+    
+    // Yazı rengini ayarla
+    void setColor(uint16_t color);
+    
+    // Mevcut metin
+    const char* getText() const;
+    
+    // Ekran silindiğinde: sonraki çizim tam olmalı
+    void invalidate() override;
+
+protected:
+    void draw(Adafruit_GFX& gfx) override;
+
+private:
+    GlyphSink* _sink;
+    char _text[WIDGET_TEXT_LENGTH];
+    char _drawnText[WIDGET_TEXT_LENGTH];   // Panelde şu an görünen metin
+    int16_t _drawnX;
+    bool _drawnValid;
+    WidgetAlign _align;
+    uint16_t _color;
+};
+
+// Bir ekrandaki öğelerin listesi. Öğeler sahibinde (Display) yaşar; burada
+// yalnızca işaretçileri tutulur.
+class WidgetScreen {
+public:
+    // Yapılandırıcı
+    WidgetScreen();
+    
+    // Öğe ekle (kapasite doluysa false)
+    bool add(Widget* widget);
+    
+    // Tüm öğeleri kirli işaretle (tam ekran yeniden çizimden sonra)
+    void invalidateAll();
+    
+    // Kirli öğeleri çiz; çizilen öğe sayısını döndürür
+    uint8_t render(Adafruit_GFX& gfx);
+
+private:
+    Widget* _widgets[WIDGET_SCREEN_CAPACITY];
+    uint8_t _count;
+};
+
+#endif // WIDGETS_H
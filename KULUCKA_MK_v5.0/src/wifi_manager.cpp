@@ -1,6 +1,6 @@
 /**
  * @file wifi_manager.cpp
- * @brief WiFi bağlantı ve web sunucu yönetimi uygulaması (WebServer ile)
+ * @brief WiFi bağlantı ve web sunucu yönetimi uygulaması (engellemeyen HTTP sunucusu ile)
  * @version 1.7 - Tüm hatalar düzeltildi ve eksik fonksiyonlar eklendi
  */
 
@@ -13,6 +13,9 @@
 #include "alarm.h"
 #include "rtc.h"
 #include "ota_manager.h"
+#include "plant_identifier.h"
+#include "perf_monitor.h"
+#include "status_frame.h"
 #include <esp_ota_ops.h>
 
 // Global OTA Manager nesnesine erişim
@@ -98,6 +101,13 @@ WiFiManager::WiFiManager() {
     _jsonBuffer = nullptr;
     _responseBuffer = nullptr;
     _buffersAllocated = false;
+    _responseBufferBusy = false;
+    
+    // Durum sürümü; yeniden başlatma sonrası eski ETag'lerle çakışmaması için
+    // her açılışta rastgele bir önek kullanılır
+    _stateVersion = 0;
+    _stateHash = 0;
+    _bootId = esp_random();
     _serverRecreationNeeded = false;
     _lastServerRestart = 0;
 }
@@ -631,6 +641,15 @@ void WiFiManager::handleRequests() {
     if (_isServerRunning && _server) {
         _server->handleClient();
         
+        // Canlı telemetri: bağlantıları işle, değişiklik varsa tek çerçeve yayınla
+        _telemetryStream.handle();
+        if (_telemetryStream.isPublishDue()) {
+            _publishTelemetry();
+        }
+        
+        // Arka plan WiFi taraması (başlatma ve sonuç toplama, beklemeden)
+        _scanner.handle();
+        
         // Periyodik bellek kontrolü - YENİ EKLENECEK
         unsigned long currentMillis = millis();
         if (currentMillis - _lastServerCheck > 10000) {  // Her 10 saniyede bir
@@ -661,6 +680,9 @@ void WiFiManager::handleRequests() {
             } else if (currentHeap > 50000 && _memoryProtectionActive) {
                 _memoryProtectionActive = false;
                 Serial.println("WiFi: Bellek normale döndü");
+                
+                // Acil temizlikte bırakılan yanıt buffer'larını geri al
+                _allocateBuffers();
             }
             
             _lastFreeHeap = currentHeap;
@@ -1050,491 +1072,358 @@ void WiFiManager::_checkConnectionStatus() {
     }
 }
 
-void WiFiManager::_scanWiFiNetworks() {
-    WiFi.scanNetworks(true);
-}
-
-String WiFiManager::_getHtmlContent() {
-    static const char HTML_TEMPLATE[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-<meta name='viewport' content='width=device-width, initial-scale=1'>
-<style>
-body { font-family: Arial; margin: 0; padding: 20px; background-color: #f0f0f0; }
-.card { background-color: white; padding: 20px; margin-bottom: 15px; border-radius: 10px; box-shadow: 0 2px 4px rgba(0,0,0,0.1); }
-.row:after { content: ''; display: table; clear: both; }
-.column { float: left; width: 50%; }
-h1 { color: #333; text-align: center; margin-bottom: 30px; }
-h2 { color: #333; margin-top: 0; }
-.temp { color: #e74c3c; font-weight: bold; }
-.humid { color: #3498db; font-weight: bold; }
-.status { font-weight: bold; }
-.active { color: #27ae60; }
-.inactive { color: #95a5a6; }
-.button { background-color: #3498db; color: white; padding: 10px 20px; border: none; border-radius: 5px; cursor: pointer; margin: 5px; }
-.button:hover { background-color: #2980b9; }
-.button.red { background-color: #e74c3c; }
-.button.red:hover { background-color: #c0392b; }
-.button.green { background-color: #27ae60; }
-.button.green:hover { background-color: #229954; }
-.nav { text-align: center; margin-bottom: 20px; }
-.control-panel { margin-top: 20px; }
-.input-group { margin-bottom: 10px; }
-.input-group label { display: inline-block; width: 120px; }
-.input-group input, .input-group select { padding: 5px; margin-left: 10px; }
-.alarm-status { padding: 10px; margin: 10px 0; border-radius: 5px; font-weight: bold; }
-.alarm-enabled { background-color: #d4edda; color: #155724; border: 1px solid #c3e6cb; }
-.alarm-disabled { background-color: #f8d7da; color: #721c24; border: 1px solid #f5c6cb; }
-.completion-status { background-color: #fff3cd; color: #856404; border: 1px solid #ffeaa7; padding: 10px; margin: 10px 0; border-radius: 5px; font-weight: bold; }
-</style>
-<script>
-let statusData = {};
-
-function updateStatus() {
-  fetch('/api/status').then(response => response.json()).then(data => {
-    statusData = data;
-    document.getElementById('temp').innerHTML = data.temperature.toFixed(1) + '&deg;C';
-    document.getElementById('humid').innerHTML = data.humidity.toFixed(0) + '%';
-    document.getElementById('targetTemp').innerHTML = data.targetTemp.toFixed(1) + '&deg;C';
-    document.getElementById('targetHumid').innerHTML = data.targetHumid.toFixed(0) + '%';
-    document.getElementById('day').innerHTML = data.displayDay + '/' + data.totalDays;
-    document.getElementById('type').innerHTML = data.incubationType;
-    
-    document.getElementById('heater').className = data.heaterState ? 'status active' : 'status inactive';
-    document.getElementById('heater').innerHTML = data.heaterState ? 'AÇIK' : 'KAPALI';
-    document.getElementById('humidifier').className = data.humidifierState ? 'status active' : 'status inactive';
-    document.getElementById('humidifier').innerHTML = data.humidifierState ? 'AÇIK' : 'KAPALI';
-    document.getElementById('motor').className = data.motorState ? 'status active' : 'status inactive';
-    document.getElementById('motor').innerHTML = data.motorState ? 'AÇIK' : 'KAPALI';
-    
-    const alarmStatus = document.getElementById('alarmStatus');
-    if (data.alarmEnabled) {
-      alarmStatus.className = 'alarm-status alarm-enabled';
-      alarmStatus.innerHTML = 'Alarmlar Aktif';
-    } else {
-      alarmStatus.className = 'alarm-status alarm-disabled';
-      alarmStatus.innerHTML = 'Alarmlar Devre Dışı';
-    }
+void WiFiManager::_sendAsset(const WebAsset& asset) {
+    // İçerik özetine dayalı ETag: yalnızca firmware'deki sayfa değişince geçersizleşir
+    _server->sendHeader("ETag", asset.etag);
+    _server->sendHeader("Cache-Control", WEB_ASSET_CACHE_CONTROL);
     
-    const completionStatus = document.getElementById('completionStatus');
-    if (data.isIncubationCompleted) {
-      completionStatus.className = 'completion-status';
-      completionStatus.innerHTML = 'Kuluçka Süresi Tamamlandı - Çıkım Devam Ediyor (Gerçek Gün: ' + data.actualDay + ')';
-      completionStatus.style.display = 'block';
-    } else {
-      completionStatus.style.display = 'none';
+    if (_server->hasHeader("If-None-Match") && _server->header("If-None-Match").indexOf(asset.etag) >= 0) {
+        _server->send(304);
+        return;
     }
     
-    document.getElementById('targetTempInput').value = data.targetTemp.toFixed(1);
-    document.getElementById('targetHumidInput').value = data.targetHumid.toFixed(0);
-    document.getElementById('incubationTypeSelect').value = data.incubationType;
-    document.getElementById('pidModeSelect').value = data.pidMode;
-    document.getElementById('alarmEnabledCheckbox').checked = data.alarmEnabled;
-  }).catch(error => {
-    console.log('Durum güncelleme hatası:', error);
-  });
-  setTimeout(updateStatus, 2000);
+    _server->sendHeader("Content-Encoding", "gzip");
+    _server->sendStatic(200, asset.contentType, asset.data, asset.length);
 }
 
-function setTargetTemp() {
-  const temp = document.getElementById('targetTempInput').value;
-  sendCommand('/api/temperature', {targetTemp: parseFloat(temp)});
+char* WiFiManager::_acquireResponseBuffer() {
+    if (!_buffersAllocated || _responseBufferBusy) {
+        return nullptr;
+    }
+    
+    _responseBufferBusy = true;
+    return _responseBuffer;
 }
 
-function setTargetHumid() {
-  const humid = document.getElementById('targetHumidInput').value;
-  sendCommand('/api/humidity', {targetHumid: parseFloat(humid)});
+void WiFiManager::_sendResponseBuffer(int code, const char* contentType, size_t length) {
+    // Gövde kopyalanmaz; buffer bağlantı gönderimi bitirince serbest kalır
+    _server->sendBuffer(code, contentType, (const uint8_t*)_responseBuffer, length, [this]() {
+        _releaseResponseBuffer();
+    });
 }
 
-function setIncubationType() {
-  const type = document.getElementById('incubationTypeSelect').value;
-  sendCommand('/api/incubation', {incubationType: parseInt(type)});
+void WiFiManager::_releaseResponseBuffer() {
+    _responseBufferBusy = false;
+}
+
+void WiFiManager::_fillStatusSnapshot(StatusSnapshot& status, char* statusText, size_t size) {
+    status.currentTemp = _currentTemp;
+    status.currentHumid = _currentHumid;
+    status.heaterState = _heaterState;
+    status.humidifierState = _humidifierState;
+    status.motorState = _motorState;
+    
+    status.temp1 = _temp1;
+    status.humid1 = _humid1;
+    status.temp2 = _temp2;
+    status.humid2 = _humid2;
+    status.sensor1Working = _sensor1Working;
+    status.sensor2Working = _sensor2Working;
+    status.tempCalibration1 = _tempCalibration1;
+    status.humidCalibration1 = _humidCalibration1;
+    status.tempCalibration2 = _tempCalibration2;
+    status.humidCalibration2 = _humidCalibration2;
+    
+    status.currentDay = _currentDay;
+    status.totalDays = _totalDays;
+    status.actualDay = _actualDay;
+    status.incubationType = _incubationType.c_str();
+    status.targetTemp = _targetTemp;
+    status.targetHumid = _targetHumid;
+    status.isIncubationRunning = _isIncubationRunning;
+    status.isIncubationCompleted = _isIncubationCompleted;
+    
+    status.pidMode = _pidMode;
+    status.pidKp = _pidKp;
+    status.pidKi = _pidKi;
+    status.pidKd = _pidKd;
+    
+    status.alarmEnabled = _alarmEnabled;
+    status.tempLowAlarm = _tempLowAlarm;
+    status.tempHighAlarm = _tempHighAlarm;
+    status.humidLowAlarm = _humidLowAlarm;
+    status.humidHighAlarm = _humidHighAlarm;
+    
+    status.motorWaitTime = _motorWaitTime;
+    status.motorRunTime = _motorRunTime;
+    
+    status.manualDevTemp = _manualDevTemp;
+    status.manualHatchTemp = _manualHatchTemp;
+    status.manualDevHumid = _manualDevHumid;
+    status.manualHatchHumid = _manualHatchHumid;
+    status.manualDevDays = _manualDevDays;
+    status.manualHatchDays = _manualHatchDays;
+    
+    // WiFi bilgileri (String üretmeden)
+    _formatStatusString(statusText, size);
+    status.wifiStatus = (uint8_t)_connectionStatus;
+    status.wifiStatusText = statusText;
+    IPAddress ip(0, 0, 0, 0);
+    if (WiFi.getMode() == WIFI_STA) {
+        ip = WiFi.localIP();
+    } else if (WiFi.getMode() == WIFI_AP) {
+        ip = WiFi.softAPIP();
+    }
+    for (uint8_t i = 0; i < 4; i++) {
+        status.ipAddress[i] = ip[i];
+    }
+    status.wifiModeAP = getCurrentMode() == WIFI_AP;
+    status.ssid = _ssid.c_str();
+    status.signalStrength = getSignalStrength();
+    
+    // Sistem bilgileri
+    status.timestamp = millis();
+    status.freeHeap = ESP.getFreeHeap();
+    status.uptime = millis() / 1000;
+    status.lastSave = _storage ? _storage->getTimeSinceLastSave() / 1000 : 0;
+    status.pendingChanges = _storage ? _storage->getPendingChanges() : 0;
 }
 
-function setPIDMode() {
-  const mode = document.getElementById('pidModeSelect').value;
-  sendCommand('/api/pid', {pidMode: parseInt(mode)});
+size_t WiFiManager::_writeStatusJson(char* buffer, size_t size) {
+    StatusSnapshot status;
+    char text[64];
+    
+    _fillStatusSnapshot(status, text, sizeof(text));
+    return writeStatusJson(status, buffer, size);
 }
 
-function toggleAlarm() {
-  const enabled = document.getElementById('alarmEnabledCheckbox').checked;
-  sendCommand('/api/alarm', {alarmEnabled: enabled});
+size_t WiFiManager::_writeStatusBinary(uint8_t* buffer, size_t size) {
+    StatusSnapshot status;
+    char text[64];
+    
+    _fillStatusSnapshot(status, text, sizeof(text));
+    return writeStatusFrame(status, getStateVersion(), buffer, size);
 }
 
-function startIncubation() {
-  sendCommand('/api/incubation', {isIncubationRunning: true});
+bool WiFiManager::_acceptsBinaryStatus() {
+    String accept = _server->header("Accept");
+    return accept.indexOf(STATUS_FRAME_CONTENT_TYPE) >= 0 ||
+           accept.indexOf("application/octet-stream") >= 0;
 }
 
-function stopIncubation() {
-  if(confirm('Kuluçka durduruluyor. Emin misiniz?')) {
-    sendCommand('/api/incubation', {isIncubationRunning: false});
-  }
+void WiFiManager::_formatStatusString(char* buffer, size_t size) const {
+    // getStatusString() ile aynı metinler, heap kullanmadan
+    switch (_connectionStatus) {
+        case WIFI_STATUS_DISCONNECTED:
+            snprintf(buffer, size, "Bağlantısız");
+            break;
+        case WIFI_STATUS_CONNECTING:
+            snprintf(buffer, size, "Bağlanıyor...");
+            break;
+        case WIFI_STATUS_CONNECTED:
+            snprintf(buffer, size, "Bağlı (%s)", _ssid.c_str());
+            break;
+        case WIFI_STATUS_FAILED:
+            snprintf(buffer, size, "Bağlantı Başarısız");
+            break;
+        case WIFI_STATUS_AP_MODE:
+            snprintf(buffer, size, "AP Modu (%s)", _ssid.c_str());
+            break;
+        default:
+            snprintf(buffer, size, "Bilinmeyen");
+            break;
+    }
 }
 
-function sendCommand(url, data) {
-  fetch(url, {
-    method: 'POST',
-    headers: { 'Content-Type': 'application/json' },
-    body: JSON.stringify(data)
-  })
-  .then(response => response.json())
-  .then(result => {
-    if(result.status === 'success') {
-      alert('İşlem başarılı!');
-      setTimeout(updateStatus, 500);
-    } else {
-      alert('Hata: ' + result.message);
-    }
-  })
-  .catch(error => {
-    alert('Bağlantı hatası: ' + error);
-  });
-}
-
-document.addEventListener('DOMContentLoaded', updateStatus);
-</script>
-</head>
-<body>
-<h1>KULUÇKA MK v5.0</h1>
-<div class='nav'>
-<button class='button' onclick="location.href='/'">Ana Sayfa</button>
-<button class='button' onclick="location.href='/wifi'">WiFi Ayarları</button>
-</div>
-
-<div class='card'>
-<h2>Sıcaklık ve Nem</h2>
-<div class='row'>
-<div class='column'>
-<h3>Sıcaklık: <span id='temp' class='temp'>--.-&deg;C</span></h3>
-<p>Hedef: <span id='targetTemp'>--.-&deg;C</span></p>
-<p>Isıtıcı: <span id='heater' class='status'>--</span></p>
-</div>
-<div class='column'>
-<h3>Nem: <span id='humid' class='humid'>--%</span></h3>
-<p>Hedef: <span id='targetHumid'>--%</span></p>
-<p>Nemlendirici: <span id='humidifier' class='status'>--</span></p>
-</div>
-</div>
-</div>
-
-<div class='card'>
-<h2>Kuluçka Durumu</h2>
-<div class='row'>
-<div class='column'>
-<h3>Gün: <span id='day'>--/--</span></h3>
-<p>Tip: <span id='type'>--</span></p>
-</div>
-<div class='column'>
-<h3>Motor: <span id='motor' class='status'>--</span></h3>
-</div>
-</div>
-<div id='completionStatus' style='display: none;'></div>
-</div>
-
-<div class='card'>
-<h2>Alarm Durumu</h2>
-<div id='alarmStatus' class='alarm-status'>Alarm durumu yükleniyor...</div>
-</div>
-
-<div class='card'>
-<h2>Kontrol Paneli</h2>
-<div class='control-panel'>
-<div class='input-group'>
-<label>Hedef Sıcaklık:</label>
-<input type='number' id='targetTempInput' step='0.1' min='20' max='40'>
-<button class='button' onclick='setTargetTemp()'>Ayarla</button>
-</div>
-<div class='input-group'>
-<label>Hedef Nem:</label>
-<input type='number' id='targetHumidInput' step='1' min='30' max='90'>
-<button class='button' onclick='setTargetHumid()'>Ayarla</button>
-</div>
-<div class='input-group'>
-<label>Kuluçka Tipi:</label>
-<select id='incubationTypeSelect'>
-<option value='0'>Tavuk</option>
-<option value='1'>Bıldırcın</option>
-<option value='2'>Kaz</option>
-<option value='3'>Manuel</option>
-</select>
-<button class='button' onclick='setIncubationType()'>Ayarla</button>
-</div>
-<div class='input-group'>
-<label>PID Modu:</label>
-<select id='pidModeSelect'>
-<option value='0'>Kapalı</option>
-<option value='1'>Manuel</option>
-<option value='2'>Otomatik</option>
-</select>
-<button class='button' onclick='setPIDMode()'>Ayarla</button>
-</div>
-<div class='input-group'>
-<label>Alarm:</label>
-<input type='checkbox' id='alarmEnabledCheckbox'>
-<button class='button' onclick='toggleAlarm()'>Ayarla</button>
-</div>
-<div class='input-group'>
-<button class='button green' onclick='startIncubation()'>Kuluçka Başlat</button>
-<button class='button red' onclick='stopIncubation()'>Kuluçka Durdur</button>
-</div>
-</div>
-</div>
-
-</body>
-</html>
-)rawliteral";
-    
-    return FPSTR(HTML_TEMPLATE);
-}
-
-String WiFiManager::_getWiFiConfigHTML() {
-    static const char WIFI_HTML_TEMPLATE[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-<meta name='viewport' content='width=device-width, initial-scale=1'>
-<style>
-body { font-family: Arial; margin: 0; padding: 20px; background-color: #f0f0f0; }
-.card { background-color: white; padding: 20px; margin-bottom: 15px; border-radius: 10px; box-shadow: 0 2px 4px rgba(0,0,0,0.1); }
-h1 { color: #333; text-align: center; }
-.form-group { margin-bottom: 15px; }
-label { display: block; margin-bottom: 5px; font-weight: bold; }
-input, select { width: 100%; padding: 10px; border: 1px solid #ddd; border-radius: 5px; box-sizing: border-box; }
-.button { background-color: #3498db; color: white; padding: 10px 20px; border: none; border-radius: 5px; cursor: pointer; margin: 5px; }
-.button:hover { background-color: #2980b9; }
-.button.green { background-color: #27ae60; }
-.button.green:hover { background-color: #229954; }
-.nav { text-align: center; margin-bottom: 20px; }
-.network-list { max-height: 200px; overflow-y: auto; border: 1px solid #ddd; border-radius: 5px; }
-.network-item { padding: 10px; border-bottom: 1px solid #eee; cursor: pointer; }
-.network-item:hover { background-color: #f8f9fa; }
-.network-item:last-child { border-bottom: none; }
-</style>
-<script>
-function selectNetwork(ssid) {
-  document.getElementById('stationSSID').value = ssid;
-}
-
-function connectToWiFi() {
-  const ssid = document.getElementById('stationSSID').value;
-  const password = document.getElementById('stationPassword').value;
-  
-  if (!ssid) {
-    alert('Lütfen bir WiFi ağı seçin veya SSID girin');
-    return;
-  }
-  
-  const data = {
-    ssid: ssid,
-    password: password
-  };
-  
-  fetch('/api/wifi/connect', {
-    method: 'POST',
-    headers: { 'Content-Type': 'application/json' },
-    body: JSON.stringify(data)
-  })
-  .then(response => response.json())
-  .then(data => {
-    if (data.status === 'success') {
-      alert('WiFi bağlantısı başlatıldı. Lütfen bekleyin...');
-      setTimeout(() => location.reload(), 5000);
-    } else {
-      alert('Hata: ' + data.message);
+#define FNV1A32_SEED 2166136261UL
+
+// FNV-1a ile durum alanlarını tek bir özete ekle
+static uint32_t fnv1a32(uint32_t hash, const void* data, size_t length) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619UL;
     }
-  })
-  .catch(error => {
-    alert('Bağlantı hatası: ' + error);
-  });
+    return hash;
 }
 
-function switchToAP() {
-  fetch('/api/wifi/ap', { method: 'POST' })
-  .then(response => response.json())
-  .then(data => {
-    if (data.status === 'success') {
-      alert('AP moduna geçiliyor...');
-      setTimeout(() => location.reload(), 3000);
-    } else {
-      alert('Hata: ' + data.message);
-    }
-  });
-}
-
-function loadNetworks() {
-  fetch('/api/wifi/networks')
-  .then(response => response.json())
-  .then(data => {
-    const networkList = document.getElementById('networkList');
-    networkList.innerHTML = '';
-    
-    if (data.networks && data.networks.length > 0) {
-      data.networks.forEach(network => {
-        const item = document.createElement('div');
-        item.className = 'network-item';
-        item.innerHTML = `<strong>${network.ssid}</strong> (${network.rssi} dBm)`;
-        item.onclick = () => selectNetwork(network.ssid);
-        networkList.appendChild(item);
-      });
-    } else {
-      networkList.innerHTML = '<p>Ağ bulunamadı</p>';
-    }
-  })
-  .catch(error => {
-    console.error('Ağ listesi yüklenemedi:', error);
-    document.getElementById('networkList').innerHTML = '<p>Ağ listesi yüklenemedi</p>';
-  });
-}
-
-document.addEventListener('DOMContentLoaded', loadNetworks);
-</script>
-</head>
-<body>
-<h1>WiFi Ayarları</h1>
-<div class='nav'>
-<button class='button' onclick="location.href='/'">Ana Sayfa</button>
-<button class='button' onclick="switchToAP()">AP Moduna Geç</button>
-</div>
-<div class='card'>
-<h2>Mevcut Ağlar</h2>
-<div id='networkList' class='network-list'>
-<p>Ağlar yükleniyor...</p>
-</div>
-<button class='button' onclick="loadNetworks()">Yenile</button>
-</div>
-<div class='card'>
-<h2>WiFi Bağlantısı</h2>
-<div class='form-group'>
-<label for='stationSSID'>Ağ Adı (SSID):</label>
-<input type='text' id='stationSSID' placeholder='WiFi ağ adını girin'>
-</div>
-<div class='form-group'>
-<label for='stationPassword'>Şifre:</label>
-<input type='password' id='stationPassword' placeholder='WiFi şifresini girin'>
-</div>
-<button class='button green' onclick="connectToWiFi()">Bağlan</button>
-</div>
-</body>
-</html>
-)rawliteral";
-    return FPSTR(WIFI_HTML_TEMPLATE);
-}
-
-String WiFiManager::_getStatusJson() {
-    StaticJsonDocument<3072> doc;
+// Ölçümü yayınlanan çözünürlüğe yuvarlayıp ekle; ham float bitlerindeki
+// gürültü (37.5000 / 37.5001) sürümü ve ETag'i boşuna değiştirmez
+static uint32_t fnv1a32Quantized(uint32_t hash, float value, float scale) {
+    int32_t quantized = isnan(value) ? INT32_MIN : (int32_t)lroundf(value * scale);
+    return fnv1a32(hash, &quantized, sizeof(quantized));
+}
+
+// serializeJson hedefi: çıktıyı saklamadan özetini hesaplar (içerik ETag'i için)
+struct Fnv1a32Writer {
+    uint32_t hash = FNV1A32_SEED;
     
-    // Temel sensör verileri
-    doc["temperature"] = _currentTemp;
-    doc["humidity"] = _currentHumid;
-    doc["heaterState"] = _heaterState;
-    doc["humidifierState"] = _humidifierState;
-    doc["motorState"] = _motorState;
+    size_t write(uint8_t c) {
+        hash = fnv1a32(hash, &c, 1);
+        return 1;
+    }
     
-    // Detaylı sensör verileri
-    JsonObject sensors = doc.createNestedObject("sensors");
-    JsonObject sensor1 = sensors.createNestedObject("sensor1");
-    sensor1["temperature"] = _temp1;
-    sensor1["humidity"] = _humid1;
-    sensor1["working"] = _sensor1Working;
-    sensor1["tempCalibration"] = _tempCalibration1;
-    sensor1["humidCalibration"] = _humidCalibration1;
+    size_t write(const uint8_t* data, size_t length) {
+        hash = fnv1a32(hash, data, length);
+        return length;
+    }
+};
+
+uint32_t WiFiManager::_hashState() const {
+    uint32_t h = FNV1A32_SEED;
     
-    JsonObject sensor2 = sensors.createNestedObject("sensor2");
-    sensor2["temperature"] = _temp2;
-    sensor2["humidity"] = _humid2;
-    sensor2["working"] = _sensor2Working;
-    sensor2["tempCalibration"] = _tempCalibration2;
-    sensor2["humidCalibration"] = _humidCalibration2;
+    // Yayınlanan ölçüm ve durum alanları (ölçümler gösterilen hassasiyette)
+    h = fnv1a32Quantized(h, _currentTemp, STATE_HASH_MEASUREMENT_SCALE);
+    h = fnv1a32Quantized(h, _currentHumid, STATE_HASH_MEASUREMENT_SCALE);
+    h = fnv1a32(h, &_heaterState, sizeof(_heaterState));
+    h = fnv1a32(h, &_humidifierState, sizeof(_humidifierState));
+    h = fnv1a32(h, &_motorState, sizeof(_motorState));
+    h = fnv1a32Quantized(h, _temp1, STATE_HASH_MEASUREMENT_SCALE);
+    h = fnv1a32Quantized(h, _temp2, STATE_HASH_MEASUREMENT_SCALE);
+    h = fnv1a32Quantized(h, _humid1, STATE_HASH_MEASUREMENT_SCALE);
+    h = fnv1a32Quantized(h, _humid2, STATE_HASH_MEASUREMENT_SCALE);
+    h = fnv1a32(h, &_sensor1Working, sizeof(_sensor1Working));
+    h = fnv1a32(h, &_sensor2Working, sizeof(_sensor2Working));
     
     // Kuluçka verileri
-    doc["currentDay"] = _currentDay;
-    doc["totalDays"] = _totalDays;
-    doc["incubationType"] = _incubationType;
-    
-    // ÖNEMLİ: Gerçek hedef değerleri kullan
-    doc["targetTemp"] = _targetTemp;
-    doc["targetHumid"] = _targetHumid;
-    
-    doc["isIncubationRunning"] = _isIncubationRunning;
-    doc["isIncubationCompleted"] = _isIncubationCompleted;
-    doc["actualDay"] = _actualDay;
-    doc["displayDay"] = _currentDay;
-    
-    // PID verileri
-    doc["pidMode"] = _pidMode;
-    doc["pidKp"] = _pidKp;
-    doc["pidKi"] = _pidKi;
-    doc["pidKd"] = _pidKd;
-    
-    // Alarm verileri - DETAYLI
-    JsonObject alarms = doc.createNestedObject("alarms");
-    alarms["enabled"] = _alarmEnabled;
-    alarms["tempLow"] = _tempLowAlarm;
-    alarms["tempHigh"] = _tempHighAlarm;
-    alarms["humidLow"] = _humidLowAlarm;
-    alarms["humidHigh"] = _humidHighAlarm;
-    
-    // Motor ayarları
-    doc["motorWaitTime"] = _motorWaitTime;
-    doc["motorRunTime"] = _motorRunTime;
-    
-    // Kalibrasyon verileri
-    doc["tempCalibration1"] = _tempCalibration1;
-    doc["tempCalibration2"] = _tempCalibration2;
-    doc["humidCalibration1"] = _humidCalibration1;
-    doc["humidCalibration2"] = _humidCalibration2;
-    
-    // Manuel kuluçka parametreleri
-    doc["manualDevTemp"] = _manualDevTemp;
-    doc["manualHatchTemp"] = _manualHatchTemp;
-    doc["manualDevHumid"] = _manualDevHumid;
-    doc["manualHatchHumid"] = _manualHatchHumid;
-    doc["manualDevDays"] = _manualDevDays;
-    doc["manualHatchDays"] = _manualHatchDays;
-    
-    // WiFi bilgileri
-    doc["wifiStatus"] = getStatusString();
-    doc["ipAddress"] = getIPAddress();
-    doc["wifiMode"] = (getCurrentMode() == WIFI_AP) ? "AP" : "Station";
-    doc["ssid"] = _ssid;
-    doc["signalStrength"] = getSignalStrength();
-    
-    // Sistem bilgileri
-    doc["timestamp"] = millis();
-    doc["freeHeap"] = ESP.getFreeHeap();
-    doc["uptime"] = millis() / 1000;
-    doc["firmwareVersion"] = "5.0";
-    
-    // Sistem güvenilirlik bilgisi - YENİ
-    JsonObject reliability = doc.createNestedObject("reliability");
-    reliability["lastSave"] = _storage ? _storage->getTimeSinceLastSave() / 1000 : 0;
-    reliability["pendingChanges"] = _storage ? _storage->getPendingChanges() : 0;
-    reliability["autoSaveEnabled"] = true;
-    reliability["criticalParamsProtected"] = true;
+    h = fnv1a32(h, &_currentDay, sizeof(_currentDay));
+    h = fnv1a32(h, &_totalDays, sizeof(_totalDays));
+    h = fnv1a32(h, _incubationType.c_str(), _incubationType.length());
+    h = fnv1a32Quantized(h, _targetTemp, STATE_HASH_SETTING_SCALE);
+    h = fnv1a32Quantized(h, _targetHumid, STATE_HASH_SETTING_SCALE);
+    h = fnv1a32(h, &_isIncubationRunning, sizeof(_isIncubationRunning));
+    h = fnv1a32(h, &_isIncubationCompleted, sizeof(_isIncubationCompleted));
+    h = fnv1a32(h, &_actualDay, sizeof(_actualDay));
+    
+    // Ayarlar
+    h = fnv1a32(h, &_pidMode, sizeof(_pidMode));
+    h = fnv1a32Quantized(h, _pidKp, STATE_HASH_GAIN_SCALE);
+    h = fnv1a32Quantized(h, _pidKi, STATE_HASH_GAIN_SCALE);
+    h = fnv1a32Quantized(h, _pidKd, STATE_HASH_GAIN_SCALE);
+    h = fnv1a32(h, &_alarmEnabled, sizeof(_alarmEnabled));
+    h = fnv1a32Quantized(h, _tempLowAlarm, STATE_HASH_SETTING_SCALE);
+    h = fnv1a32Quantized(h, _tempHighAlarm, STATE_HASH_SETTING_SCALE);
+    h = fnv1a32Quantized(h, _humidLowAlarm, STATE_HASH_SETTING_SCALE);
+    h = fnv1a32Quantized(h, _humidHighAlarm, STATE_HASH_SETTING_SCALE);
+    h = fnv1a32(h, &_motorWaitTime, sizeof(_motorWaitTime));
+    h = fnv1a32(h, &_motorRunTime, sizeof(_motorRunTime));
+    h = fnv1a32Quantized(h, _tempCalibration1, STATE_HASH_SETTING_SCALE);
+    h = fnv1a32Quantized(h, _tempCalibration2, STATE_HASH_SETTING_SCALE);
+    h = fnv1a32Quantized(h, _humidCalibration1, STATE_HASH_SETTING_SCALE);
+    h = fnv1a32Quantized(h, _humidCalibration2, STATE_HASH_SETTING_SCALE);
+    h = fnv1a32Quantized(h, _manualDevTemp, STATE_HASH_SETTING_SCALE);
+    h = fnv1a32Quantized(h, _manualHatchTemp, STATE_HASH_SETTING_SCALE);
+    h = fnv1a32(h, &_manualDevHumid, sizeof(_manualDevHumid));
+    h = fnv1a32(h, &_manualHatchHumid, sizeof(_manualHatchHumid));
+    h = fnv1a32(h, &_manualDevDays, sizeof(_manualDevDays));
+    h = fnv1a32(h, &_manualHatchDays, sizeof(_manualHatchDays));
+    
+    // WiFi bilgileri; RSSI gürültüsü sürümü sürekli artırmasın diye 5 dBm'e yuvarlanır
+    h = fnv1a32(h, &_connectionStatus, sizeof(_connectionStatus));
+    h = fnv1a32(h, _ssid.c_str(), _ssid.length());
+    h = fnv1a32(h, _stationSSID.c_str(), _stationSSID.length());
+    uint32_t passwordLength = _stationPassword.length();
+    h = fnv1a32(h, &passwordLength, sizeof(passwordLength));
+    uint32_t ip = (WiFi.getMode() == WIFI_AP) ? (uint32_t)WiFi.softAPIP() : (uint32_t)WiFi.localIP();
+    h = fnv1a32(h, &ip, sizeof(ip));
+    int rssiBucket = getSignalStrength() / 5;
+    h = fnv1a32(h, &rssiBucket, sizeof(rssiBucket));
+    
+    uint32_t pending = _storage ? _storage->getPendingChanges() : 0;
+    h = fnv1a32(h, &pending, sizeof(pending));
+    
+    return h;
+}
+
+void WiFiManager::_publishTelemetry() {
+    TelemetrySnapshot snapshot;
+    snapshot.temperature = _currentTemp;
+    snapshot.humidity = _currentHumid;
+    snapshot.temp1 = _temp1;
+    snapshot.temp2 = _temp2;
+    snapshot.humid1 = _humid1;
+    snapshot.humid2 = _humid2;
+    snapshot.targetTemp = _targetTemp;
+    snapshot.targetHumid = _targetHumid;
+    snapshot.heaterState = _heaterState;
+    snapshot.humidifierState = _humidifierState;
+    snapshot.motorState = _motorState;
+    snapshot.sensor1Working = _sensor1Working;
+    snapshot.sensor2Working = _sensor2Working;
+    snapshot.isIncubationRunning = _isIncubationRunning;
+    snapshot.currentDay = _currentDay;
+    snapshot.totalDays = _totalDays;
+    snapshot.pidMode = _pidMode;
+    
+    _telemetryStream.publish(snapshot, getStateVersion());
+}
+
+uint32_t WiFiManager::getStateVersion() {
+    uint32_t hash = _hashState();
+    if (hash != _stateHash) {
+        _stateHash = hash;
+        _stateVersion++;
+    }
+    return _stateVersion;
+}
+
+void WiFiManager::_formatETag(char* buffer, size_t size, const char* variant) {
+    // Aynı sürümün farklı gösterimleri (JSON / ikili) farklı ETag taşır. Sürüm
+    // yayınlanan her alanı bayt bayt kapsamadığı için (zaman damgası, boş bellek,
+    // yuvarlanmış ölçümler ve RSSI) ETag zayıf (W/) verilir: aynı sürümdeki
+    // gövdeler anlamca eşdeğerdir ama bayt bayt aynı olmayabilir
+    snprintf(buffer, size, "W/\"%08lx-%lu%s%s\"", (unsigned long)_bootId, (unsigned long)getStateVersion(),
+             variant ? "-" : "", variant ? variant : "");
+}
+
+bool WiFiManager::_handleNotModified(const char* variant) {
+    // Zaman damgası, boş bellek gibi sürekli değişen tanılama alanları sürüme
+    // dahil değildir; 304 yanıtında istemci önceki değerleri kullanır
+    char etag[40];
+    _formatETag(etag, sizeof(etag), variant);
+    _server->sendHeader("ETag", etag);
+    _server->sendHeader("Cache-Control", "no-cache");
+    
+    // If-None-Match zayıf karşılaştırma kullanır: "W/" öneki olsun olmasın
+    // tırnaklı etiket eşleşirse yeterlidir
+    const char* opaqueTag = etag + 2;
+    if (_server->hasHeader("If-None-Match") && _server->header("If-None-Match").indexOf(opaqueTag) >= 0) {
+        _server->send(304);
+        return true;
+    }
+    return false;
+}
+
+bool WiFiManager::_handleContentNotModified(uint32_t contentHash) {
+    // Şemalar ve PID/motor ayrıntıları durum sürümüne girmeyen alanlar taşır;
+    // bunlar gönderilecek içeriğin kendi özetiyle doğrulanır
+    char etag[16];
+    snprintf(etag, sizeof(etag), "\"%08lx\"", (unsigned long)contentHash);
+    _server->sendHeader("ETag", etag);
     
-    String jsonString;
-    serializeJson(doc, jsonString);
-    return jsonString;
+    if (_server->hasHeader("If-None-Match") && _server->header("If-None-Match").indexOf(etag) >= 0) {
+        _server->send(304);
+        return true;
+    }
+    return false;
 }
 
-String WiFiManager::_getWiFiNetworksJson() {
-    StaticJsonDocument<1024> doc;
+void WiFiManager::_handleWiFiNetworks() {
+    // ?refresh=1 yeni tarama ister; aksi halde yalnızca eskimiş önbellek yenilenir
+    if (_server->arg("refresh") == "1") {
+        _scanner.requestScan();
+    } else {
+        _scanner.requestIfStale();
+    }
+    
+    StaticJsonDocument<2048> doc;
+    doc["scanning"] = _scanner.isScanning() || _scanner.isScanPending();
+    doc["cached"] = _scanner.hasResults();
+    doc["age"] = _scanner.getResultAge() / 1000; // saniye
+    
     JsonArray networks = doc.createNestedArray("networks");
-    int n = WiFi.scanComplete();
-    if (n >= 0) {
-        for (int i = 0; i < n; i++) {
-            JsonObject network = networks.createNestedObject();
-            network["ssid"] = WiFi.SSID(i);
-            network["rssi"] = WiFi.RSSI(i);
-            network["encryption"] = (WiFi.encryptionType(i) == WIFI_AUTH_OPEN) ? "open" : "encrypted";
-        }
-        WiFi.scanDelete();
+    for (uint8_t i = 0; i < _scanner.getResultCount(); i++) {
+        const WiFiScanResult& result = _scanner.getResult(i);
+        JsonObject network = networks.createNestedObject();
+        network["ssid"] = (const char*)result.ssid;
+        network["rssi"] = result.rssi;
+        network["channel"] = result.channel;
+        network["encryption"] = result.open ? "open" : "WPA2";
     }
     
     String jsonString;
     serializeJson(doc, jsonString);
-    return jsonString;
+    _server->send(200, "application/json", jsonString);
 }
 
 void WiFiManager::_setupRoutes() {
@@ -1542,13 +1431,21 @@ void WiFiManager::_setupRoutes() {
         return;
     }
     
+    // Koşullu yanıtlar için istek başlıklarını topla
+    static const char* headerKeys[] = {"If-None-Match", "X-MD5", "X-SHA256", "Accept"};
+    _server->collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
+    
     // Ana sayfa - web arayüzü
     _server->on("/", HTTP_GET, [this]() {
-        _server->send(200, "text/html", _getHtmlContent());
+        _sendAsset(WEB_ASSET_INDEX);
     });
 
     // WiFi durumu API'si
     _server->on("/api/wifi/status", HTTP_GET, [this]() {
+        if (_handleNotModified()) {
+            return;
+        }
+        
         StaticJsonDocument<300> doc;
         doc["mode"] = (WiFi.getMode() == WIFI_AP) ? "AP" : "Station";
         doc["connected"] = isConnected();
@@ -1643,51 +1540,61 @@ _server->on("/api/system/verify", HTTP_GET, [this]() {
 
     // Durum verileri JSON API
     _server->on("/api/status", HTTP_GET, [this]() {
-        _server->send(200, "application/json", _getStatusJson());
-    });
-    
-    // WiFi ağları listesi
-    _server->on("/api/wifi/networks", HTTP_GET, [this]() {
-        Serial.println("WiFi taraması başlatılıyor...");
-        
-        // Önce mevcut tarama sonuçlarını temizle
-        WiFi.scanDelete();
-        
-        // Senkron tarama başlat (false = senkron, true = hidden SSID'leri de göster)
-        int n = WiFi.scanNetworks(false, true);
+        // İkili gösterim Accept başlığıyla seçilir; JSON varsayılan kalır. Gösterim
+        // ETag'den önce kesinleşir: "-b" eki yalnızca gerçekten ikili çerçeve
+        // gönderilecekse kullanılır, çerçeve sığmıyorsa JSON'a geçilir
+        bool binary = _acceptsBinaryStatus() &&
+                      statusFrameLength(_incubationType.c_str(), _ssid.c_str()) <= WEB_RESPONSE_POOL_SIZE;
+        _server->sendHeader("Vary", "Accept");
         
-        StaticJsonDocument<2048> doc;
-        JsonArray networks = doc.createNestedArray("networks");
+        // Değişiklik yoksa belgeyi yeniden oluşturmadan 304 dön
+        if (_handleNotModified(binary ? "b" : nullptr)) {
+            return;
+        }
         
-        Serial.println("Bulunan ağ sayısı: " + String(n));
+        // Sık sorgulanan uç nokta: önceden ayrılmış buffer'a heap kullanmadan yazılır ve
+        // kopyalanmadan gönderilir. Buffer başka bir yanıtta ise geçici buffer ayırmak
+        // yerine istemci kısa süre sonra tekrar denemeye yönlendirilir.
+        char* buffer = _acquireResponseBuffer();
+        if (buffer == nullptr) {
+            _server->sendHeader("Retry-After", "1");
+            _server->send(503, "application/json", _createErrorResponse("Busy"));
+            return;
+        }
         
-        if (n > 0) {
-            for (int i = 0; i < n && i < 20; i++) { // Maksimum 20 ağ
-                String ssid = WiFi.SSID(i);
-                if (ssid.length() > 0) { // Boş SSID'leri atla
-                    JsonObject network = networks.createNestedObject();
-                    network["ssid"] = ssid;
-                    network["rssi"] = WiFi.RSSI(i);
-                    
-                    // Encryption type kontrolü
-                    wifi_auth_mode_t encType = WiFi.encryptionType(i);
-                    if (encType == WIFI_AUTH_OPEN) {
-                        network["encryption"] = "open";
-                    } else {
-                        network["encryption"] = "WPA2";
-                    }
-                    
-                    Serial.println("Ağ: " + ssid + " RSSI: " + String(WiFi.RSSI(i)));
-                }
+        size_t length = binary ? _writeStatusBinary((uint8_t*)buffer, WEB_RESPONSE_POOL_SIZE)
+                               : _writeStatusJson(buffer, WEB_RESPONSE_POOL_SIZE);
+        if (length > 0) {
+            _sendResponseBuffer(200, binary ? STATUS_FRAME_CONTENT_TYPE : "application/json", length);
+        } else {
+            _releaseResponseBuffer();
+            _server->send(500, "application/json", _createErrorResponse("Status too large"));
+        }
+    });
+    
+    // İkili durum çerçevesinin şeması (alan adı, tip, konum, ölçek)
+    _server->on("/api/status/schema", HTTP_GET, [this]() {
+        char* buffer = _acquireResponseBuffer();
+        size_t length = buffer ? writeStatusFrameSchema(buffer, WEB_RESPONSE_POOL_SIZE) : 0;
+        if (length > 0) {
+            _server->sendHeader("Cache-Control", "max-age=86400");
+            if (_handleContentNotModified(fnv1a32(FNV1A32_SEED, buffer, length))) {
+                _releaseResponseBuffer();
+                return;
+            }
+            _sendResponseBuffer(200, "application/json", length);
+        } else {
+            if (buffer) {
+                _releaseResponseBuffer();
             }
+            _server->sendHeader("Retry-After", "1");
+            _server->send(503, "application/json", _createErrorResponse("Schema unavailable"));
         }
-        
-        String jsonString;
-        serializeJson(doc, jsonString);
-        
-        Serial.println("WiFi networks JSON: " + jsonString);
-        
-        _server->send(200, "application/json", jsonString);
+    });
+    
+    // WiFi ağları listesi - her zaman önbellekten, beklemeden yanıtlanır
+    _server->on("/api/wifi/networks", HTTP_GET, [this]() {
+        _handleWiFiNetworks();
     });
     
     // WiFi bağlantısı
@@ -1742,7 +1649,7 @@ _server->on("/api/system/verify", HTTP_GET, [this]() {
     
     // WiFi ayar sayfası
     _server->on("/wifi", HTTP_GET, [this]() {
-        _server->send(200, "text/html", _getWiFiConfigHTML());
+        _sendAsset(WEB_ASSET_WIFI);
     });
     
     // WiFi ayarlarını kaydet
@@ -1780,6 +1687,33 @@ _server->on("/api/system/verify", HTTP_GET, [this]() {
         _handleSystemSave();
     });
     
+    // Toplu ayar güncelleme: hepsi doğrulanır, birlikte uygulanır, tek kez kaydedilir
+    _server->on("/api/settings/batch", HTTP_POST, [this]() {
+        _handleSettingsBatch();
+    });
+    
+    // Ayar parametreleri şeması (ad, tip, min, max, kalıcılık) - parametre tablosundan üretilir
+    _server->on("/api/settings/schema", HTTP_GET, [this]() {
+        extern size_t writeWifiParameterSchema(char* buffer, size_t size);
+        
+        char* buffer = _acquireResponseBuffer();
+        size_t length = buffer ? writeWifiParameterSchema(buffer, WEB_RESPONSE_POOL_SIZE) : 0;
+        if (length > 0) {
+            _server->sendHeader("Cache-Control", "max-age=86400");
+            if (_handleContentNotModified(fnv1a32(FNV1A32_SEED, buffer, length))) {
+                _releaseResponseBuffer();
+                return;
+            }
+            _sendResponseBuffer(200, "application/json", length);
+        } else {
+            if (buffer) {
+                _releaseResponseBuffer();
+            }
+            _server->sendHeader("Retry-After", "1");
+            _server->send(503, "application/json", _createErrorResponse("Schema unavailable"));
+        }
+    });
+    
     // WiFi credential kontrolü endpoint'i - YENİ
     _server->on("/api/wifi/credentials", HTTP_GET, [this]() {
         _handleWiFiCredentials();
@@ -1799,6 +1733,18 @@ _server->on("/api/system/verify", HTTP_GET, [this]() {
     _server->on("/api/motor/status", HTTP_GET, [this]() {
         _handleMotorStatus();
     });
+    
+    // Kontrol döngüsü gecikme histogramları
+    _server->on("/api/perf", HTTP_GET, [this]() {
+        _handlePerf();
+    });
+    
+    // Histogramları sıfırla (durum değiştirdiği için yalnızca POST)
+    _server->on("/api/perf/reset", HTTP_POST, [this]() {
+        extern PerfMonitor perfMonitor;
+        perfMonitor.reset();
+        _server->send(200, "application/json", _createSuccessResponse());
+    });
 
     // Manuel kuluçka parametreleri toplu güncelleme
 _server->on("/api/incubation/manual", HTTP_POST, [this]() {
@@ -2073,7 +2019,13 @@ _server->on("/api/ota/update", HTTP_POST,
                 md5 = _server->header("X-MD5");
             }
             
-            if (!otaManager.startUpdate(upload.totalSize, md5)) {
+            String sha256 = "";
+            if (_server->hasHeader("X-SHA256")) {
+                sha256 = _server->header("X-SHA256");
+            }
+            
+            // Multipart'ta firmware boyutu bilinmez; ilerleme istek boyutundan tahmin edilir
+            if (!otaManager.startUpdate(upload.totalSize, md5, sha256, _server->contentLength())) {
                 _server->send(400, "text/plain", otaManager.getErrorMessage());
                 return;
             }
@@ -2096,6 +2048,14 @@ _server->on("/api/ota/update", HTTP_POST,
     }
 );
 
+// OTA halka tamponu doluysa gövde okumasını kıs; sunucu en fazla bir
+// upload tamponu biriktirip writeChunk'a verdiği için o pay düşülür
+_server->setUploadWindow([]() -> size_t {
+    extern OTAManager otaManager;
+    size_t window = otaManager.getReceiveWindow();
+    return window > HTTP_UPLOAD_BUFLEN ? window - HTTP_UPLOAD_BUFLEN : 0;
+});
+
 _server->on("/api/ota/progress", HTTP_GET, [this]() {
     extern OTAManager otaManager;
     
@@ -2104,12 +2064,23 @@ _server->on("/api/ota/progress", HTTP_GET, [this]() {
     doc["progress"] = otaManager.getProgress();
     doc["totalSize"] = otaManager.getTotalSize();
     doc["writtenSize"] = otaManager.getWrittenSize();
+    doc["receivedSize"] = otaManager.getReceivedSize();
+    doc["sha256"] = otaManager.getSha256();
     doc["error"] = otaManager.getErrorMessage();
     
     String jsonString;
     serializeJson(doc, jsonString);
     _server->send(200, "application/json", jsonString);
 });
+
+    // Pahalı uç noktalar ağır sınıfta: istemci başına seyrek izin verilir
+    _server->setRouteCost("/api/system/verify", HTTP_COST_HEAVY);
+    _server->setRouteCost("/api/system/save", HTTP_COST_HEAVY);
+    _server->setRouteCost("/api/wifi/connect", HTTP_COST_HEAVY);
+    _server->setRouteCost("/api/wifi/save", HTTP_COST_HEAVY);
+    _server->setRouteCost("/api/wifi/mode", HTTP_COST_HEAVY);
+    _server->setRouteCost("/api/wifi/ap", HTTP_COST_HEAVY);
+    _server->setRouteCost("/api/ota/update", HTTP_COST_HEAVY);
 }
 
 // Motor test handler
@@ -2168,8 +2139,89 @@ void WiFiManager::_handleSystemSave() {
     }
 }
 
+// Toplu ayar güncelleme handler
+void WiFiManager::_handleSettingsBatch() {
+    extern bool validateWifiParameter(const String& param, const String& value);
+    extern void beginWifiParameterBatch();
+    extern void commitWifiParameterBatch();
+    
+    StaticJsonDocument<2048> doc;
+    DeserializationError error = deserializeJson(doc, _server->arg("plain"));
+    
+    if (error || !doc.is<JsonObject>()) {
+        _server->send(400, "application/json", _createErrorResponse("Invalid JSON"));
+        return;
+    }
+    
+    // Hem {"settings": {...}} hem de düz nesne kabul edilir
+    JsonObject settings = doc.containsKey("settings") ? doc["settings"].as<JsonObject>() : doc.as<JsonObject>();
+    if (settings.isNull() || settings.size() == 0 || settings.size() > WEB_BATCH_MAX_PARAMS) {
+        _server->send(400, "application/json", _createErrorResponse("Settings count out of range"));
+        return;
+    }
+    
+    // 1. Aşama: tüm değerleri doğrula; biri bile geçersizse hiçbiri uygulanmaz
+    String params[WEB_BATCH_MAX_PARAMS];
+    String values[WEB_BATCH_MAX_PARAMS];
+    uint8_t count = 0;
+    
+    StaticJsonDocument<512> response;
+    JsonArray invalid = response.createNestedArray("invalid");
+    
+    for (JsonPair setting : settings) {
+        JsonVariant value = setting.value();
+        
+        params[count] = setting.key().c_str();
+        if (value.is<bool>()) {
+            values[count] = value.as<bool>() ? "1" : "0";
+        } else if (value.is<const char*>()) {
+            values[count] = value.as<const char*>();
+        } else {
+            serializeJson(value, values[count]);
+        }
+        
+        if (!validateWifiParameter(params[count], values[count])) {
+            invalid.add(setting.key().c_str());
+        }
+        count++;
+    }
+    
+    if (invalid.size() > 0) {
+        response["status"] = "error";
+        response["message"] = "Invalid parameters, nothing applied";
+        
+        String responseStr;
+        serializeJson(response, responseStr);
+        _server->send(400, "application/json", responseStr);
+        return;
+    }
+    
+    // 2. Aşama: gönderilen sırayla uygula, sonda tek kayıt
+    beginWifiParameterBatch();
+    for (uint8_t i = 0; i < count; i++) {
+        _processParameterUpdate(params[i], values[i]);
+    }
+    commitWifiParameterBatch();
+    
+    Serial.println("Web API: " + String(count) + " parametre toplu olarak güncellendi");
+    
+    response.remove("invalid");
+    response["status"] = "success";
+    response["applied"] = count;
+    response["stateVersion"] = getStateVersion();
+    response["timestamp"] = millis();
+    
+    String responseStr;
+    serializeJson(response, responseStr);
+    _server->send(200, "application/json", responseStr);
+}
+
 // WiFi credential kontrolü handler
 void WiFiManager::_handleWiFiCredentials() {
+    if (_handleNotModified()) {
+        return;
+    }
+    
     StaticJsonDocument<500> doc;
     
     doc["currentMode"] = (WiFi.getMode() == WIFI_AP) ? "AP" : "Station";
@@ -2195,7 +2247,7 @@ void WiFiManager::_handleWiFiCredentials() {
 
 // Sistem sağlık kontrolü handler
 void WiFiManager::_handleSystemHealth() {
-    StaticJsonDocument<1024> doc;
+    StaticJsonDocument<3072> doc;
     
     // Sistem durumu
     doc["status"] = "healthy";
@@ -2243,6 +2295,68 @@ void WiFiManager::_handleSystemHealth() {
     wifi["connected"] = isConnected();
     wifi["rssi"] = getSignalStrength();
     wifi["ip"] = getIPAddress();
+    wifi["completedScans"] = _scanner.getCompletedScans();
+    wifi["failedScans"] = _scanner.getFailedScans();
+    
+    // HTTP sunucu durumu
+    JsonObject http = doc.createNestedObject("httpServer");
+    http["activeConnections"] = _server ? _server->getActiveConnections() : 0;
+    http["peakConnections"] = _server ? _server->getPeakConnections() : 0;
+    http["maxConnections"] = WEB_MAX_CLIENTS;
+    http["servedRequests"] = _server ? _server->getServedRequests() : 0;
+    http["rejectedConnections"] = _server ? _server->getRejectedConnections() : 0;
+    http["timedOutConnections"] = _server ? _server->getTimedOutConnections() : 0;
+    http["evictedConnections"] = _server ? _server->getEvictedConnections() : 0;
+    http["rateLimitedRequests"] = _server ? _server->getRateLimitedRequests() : 0;
+    http["trackedClients"] = _server ? _server->getRateLimitClientCount() : 0;
+    
+    // Toplam handler süresine göre en pahalı rotalar:
+    // [uri, maliyet sınıfı, çağrı, ort. us, en uzun us, en büyük heap düşüşü, sınırlanan]
+    JsonArray routes = http.createNestedArray("routes");
+    uint8_t routeCount = _server ? _server->getRouteCount() : 0;
+    uint64_t previousTotal = UINT64_MAX;
+    int previousIndex = -1;
+    for (uint8_t reported = 0; reported < WEB_HEALTH_ROUTE_LIMIT; reported++) {
+        // Bir öncekinden ucuz olan en pahalı rotayı seç (eşitlikte dizin sırası)
+        int best = -1;
+        HttpRouteStats bestStats;
+        for (uint8_t i = 0; i < routeCount; i++) {
+            HttpRouteStats stats;
+            _server->getRouteStats(i, stats);
+            if (stats.calls == 0 && stats.limited == 0) {
+                continue;
+            }
+            bool afterPrevious = stats.totalMicros < previousTotal ||
+                                 (stats.totalMicros == previousTotal && (int)i > previousIndex);
+            bool better = best < 0 || stats.totalMicros > bestStats.totalMicros;
+            if (afterPrevious && better) {
+                best = i;
+                bestStats = stats;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+        
+        JsonArray entry = routes.createNestedArray();
+        entry.add(bestStats.uri);
+        entry.add((uint8_t)bestStats.cost);
+        entry.add(bestStats.calls);
+        entry.add(bestStats.calls > 0 ? (uint32_t)(bestStats.totalMicros / bestStats.calls) : 0);
+        entry.add(bestStats.maxMicros);
+        entry.add(bestStats.maxHeapDrop);
+        entry.add(bestStats.limited);
+        
+        previousTotal = bestStats.totalMicros;
+        previousIndex = best;
+    }
+    
+    // Canlı telemetri (SSE) durumu
+    JsonObject stream = doc.createNestedObject("telemetryStream");
+    stream["port"] = SSE_PORT;
+    stream["clients"] = _telemetryStream.getClientCount();
+    stream["sentFrames"] = _telemetryStream.getSentFrames();
+    stream["droppedFrames"] = _telemetryStream.getDroppedFrames();
     
     // Kuluçka durumu
     JsonObject incubation = doc.createNestedObject("incubation");
@@ -2360,6 +2474,23 @@ void WiFiManager::_handleSetHumidity() {
         return;
     }
     
+    // YENİ: Nem kontrol modu seçimi (0=Histerezis, 1=Öngörülü)
+    if (doc.containsKey("controlMode")) {
+        int mode = doc["controlMode"];
+        if (mode != HUMID_CONTROL_HYSTERESIS && mode != HUMID_CONTROL_PREDICTIVE) {
+            _server->send(400, "application/json", 
+                         _createErrorResponse("Invalid control mode (0=HYSTERESIS, 1=PREDICTIVE)"));
+            return;
+        }
+        
+        _processParameterUpdate("humidControlMode", String(mode));
+        
+        if (!doc.containsKey("targetHumid")) {
+            _server->send(200, "application/json", _createSuccessResponse());
+            return;
+        }
+    }
+    
     if (doc.containsKey("targetHumid")) {
         float targetHumid = doc["targetHumid"];
         
@@ -2394,7 +2525,7 @@ void WiFiManager::_handleSetHumidity() {
 
 void WiFiManager::_handleSetPidParameters() {
     String jsonString = _server->arg("plain");
-    StaticJsonDocument<400> doc;
+    StaticJsonDocument<1024> doc; // Kazanç tablosu girdileri için genişletildi
     DeserializationError error = deserializeJson(doc, jsonString);
     
     if (error) {
@@ -2405,6 +2536,16 @@ void WiFiManager::_handleSetPidParameters() {
     bool hasValidParam = false;
     String responseMessage = "";
     
+    // Kazanç tablosu etkinken temel kazançlar uygulanmaz; sessizce kabul etme
+    if (doc.containsKey("kp") || doc.containsKey("ki") || doc.containsKey("kd")) {
+        extern PIDController pidController;
+        if (pidController.isGainScheduleEnabled()) {
+            _server->send(409, "application/json", 
+                         _createErrorResponse("Gain schedule is enabled; edit gainSchedule entries or disable it first"));
+            return;
+        }
+    }
+    
     // PID parametrelerini kontrol et ve güncelle
     if (doc.containsKey("kp")) {
     float kp = doc["kp"];
@@ -2500,6 +2641,83 @@ void WiFiManager::_handleSetPidParameters() {
         }
     }
     
+    // YENİ: Isıtıcı ileri besleme ayarları
+    if (doc.containsKey("feedForward")) {
+        extern PIDController pidController;
+        JsonObject feedForward = doc["feedForward"];
+        
+        if (feedForward.containsKey("humidifierBias")) {
+            float bias = feedForward["humidifierBias"];
+            if (bias < 0.0 || bias > FF_MAX_BIAS) {
+                _server->send(400, "application/json", 
+                             _createErrorResponse("Invalid feed-forward bias (max: " + String(FF_MAX_BIAS) + ")"));
+                return;
+            }
+            pidController.getHumidifierFeedForward().setBias(bias);
+        }
+        
+        if (feedForward.containsKey("motorBias")) {
+            float bias = feedForward["motorBias"];
+            if (bias < 0.0 || bias > FF_MAX_BIAS) {
+                _server->send(400, "application/json", 
+                             _createErrorResponse("Invalid feed-forward bias (max: " + String(FF_MAX_BIAS) + ")"));
+                return;
+            }
+            pidController.getMotorFeedForward().setBias(bias);
+        }
+        
+        bool enabled = feedForward["enabled"] | pidController.isFeedForwardEnabled();
+        _processParameterUpdate("pidFeedForward", enabled ? "1" : "0");
+        responseMessage += "İleri besleme: " + String(enabled ? "Etkin" : "Kapalı") + " ";
+        hasValidParam = true;
+    }
+    
+    // YENİ: Proses tanımlama sapma uyarısını onayla (mevcut modeli referans al)
+    if (doc.containsKey("identAcknowledge") && doc["identAcknowledge"].as<bool>()) {
+        extern PlantIdentifier heaterIdentifier;
+        extern PlantIdentifier humidIdentifier;
+        
+        heaterIdentifier.captureReference();
+        humidIdentifier.captureReference();
+        responseMessage += "Tanımlama referansı yenilendi ";
+        hasValidParam = true;
+    }
+    
+    // YENİ: Kazanç tablosu (aşama x hata bandı) güncellemesi
+    if (doc.containsKey("gainSchedule")) {
+        extern PIDController pidController;
+        JsonObject schedule = doc["gainSchedule"];
+        
+        // Önce tüm girdiler doğrulanır; biri hatalıysa tablo hiç değişmez
+        JsonArray entries = schedule["entries"];
+        for (JsonObject entry : entries) {
+            // uint8_t'ye daraltmadan önce aralık denetimi (ör. 256 -> 0 olmasın)
+            long stage = entry["stage"] | -1L;
+            long band = entry["band"] | -1L;
+            
+            if (stage < 0 || stage >= PID_SCHEDULE_STAGE_COUNT || band < 0 || band >= PID_SCHEDULE_BAND_COUNT ||
+                !pidController.isValidScheduledGains((uint8_t)stage, (uint8_t)band, entry["kp"] | 0.0f,
+                                                     entry["ki"] | 0.0f, entry["kd"] | 0.0f)) {
+                _server->send(400, "application/json", 
+                             _createErrorResponse("Invalid gain schedule entry (stage: " + String(stage) + 
+                                                ", band: " + String(band) + ")"));
+                return;
+            }
+        }
+        
+        for (JsonObject entry : entries) {
+            pidController.setScheduledGains(entry["stage"].as<uint8_t>(), entry["band"].as<uint8_t>(), entry["kp"] | 0.0f,
+                                            entry["ki"] | 0.0f, entry["kd"] | 0.0f);
+        }
+        
+        bool enabled = schedule["enabled"] | pidController.isGainScheduleEnabled();
+        
+        // Tablo, açma/kapama parametresiyle birlikte kalıcı olarak kaydedilir
+        _processParameterUpdate("pidGainSchedule", enabled ? "1" : "0");
+        responseMessage += "Kazanç tablosu: " + String(enabled ? "Etkin" : "Kapalı") + " ";
+        hasValidParam = true;
+    }
+    
     if (hasValidParam) {
         // Başarılı yanıt oluştur
         StaticJsonDocument<600> response;
@@ -2781,6 +2999,7 @@ bool WiFiManager::_allocateBuffers() {
     }
     
     _buffersAllocated = true;
+    _responseBufferBusy = false;
     Serial.println("WiFi: Memory buffers allocated - Free heap: " + String(ESP.getFreeHeap()));
     return true;
 }
@@ -2818,6 +3037,7 @@ void WiFiManager::_safeServerRestart() {
     if (_server != nullptr) {
         if (_isServerRunning) {
             _server->stop();
+            _telemetryStream.stop();
             _isServerRunning = false;
             delay(1000);
         }
@@ -2843,7 +3063,7 @@ void WiFiManager::_safeServerRestart() {
     }
     
     // DÜZELTME: Null kontrolü ekle
-    _server = new WebServer(WIFI_PORT);
+    _server = new AsyncHttpServer(WIFI_PORT);
     if (_server == nullptr) {
         Serial.println("WiFi: Server instance oluşturma hatası!");
         _deallocateBuffers();
@@ -2855,6 +3075,7 @@ void WiFiManager::_safeServerRestart() {
     
     // Server'ı başlat
     _server->begin();
+    _telemetryStream.begin();
     _isServerRunning = true;
     _serverInitialized = true;
     _lastServerRestart = currentTime;
@@ -2880,6 +3101,7 @@ void WiFiManager::startServer() {
     if (_server != nullptr && _serverInitialized) {
         // Mevcut server'ı yeniden kullan
         _server->begin();
+        _telemetryStream.begin();
         _isServerRunning = true;
         _serverUptime = millis();
         Serial.println("WiFi: Mevcut server yeniden başlatıldı");
@@ -2888,7 +3110,10 @@ void WiFiManager::startServer() {
     
     // İlk kez server oluşturma
     if (_server == nullptr) {
-        _server = new WebServer(WIFI_PORT);
+        // Yanıt buffer'larını bir kez ayır (durum JSON'u için yeniden kullanılır)
+        _allocateBuffers();
+        
+        _server = new AsyncHttpServer(WIFI_PORT);
         if (_server == nullptr) {
             Serial.println("WiFi: Server oluşturma hatası - bellek yetersiz!");
             return;
@@ -2901,6 +3126,7 @@ void WiFiManager::startServer() {
     
     // Server'ı başlat
     _server->begin();
+    _telemetryStream.begin();
     _isServerRunning = true;
     _serverUptime = millis();
     _lastServerCheck = millis();
@@ -2924,6 +3150,7 @@ void WiFiManager::stopServer() {
     
     // Server'ı durdur ama nesneyi SAKLA
     _server->stop();
+    _telemetryStream.stop();
     _isServerRunning = false;
     
     // Server uptime hesapla
@@ -2943,7 +3170,7 @@ void WiFiManager::_handlePidStatus() {
     extern PIDController pidController;
     extern Sensors sensors;
     
-    StaticJsonDocument<600> doc;
+    StaticJsonDocument<3072> doc; // Kazanç tablosu, ileri besleme ve tanımlama için genişletildi
     
     // PID temel bilgileri
     doc["pidMode"] = _pidMode;
@@ -2980,10 +3207,87 @@ void WiFiManager::_handlePidStatus() {
     status["autoTuneFinished"] = pidController.isAutoTuneFinished();
     status["autoTuneProgress"] = pidController.getAutoTuneProgress();
     
+    // YENİ: Kazanç tablosu ve o an uygulanan kazançlar
+    JsonObject gainSchedule = doc.createNestedObject("gainSchedule");
+    gainSchedule["enabled"] = pidController.isGainScheduleEnabled();
+    gainSchedule["stage"] = pidController.getStage();
+    gainSchedule["activeBand"] = pidController.getActiveBand();
+    
+    JsonObject activeGains = gainSchedule.createNestedObject("active");
+    activeGains["kp"] = pidController.getActiveKp();
+    activeGains["ki"] = pidController.getActiveKi();
+    activeGains["kd"] = pidController.getActiveKd();
+    
+    const PIDGainSchedule& table = pidController.getGainSchedule();
+    JsonArray entries = gainSchedule.createNestedArray("entries");
+    for (uint8_t stage = 0; stage < PID_SCHEDULE_STAGE_COUNT; stage++) {
+        for (uint8_t band = 0; band < PID_SCHEDULE_BAND_COUNT; band++) {
+            JsonObject entry = entries.createNestedObject();
+            entry["stage"] = stage;
+            entry["band"] = band;
+            entry["kp"] = table.entries[stage][band].kp;
+            entry["ki"] = table.entries[stage][band].ki;
+            entry["kd"] = table.entries[stage][band].kd;
+        }
+    }
+    
+    // YENİ: Isıtıcı ileri besleme durumu
+    JsonObject feedForward = doc.createNestedObject("feedForward");
+    feedForward["enabled"] = pidController.isFeedForwardEnabled();
+    feedForward["activeBias"] = pidController.getFeedForwardBias();
+    
+    FeedForward& humidFF = pidController.getHumidifierFeedForward();
+    JsonObject humidifier = feedForward.createNestedObject("humidifier");
+    humidifier["bias"] = humidFF.getBias();
+    humidifier["active"] = humidFF.isDisturbanceActive();
+    humidifier["lastDip"] = humidFF.getLastDip();
+    humidifier["sensitivity"] = humidFF.getSensitivity();
+    humidifier["episodes"] = humidFF.getEpisodeCount();
+    
+    FeedForward& motorFF = pidController.getMotorFeedForward();
+    JsonObject motor = feedForward.createNestedObject("motor");
+    motor["bias"] = motorFF.getBias();
+    motor["active"] = motorFF.isDisturbanceActive();
+    motor["lastDip"] = motorFF.getLastDip();
+    motor["sensitivity"] = motorFF.getSensitivity();
+    motor["episodes"] = motorFF.getEpisodeCount();
+    
+    // YENİ: Çevrimiçi proses tanımlama sonuçları
+    extern PlantIdentifier heaterIdentifier;
+    extern PlantIdentifier humidIdentifier;
+    
+    auto addIdentification = [](JsonObject obj, const PlantIdentifier& identifier) {
+        obj["converged"] = identifier.isConverged();
+        obj["samples"] = identifier.getSampleCount();
+        obj["gain"] = identifier.getGain();
+        obj["timeConstant"] = identifier.getTimeConstant() / 1000;  // saniye
+        obj["deadTime"] = identifier.getDeadTime() / 1000;          // saniye
+        obj["predictionError"] = identifier.getPredictionError();
+        obj["hasReference"] = identifier.hasReference();
+        obj["referenceGain"] = identifier.getReferenceGain();
+        obj["referenceTimeConstant"] = identifier.getReferenceTimeConstant() / 1000;
+        obj["gainDrift"] = identifier.getGainDrift();
+        obj["timeConstantDrift"] = identifier.getTimeConstantDrift();
+        obj["driftWarning"] = identifier.isDrifting();
+    };
+    
+    JsonObject identification = doc.createNestedObject("identification");
+    addIdentification(identification.createNestedObject("heater"), heaterIdentifier);
+    addIdentification(identification.createNestedObject("humidifier"), humidIdentifier);
+    identification["driftWarning"] = heaterIdentifier.isDrifting() || humidIdentifier.isDrifting();
+    
     // Isıtıcı durumu
     doc["heaterState"] = _heaterState;
     doc["heaterActive"] = pidController.isOutputActive();
     
+    // Zaman damgası hariç içerik değişmediyse gövde gönderilmez
+    Fnv1a32Writer digest;
+    serializeJson(doc, digest);
+    _server->sendHeader("Cache-Control", "no-cache");
+    if (_handleContentNotModified(digest.hash)) {
+        return;
+    }
+    
     // Zaman damgası
     doc["timestamp"] = millis();
     
@@ -2992,6 +3296,36 @@ void WiFiManager::_handlePidStatus() {
     _server->send(200, "application/json", jsonString);
 }
 
+// Kontrol döngüsü gecikme handler'ı
+void WiFiManager::_handlePerf() {
+    extern PerfMonitor perfMonitor;
+    
+    StaticJsonDocument<1536> doc;
+    
+    doc["budgetUs"] = perfMonitor.getBudget();
+    doc["budgetViolations"] = perfMonitor.getBudgetViolations();
+    
+    const LatencyHistogram& endToEnd = perfMonitor.getHistogram(PERF_SAMPLE_TO_RELAY);
+    doc["withinBudget"] = endToEnd.getMax() <= perfMonitor.getBudget();
+    
+    JsonObject stages = doc.createNestedObject("stages");
+    for (uint8_t i = 0; i < PERF_STAGE_COUNT; i++) {
+        const LatencyHistogram& h = perfMonitor.getHistogram((PerfStage)i);
+        JsonObject stage = stages.createNestedObject(PerfMonitor::getStageName((PerfStage)i));
+        stage["count"] = h.getCount();
+        stage["p50"] = h.getPercentile(50);
+        stage["p99"] = h.getPercentile(99);
+        stage["max"] = h.getMax();
+        stage["mean"] = h.getMean();
+    }
+    
+    doc["timestamp"] = millis();
+    
+    String jsonString;
+    serializeJson(doc, jsonString);
+    _server->send(200, "application/json", jsonString);
+}
+
 // Motor durum handler'ı
 void WiFiManager::_handleMotorStatus() {
     // Relays modülüne erişim için extern referans
@@ -3036,6 +3370,14 @@ void WiFiManager::_handleMotorStatus() {
     statistics["totalRunTime"] = 0;   // Bu veri şu anda saklanmıyor
     statistics["lastRunDuration"] = _motorRunTime;
     
+    // Zaman damgası ve çalışma süresi hariç içerik değişmediyse gövde gönderilmez
+    Fnv1a32Writer digest;
+    serializeJson(doc, digest);
+    _server->sendHeader("Cache-Control", "no-cache");
+    if (_handleContentNotModified(digest.hash)) {
+        return;
+    }
+    
     // Sistem bilgileri
     doc["timestamp"] = millis();
     doc["uptime"] = millis() / 1000;
@@ -3048,6 +3390,13 @@ void WiFiManager::_handleMotorStatus() {
 void WiFiManager::_emergencyMemoryCleanup() {
     Serial.println("WiFi: Acil bellek temizleme başladı");
     
+    // Yanıt buffer'ını gönderen bağlantı varsa önce kapatılır (buffer geri verilir);
+    // dinleme hemen yeniden başlar
+    if (_responseBufferBusy && _server != nullptr) {
+        _server->stop();
+        _server->begin();
+    }
+    
     // JSON ve response buffer'ları temizle (varsa)
     if (_jsonBuffer != nullptr) {
         free(_jsonBuffer);
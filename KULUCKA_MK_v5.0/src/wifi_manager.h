@@ -1,6 +1,6 @@
 /**
  * @file wifi_manager.h
- * @brief WiFi bağlantı ve web sunucu yönetimi (WebServer ile)
+ * @brief WiFi bağlantı ve web sunucu yönetimi (engellemeyen HTTP sunucusu ile)
  * @version 1.5 - Compile hataları düzeltildi ve Android uygulaması entegrasyonu tamamlandı
  */
 
@@ -9,10 +9,14 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WebServer.h>
 #include <ArduinoJson.h>
 #include "config.h"
 #include "storage.h"
+#include "async_http_server.h"
+#include "web_assets.h"
+#include "telemetry_stream.h"
+#include "wifi_scanner.h"
+#include "status_writer.h"
 
 // WiFi bağlantı durumları
 enum WiFiConnectionStatus {
@@ -126,6 +130,9 @@ public:
     // WiFi durumu string'i al
     String getStatusString() const;
     
+    // Yayınlanan durum verilerinin sürümü (herhangi bir alan değişince artar)
+    uint32_t getStateVersion();
+    
     // Storage referansını ayarla
     void setStorage(Storage* storage);
 
@@ -154,7 +161,7 @@ private:
     void _sendDiscoveryResponse(IPAddress remoteIP, uint16_t remotePort);
 
     // WiFi ve web sunucu değişkenleri
-    WebServer* _server;
+    AsyncHttpServer* _server;
     bool _isConnected;
     bool _isServerRunning;
     String _ssid;
@@ -258,17 +265,35 @@ private:
     unsigned long _lastConnectionAttempt;
     static const unsigned long CONNECTION_TIMEOUT = 10000; // 10 saniye
     
-    // Web sunucu için HTML içeriği
-    String _getHtmlContent();
-    
-    // WiFi ayar sayfası HTML içeriği
-    String _getWiFiConfigHTML();
-    
-    // Durum verilerini JSON olarak al
-    String _getStatusJson();
-    
-    // WiFi ağları listesini JSON olarak al
-    String _getWiFiNetworksJson();
+    // Sıkıştırılmış web arayüzü dosyasını flash'tan gönder (ETag ile 304 destekli)
+    void _sendAsset(const WebAsset& asset);
+    
+    // Durum JSON'unu / ikili çerçeveyi verilen buffer'a heap kullanmadan yaz
+    // (taşmada 0 döner). Alanlar önce anlık kopyaya alınır, yazıcılar status_writer'dadır.
+    void _fillStatusSnapshot(StatusSnapshot& status, char* statusText, size_t size);
+    size_t _writeStatusJson(char* buffer, size_t size);
+    size_t _writeStatusBinary(uint8_t* buffer, size_t size);
+    bool _acceptsBinaryStatus();
+    void _formatStatusString(char* buffer, size_t size) const;
+    
+    // Durum sürümü ve koşullu yanıt (ETag / If-None-Match) desteği
+    uint32_t _stateVersion;
+    uint32_t _stateHash;
+    uint32_t _bootId;
+    uint32_t _hashState() const;
+    void _formatETag(char* buffer, size_t size, const char* variant = nullptr);
+    bool _handleNotModified(const char* variant = nullptr);
+    
+    // Durum sürümüne bağlı olmayan yanıtlar için içerik özetinden ETag (eşleşirse 304 gönderir)
+    bool _handleContentNotModified(uint32_t contentHash);
+    
+    // Canlı telemetri (SSE) yayını
+    TelemetryStream _telemetryStream;
+    void _publishTelemetry();
+    
+    // Engellemeyen, önbellekli WiFi taraması
+    WiFiScanner _scanner;
+    void _handleWiFiNetworks();
     
     // API uç noktalarını ayarla
     void _setupRoutes();
@@ -289,11 +314,13 @@ private:
     void _handleWiFiConnect();
     void _handleMotorTest();         
     void _handleSystemSave();        
+    void _handleSettingsBatch();     // Çoklu parametre, tek kayıt
     void _handleWiFiCredentials();   
     void _handleSystemHealth();
     
     void _handlePidStatus();         // PID durum endpoint handler'ı
     void _handleMotorStatus();       // Motor durum endpoint handler'ı
+    void _handlePerf();              // Kontrol döngüsü gecikme endpoint handler'ı
     
     // JSON işleme yardımcı fonksiyonları
     void _processParameterUpdate(const String& param, const String& value);
@@ -302,14 +329,17 @@ private:
     
     // Bağlantı durumunu kontrol et
     void _checkConnectionStatus();
-    
-    // WiFi ağlarını tara
-    void _scanWiFiNetworks();
 
     // Memory management
     char* _jsonBuffer;
     char* _responseBuffer;
     bool _buffersAllocated;
+    bool _responseBufferBusy;       // Yanıt buffer'ı bir bağlantıya ödünç verildi
+    
+    // Yanıt buffer'ını ödünç al (meşgul ya da ayrılmamışsa nullptr) ve kopyalamadan gönder
+    char* _acquireResponseBuffer();
+    void _sendResponseBuffer(int code, const char* contentType, size_t length);
+    void _releaseResponseBuffer();
     
     // Server lifecycle management
     bool _serverRecreationNeeded;
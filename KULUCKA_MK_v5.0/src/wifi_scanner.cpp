@@ -0,0 +1,131 @@
+/**
+ * @file wifi_scanner.cpp
+ * @brief Arka planda çalışan, sonuçları önbellekleyen WiFi tarama servisi uygulaması
+ * @version 1.0
+ */
+
+#include "wifi_scanner.h"
+
+WiFiScanner::WiFiScanner() {
+    _resultCount = 0;
+    _resultTime = 0;
+    _hasResults = false;
+    _scanning = false;
+    _pending = false;
+    _scanStartTime = 0;
+    _lastScanStart = 0;
+    _hasScanned = false;
+    _completedScans = 0;
+    _failedScans = 0;
+}
+
+void WiFiScanner::handle() {
+    unsigned long now = millis();
+    
+    if (_scanning) {
+        int result = WiFi.scanComplete();
+        
+        if (result >= 0) {
+            _collectResults(result);
+            WiFi.scanDelete();
+            _scanning = false;
+            _completedScans++;
+            Serial.println("WiFi taraması tamamlandı: " + String(_resultCount) + " ağ");
+        } else if (result == WIFI_SCAN_FAILED || now - _scanStartTime > WIFI_SCAN_TIMEOUT) {
+            // Başarısız ya da takılan tarama; önceki önbellek korunur
+            WiFi.scanDelete();
+            _scanning = false;
+            _failedScans++;
+            Serial.println("WiFi taraması başarısız, önbellek korunuyor");
+        }
+        return;
+    }
+    
+    // Kuyruktaki istek hız sınırı dolunca başlatılır
+    if (_pending && (!_hasScanned || now - _lastScanStart >= WIFI_SCAN_MIN_INTERVAL)) {
+        _startScan();
+    }
+}
+
+void WiFiScanner::requestScan() {
+    if (!_scanning) {
+        _pending = true;
+    }
+}
+
+void WiFiScanner::requestIfStale() {
+    if (!_hasResults || getResultAge() > WIFI_SCAN_CACHE_MAX_AGE) {
+        requestScan();
+    }
+}
+
+uint8_t WiFiScanner::getResultCount() const {
+    return _resultCount;
+}
+
+const WiFiScanResult& WiFiScanner::getResult(uint8_t index) const {
+    return _results[index < _resultCount ? index : 0];
+}
+
+bool WiFiScanner::hasResults() const {
+    return _hasResults;
+}
+
+unsigned long WiFiScanner::getResultAge() const {
+    return _hasResults ? millis() - _resultTime : 0;
+}
+
+bool WiFiScanner::isScanning() const {
+    return _scanning;
+}
+
+bool WiFiScanner::isScanPending() const {
+    return _pending;
+}
+
+uint32_t WiFiScanner::getCompletedScans() const {
+    return _completedScans;
+}
+
+uint32_t WiFiScanner::getFailedScans() const {
+    return _failedScans;
+}
+
+void WiFiScanner::_startScan() {
+    _pending = false;
+    _lastScanStart = millis();
+    _hasScanned = true;
+    
+    // Önceki taramadan kalan sonuçlar asenkron taramayı engeller
+    WiFi.scanDelete();
+    
+    // true = asenkron, true = gizli SSID'leri de göster
+    int result = WiFi.scanNetworks(true, true);
+    if (result == WIFI_SCAN_RUNNING) {
+        _scanning = true;
+        _scanStartTime = _lastScanStart;
+    } else {
+        _failedScans++;
+        Serial.println("WiFi taraması başlatılamadı: " + String(result));
+    }
+}
+
+void WiFiScanner::_collectResults(int count) {
+    _resultCount = 0;
+    
+    for (int i = 0; i < count && _resultCount < WIFI_SCAN_MAX_RESULTS; i++) {
+        String ssid = WiFi.SSID(i);
+        if (ssid.length() == 0) {
+            continue; // Boş SSID'leri atla
+        }
+        
+        WiFiScanResult& entry = _results[_resultCount++];
+        strlcpy(entry.ssid, ssid.c_str(), sizeof(entry.ssid));
+        entry.rssi = WiFi.RSSI(i);
+        entry.channel = WiFi.channel(i);
+        entry.open = (WiFi.encryptionType(i) == WIFI_AUTH_OPEN);
+    }
+    
+    _resultTime = millis();
+    _hasResults = true;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file wifi_scanner.h
+ * @brief Arka planda çalışan, sonuçları önbellekleyen WiFi tarama servisi
+ * @version 1.0
+ */
+
+#ifndef WIFI_SCANNER_H
+#define WIFI_SCANNER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include "config.h"
+
+// Önbellekteki tek bir ağ kaydı
+struct WiFiScanResult {
+    char ssid[33];
+    int8_t rssi;
+    uint8_t channel;
+    bool open;
+};
+
+// Taramalar yalnızca asenkron başlatılır ve ana döngüden handle() ile
+// izlenir; hiçbir çağrı tarama bitene kadar beklemez. İstekler kuyruğa
+// alınır ve iki tarama arasında en az WIFI_SCAN_MIN_INTERVAL geçmesi
+// sağlanır. Uç noktalar her zaman son tamamlanan taramanın sonuçlarını
+// zaman damgasıyla birlikte önbellekten okur.
+class WiFiScanner {
+public:
+    // Yapılandırıcı
+    WiFiScanner();
+    
+    // Taramayı ilerlet (ana döngüden çağrılmalı, hiç beklemez)
+    void handle();
+    
+    // Yeni tarama iste (hız sınırı dolunca başlar)
+    void requestScan();
+    
+    // Önbellek eskiyse ya da boşsa tarama iste
+    void requestIfStale();
+    
+    // Önbellek bilgileri
+    uint8_t getResultCount() const;
+    const WiFiScanResult& getResult(uint8_t index) const;
+    bool hasResults() const;
+    unsigned long getResultAge() const;     // ms, hiç tarama yoksa 0
+    
+    // Durum
+    bool isScanning() const;
+    bool isScanPending() const;
+    uint32_t getCompletedScans() const;
+    uint32_t getFailedScans() const;
+
+private:
+    WiFiScanResult _results[WIFI_SCAN_MAX_RESULTS];
+    uint8_t _resultCount;
+    unsigned long _resultTime;              // Son başarılı taramanın bitişi
+    bool _hasResults;
+    
+    bool _scanning;
+    bool _pending;
+    unsigned long _scanStartTime;
+    unsigned long _lastScanStart;
+    bool _hasScanned;
+    
+    uint32_t _completedScans;
+    uint32_t _failedScans;
+    
+    void _startScan();
+    void _collectResults(int count);
+};
+
+#endif // WIFI_SCANNER_H
@@ -0,0 +1,42 @@
+/**
+ * @file Adafruit_GFX.h
+ * @brief Yerel testler için Adafruit_GFX temel sınıfının çizim çekirdeği
+ * @version 1.0
+ */
+
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+// Yalnızca FrameBuffer'ın ezdiği sanal temel işlemler; metin ve şekil
+// yardımcıları yoktur.
+
+#include <Arduino.h>
+
+class Adafruit_GFX {
+public:
+    Adafruit_GFX(int16_t w, int16_t h) : _width(w), _height(h) {}
+    virtual ~Adafruit_GFX() {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        for (int16_t row = y; row < y + h; row++) {
+            for (int16_t column = x; column < x + w; column++) {
+                drawPixel(column, row, color);
+            }
+        }
+    }
+
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { fillRect(x, y, w, 1, color); }
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { fillRect(x, y, 1, h, color); }
+    virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+protected:
+    int16_t _width;
+    int16_t _height;
+};
+
+#endif // HOST_ADAFRUIT_GFX_H
@@ -0,0 +1,151 @@
+/**
+ * @file Arduino.h
+ * @brief Yerel (native) testler için en küçük Arduino uyumluluk katmanı
+ * @version 1.0
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Donanımdan bağımsız modüllerin (json_writer, status_frame, async_http_server,
+// framebuffer) masaüstünde derlenmesi için gereken tanımlar. String, std::string üzerine
+// kurulu ve yalnızca bu modüllerin kullandığı kadardır.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <math.h>
+#include <chrono>
+#include <string>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+#define IRAM_ATTR
+#define OUTPUT 0x03
+
+// FreeRTOS tik süresi 1 ms kabul edilir
+typedef uint32_t TickType_t;
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+inline void pinMode(uint8_t pin, uint8_t mode) {
+    (void)pin;
+    (void)mode;
+}
+
+inline unsigned long micros() {
+    using namespace std::chrono;
+    static const steady_clock::time_point start = steady_clock::now();
+    return (unsigned long)duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+inline unsigned long millis() {
+    return micros() / 1000;
+}
+
+class String {
+public:
+    String() {}
+    String(const char* text) : _s(text ? text : "") {}
+    String(const std::string& text) : _s(text) {}
+    explicit String(char c) : _s(1, c) {}
+    String(int value) : _s(std::to_string(value)) {}
+    String(unsigned int value) : _s(std::to_string(value)) {}
+    String(long value) : _s(std::to_string(value)) {}
+    String(unsigned long value) : _s(std::to_string(value)) {}
+    String(float value, unsigned char decimals = 2) : _s(_format(value, decimals)) {}
+    String(double value, unsigned char decimals = 2) : _s(_format(value, decimals)) {}
+
+    unsigned int length() const { return _s.size(); }
+    const char* c_str() const { return _s.c_str(); }
+    bool reserve(unsigned int size) { _s.reserve(size); return true; }
+    bool concat(const char* text, unsigned int length) { _s.append(text, length); return true; }
+
+    String& operator+=(const String& other) { _s += other._s; return *this; }
+    String& operator+=(const char* other) { _s += other; return *this; }
+    String& operator+=(char other) { _s += other; return *this; }
+    String& operator+=(int other) { _s += std::to_string(other); return *this; }
+    String& operator+=(unsigned int other) { _s += std::to_string(other); return *this; }
+    String& operator+=(unsigned long other) { _s += std::to_string(other); return *this; }
+
+    bool operator==(const String& other) const { return _s == other._s; }
+    bool operator==(const char* other) const { return _s == other; }
+    bool operator!=(const String& other) const { return _s != other._s; }
+    bool operator!=(const char* other) const { return _s != other; }
+    char operator[](unsigned int index) const { return index < _s.size() ? _s[index] : '\0'; }
+    char charAt(unsigned int index) const { return (*this)[index]; }
+
+    int indexOf(char c, unsigned int from = 0) const { return _found(_s.find(c, from)); }
+    int indexOf(const char* text, unsigned int from = 0) const { return _found(_s.find(text, from)); }
+    int indexOf(const String& text, unsigned int from = 0) const { return _found(_s.find(text._s, from)); }
+    int lastIndexOf(char c) const { return _found(_s.rfind(c)); }
+
+    String substring(unsigned int from) const {
+        return from >= _s.size() ? String() : String(_s.substr(from));
+    }
+    String substring(unsigned int from, unsigned int to) const {
+        if (to > _s.size()) to = _s.size();
+        return from >= to ? String() : String(_s.substr(from, to - from));
+    }
+
+    bool startsWith(const String& prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+    bool endsWith(const String& suffix) const {
+        return _s.size() >= suffix._s.size() &&
+               _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+    }
+    bool equalsIgnoreCase(const String& other) const { return strcasecmp(_s.c_str(), other._s.c_str()) == 0; }
+
+    void trim() {
+        size_t first = _s.find_first_not_of(" \t\r\n");
+        size_t last = _s.find_last_not_of(" \t\r\n");
+        _s = (first == std::string::npos) ? std::string() : _s.substr(first, last - first + 1);
+    }
+    void replace(const String& from, const String& to) {
+        if (from._s.empty()) return;
+        size_t position = 0;
+        while ((position = _s.find(from._s, position)) != std::string::npos) {
+            _s.replace(position, from._s.size(), to._s);
+            position += to._s.size();
+        }
+    }
+    void toLowerCase() { for (size_t i = 0; i < _s.size(); i++) _s[i] = tolower(_s[i]); }
+    void toUpperCase() { for (size_t i = 0; i < _s.size(); i++) _s[i] = toupper(_s[i]); }
+    long toInt() const { return atol(_s.c_str()); }
+    float toFloat() const { return atof(_s.c_str()); }
+
+    friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+    friend String operator+(const String& a, const char* b) { return String(a._s + b); }
+    friend String operator+(const char* a, const String& b) { return String(a + b._s); }
+
+private:
+    std::string _s;
+
+    static int _found(size_t position) { return position == std::string::npos ? -1 : (int)position; }
+    static std::string _format(double value, unsigned char decimals) {
+        char text[32];
+        snprintf(text, sizeof(text), "%.*f", decimals, value);
+        return text;
+    }
+};
+
+struct HostSerial {
+    void print(const String& text) { fputs(text.c_str(), stderr); }
+    void println(const String& text) { fprintf(stderr, "%s\n", text.c_str()); }
+    void println() { fputc('\n', stderr); }
+};
+
+struct HostEsp {
+    uint32_t getFreeHeap() { return 200000; }
+};
+
+static HostSerial Serial __attribute__((unused));
+static HostEsp ESP __attribute__((unused));
+
+inline void yield() {}
+
+#endif // HOST_ARDUINO_H
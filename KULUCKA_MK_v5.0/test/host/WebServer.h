@@ -0,0 +1,43 @@
+/**
+ * @file WebServer.h
+ * @brief Yerel testler için WebServer tipleri (HTTPMethod, HTTPUpload)
+ * @version 1.0
+ */
+
+#ifndef HOST_WEBSERVER_H
+#define HOST_WEBSERVER_H
+
+#include <Arduino.h>
+
+enum http_method {
+    HTTP_DELETE = 0,
+    HTTP_GET = 1,
+    HTTP_HEAD = 2,
+    HTTP_POST = 3,
+    HTTP_PUT = 4,
+    HTTP_OPTIONS = 6,
+    HTTP_PATCH = 28
+};
+typedef enum http_method HTTPMethod;
+#define HTTP_ANY (HTTPMethod)(255)
+
+#define HTTP_UPLOAD_BUFLEN 1436
+
+enum HTTPUploadStatus {
+    UPLOAD_FILE_START,
+    UPLOAD_FILE_WRITE,
+    UPLOAD_FILE_END,
+    UPLOAD_FILE_ABORTED
+};
+
+struct HTTPUpload {
+    HTTPUploadStatus status;
+    String filename;
+    String name;
+    String type;
+    size_t totalSize;
+    size_t currentSize;
+    uint8_t buf[HTTP_UPLOAD_BUFLEN];
+};
+
+#endif // HOST_WEBSERVER_H
@@ -0,0 +1,130 @@
+/**
+ * @file WiFi.h
+ * @brief Yerel testler için POSIX soketleri üzerinde WiFiServer/WiFiClient
+ * @version 1.0
+ */
+
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+// AsyncHttpServer'ın kullandığı kadar arayüz. Cihazdaki gibi dinleme soketi
+// engellemeyen kabul yapar ve bağlantı tanımlayıcısı fd() ile paylaşılır.
+
+#include <Arduino.h>
+#include <memory>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+class WiFiClient {
+public:
+    WiFiClient() {}
+    explicit WiFiClient(int fd) : _socket(std::make_shared<Socket>(fd)) {}
+
+    operator bool() const { return _socket && _socket->fd >= 0; }
+
+    int fd() const { return _socket ? _socket->fd : -1; }
+
+    uint8_t connected() {
+        if (!*this) return 0;
+        char probe;
+        int result = ::recv(_socket->fd, &probe, 1, MSG_PEEK | MSG_DONTWAIT);
+        return (result > 0 || (result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))) ? 1 : 0;
+    }
+
+    int available() {
+        if (!*this) return 0;
+        int count = 0;
+        return (ioctl(_socket->fd, FIONREAD, &count) == 0) ? count : 0;
+    }
+
+    int read(uint8_t* buffer, size_t size) {
+        if (!*this) return -1;
+        ssize_t count = ::recv(_socket->fd, buffer, size, MSG_DONTWAIT);
+        return count > 0 ? (int)count : -1;
+    }
+
+    size_t write(const uint8_t* data, size_t size) {
+        if (!*this) return 0;
+        ssize_t sent = ::send(_socket->fd, data, size, MSG_DONTWAIT | MSG_NOSIGNAL);
+        return sent > 0 ? (size_t)sent : 0;
+    }
+
+    void stop() {
+        if (*this) {
+            ::close(_socket->fd);
+            _socket->fd = -1;
+        }
+    }
+
+    uint32_t remoteIP() const {
+        sockaddr_in address;
+        socklen_t length = sizeof(address);
+        if (!_socket || getpeername(_socket->fd, (sockaddr*)&address, &length) != 0) {
+            return 0;
+        }
+        return address.sin_addr.s_addr;
+    }
+
+private:
+    struct Socket {
+        explicit Socket(int descriptor) : fd(descriptor) {}
+        int fd;
+    };
+    std::shared_ptr<Socket> _socket;
+};
+
+class WiFiServer {
+public:
+    WiFiServer(uint16_t port = 80) : _port(port), _fd(-1) {}
+
+    void begin() {
+        _fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_port = htons(_port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (::bind(_fd, (sockaddr*)&address, sizeof(address)) != 0 || ::listen(_fd, 16) != 0) {
+            ::close(_fd);
+            _fd = -1;
+            return;
+        }
+        fcntl(_fd, F_SETFL, fcntl(_fd, F_GETFL) | O_NONBLOCK);
+    }
+
+    void end() {
+        if (_fd >= 0) {
+            ::close(_fd);
+            _fd = -1;
+        }
+    }
+
+    void setNoDelay(bool noDelay) { _noDelay = noDelay; }
+
+    WiFiClient available() {
+        if (_fd < 0) return WiFiClient();
+        int client = ::accept(_fd, nullptr, nullptr);
+        if (client < 0) return WiFiClient();
+        int flag = _noDelay ? 1 : 0;
+        setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+        return WiFiClient(client);
+    }
+
+    bool listening() const { return _fd >= 0; }
+
+private:
+    uint16_t _port;
+    int _fd;
+    bool _noDelay = false;
+};
+
+#endif // HOST_WIFI_H
@@ -0,0 +1,21 @@
+/**
+ * @file gpio.h
+ * @brief Yerel testler için GPIO çıkış taklidi
+ * @version 1.0
+ */
+
+#ifndef HOST_DRIVER_GPIO_H
+#define HOST_DRIVER_GPIO_H
+
+#include <stdint.h>
+#include <esp_err.h>
+
+typedef int gpio_num_t;
+
+inline esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level) {
+    (void)pin;
+    (void)level;
+    return ESP_OK;
+}
+
+#endif // HOST_DRIVER_GPIO_H
@@ -0,0 +1,150 @@
+/**
+ * @file spi_master.h
+ * @brief Yerel testler için zamanlamalı SPI ana sürücü taklidi
+ * @version 1.0
+ */
+
+#ifndef HOST_DRIVER_SPI_MASTER_H
+#define HOST_DRIVER_SPI_MASTER_H
+
+// Kuyruğa alınan her aktarım, hat boşaldığında başlar ve
+// (bit sayısı / saat + HOST_SPI_TRANSACTION_OVERHEAD_US) sürede biter.
+// spi_device_get_trans_result() bitmemiş aktarımı döndürmez; böylece
+// FrameBuffer'ın gönderim süresi cihazdaki hat hızına göre ölçülebilir.
+
+#include <Arduino.h>
+#include <esp_err.h>
+#include <deque>
+#include <thread>
+
+#define HOST_SPI_TRANSACTION_OVERHEAD_US 2.0   // Aktarım başına sürücü/kesme payı (yaklaşık)
+
+typedef int spi_host_device_t;
+
+#define SPI2_HOST 1
+#define SPI3_HOST 2
+#define SPI_DMA_CH_AUTO 3
+#define SPI_TRANS_USE_TXDATA (1 << 3)
+
+struct spi_transaction_t {
+    uint32_t flags;
+    uint16_t cmd;
+    uint64_t addr;
+    size_t length;
+    size_t rxlength;
+    void* user;
+    union {
+        const void* tx_buffer;
+        uint8_t tx_data[4];
+    };
+    union {
+        void* rx_buffer;
+        uint8_t rx_data[4];
+    };
+};
+
+typedef void (*transaction_cb_t)(spi_transaction_t* transaction);
+
+struct spi_bus_config_t {
+    int mosi_io_num;
+    int miso_io_num;
+    int sclk_io_num;
+    int quadwp_io_num;
+    int quadhd_io_num;
+    int max_transfer_sz;
+};
+
+struct spi_device_interface_config_t {
+    int clock_speed_hz;
+    uint8_t mode;
+    int spics_io_num;
+    int queue_size;
+    transaction_cb_t pre_cb;
+};
+
+struct HostSpiDevice {
+    int clockHz;
+    int queueSize;
+    transaction_cb_t preTransfer;
+    double busyUntil;                   // Hattın boşalacağı an (us)
+    std::deque<std::pair<spi_transaction_t*, double> > pending;
+    unsigned long transactions;
+    unsigned long bytes;
+};
+
+typedef HostSpiDevice* spi_device_handle_t;
+
+inline HostSpiDevice& hostSpiDevice() {
+    static HostSpiDevice device;
+    return device;
+}
+
+inline void hostSpiResetStats() {
+    hostSpiDevice().transactions = 0;
+    hostSpiDevice().bytes = 0;
+}
+
+inline esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t* bus, int dma) {
+    (void)host;
+    (void)bus;
+    (void)dma;
+    return ESP_OK;
+}
+
+inline esp_err_t spi_bus_free(spi_host_device_t host) {
+    (void)host;
+    return ESP_OK;
+}
+
+inline esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t* config,
+                                    spi_device_handle_t* handle) {
+    (void)host;
+    HostSpiDevice& device = hostSpiDevice();
+    device.clockHz = config->clock_speed_hz;
+    device.queueSize = config->queue_size;
+    device.preTransfer = config->pre_cb;
+    device.busyUntil = 0;
+    device.pending.clear();
+    hostSpiResetStats();
+    *handle = &device;
+    return ESP_OK;
+}
+
+inline esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t* transaction,
+                                        TickType_t wait) {
+    (void)wait;
+    if ((int)handle->pending.size() >= handle->queueSize) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    if (handle->preTransfer != nullptr) {
+        handle->preTransfer(transaction);
+    }
+
+    double start = max((double)micros(), handle->busyUntil);
+    handle->busyUntil = start + HOST_SPI_TRANSACTION_OVERHEAD_US + transaction->length * 1e6 / handle->clockHz;
+    handle->pending.push_back(std::make_pair(transaction, handle->busyUntil));
+    handle->transactions++;
+    handle->bytes += transaction->length / 8;
+    return ESP_OK;
+}
+
+inline esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t** transaction,
+                                             TickType_t wait) {
+    double deadline = (double)micros() + wait * 1000.0;
+
+    while (true) {
+        double now = (double)micros();
+        if (!handle->pending.empty() && handle->pending.front().second <= now) {
+            *transaction = handle->pending.front().first;
+            handle->pending.pop_front();
+            return ESP_OK;
+        }
+        if (now >= deadline) {
+            return ESP_ERR_TIMEOUT;
+        }
+        std::this_thread::yield();
+    }
+}
+
+#endif // HOST_DRIVER_SPI_MASTER_H
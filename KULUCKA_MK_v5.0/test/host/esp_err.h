@@ -0,0 +1,16 @@
+/**
+ * @file esp_err.h
+ * @brief Yerel testler için ESP-IDF hata kodları
+ * @version 1.0
+ */
+
+#ifndef HOST_ESP_ERR_H
+#define HOST_ESP_ERR_H
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_TIMEOUT 0x107
+
+#endif // HOST_ESP_ERR_H
@@ -0,0 +1,47 @@
+/**
+ * @file esp_heap_caps.h
+ * @brief Yerel testler için yetenek tabanlı bellek ayırma (PSRAM varlığı seçilebilir)
+ * @version 1.0
+ */
+
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+// Testler PSRAM'siz kartı taklit edebilir; dahili RAM'den alınan baytlar sayılır
+struct HostHeapCaps {
+    bool psramAvailable;
+    unsigned long psramBytes;
+    unsigned long internalBytes;
+};
+
+inline HostHeapCaps& hostHeapCaps() {
+    static HostHeapCaps caps = { true, 0, 0 };
+    return caps;
+}
+
+inline void* heap_caps_malloc(size_t size, uint32_t caps) {
+    HostHeapCaps& heap = hostHeapCaps();
+    if (caps & MALLOC_CAP_SPIRAM) {
+        if (!heap.psramAvailable) {
+            return nullptr;
+        }
+        heap.psramBytes += size;
+    } else {
+        heap.internalBytes += size;
+    }
+    return malloc(size);
+}
+
+inline void heap_caps_free(void* pointer) {
+    free(pointer);
+}
+
+#endif // HOST_ESP_HEAP_CAPS_H
@@ -0,0 +1,10 @@
+/**
+ * @file esp_task_wdt.h
+ * @brief Yerel testler için boş görev bekçisi başlığı (config.h içerir)
+ * @version 1.0
+ */
+
+#ifndef HOST_ESP_TASK_WDT_H
+#define HOST_ESP_TASK_WDT_H
+
+#endif // HOST_ESP_TASK_WDT_H
@@ -0,0 +1,17 @@
+/**
+ * @file sockets.h
+ * @brief Yerel testler için lwip soket çağrılarının POSIX karşılıkları
+ * @version 1.0
+ */
+
+#ifndef HOST_LWIP_SOCKETS_H
+#define HOST_LWIP_SOCKETS_H
+
+#include <sys/socket.h>
+#include <errno.h>
+
+inline int lwip_send(int s, const void* data, size_t size, int flags) {
+    return ::send(s, data, size, flags | MSG_NOSIGNAL);
+}
+
+#endif // HOST_LWIP_SOCKETS_H
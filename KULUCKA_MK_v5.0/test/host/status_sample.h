@@ -0,0 +1,46 @@
+/**
+ * @file status_sample.h
+ * @brief Yerel testler için örnek /api/status verisi
+ * @version 1.0
+ */
+
+#ifndef HOST_STATUS_SAMPLE_H
+#define HOST_STATUS_SAMPLE_H
+
+#include <Arduino.h>
+#include "status_writer.h"
+
+// Tipik bir kuluçka anı (ondalıklı değerler kasıtlı olarak yuvarlak değil)
+inline StatusSnapshot makeStatusSample() {
+    StatusSnapshot s;
+    s.currentTemp = 37.52f; s.currentHumid = 58.37f;
+    s.heaterState = true; s.humidifierState = false; s.motorState = false;
+    s.temp1 = 37.48f; s.humid1 = 58.11f; s.temp2 = 37.56f; s.humid2 = 58.63f;
+    s.sensor1Working = true; s.sensor2Working = true;
+    s.tempCalibration1 = -0.25f; s.humidCalibration1 = 1.5f;
+    s.tempCalibration2 = 0.1f; s.humidCalibration2 = -2.0f;
+    s.currentDay = 12; s.totalDays = 21; s.actualDay = 12;
+    s.incubationType = "Tavuk";
+    s.targetTemp = 37.8f; s.targetHumid = 60.0f;
+    s.isIncubationRunning = true; s.isIncubationCompleted = false;
+    s.pidMode = 1;
+    s.pidKp = 12.345f; s.pidKi = 0.127f; s.pidKd = 3.5f;
+    s.alarmEnabled = true;
+    s.tempLowAlarm = 1.0f; s.tempHighAlarm = 1.0f;
+    s.humidLowAlarm = 10.0f; s.humidHighAlarm = 10.0f;
+    s.motorWaitTime = 120; s.motorRunTime = 14;
+    s.manualDevTemp = 37.5f; s.manualHatchTemp = 37.0f;
+    s.manualDevHumid = 60; s.manualHatchHumid = 70;
+    s.manualDevDays = 18; s.manualHatchDays = 3;
+    s.wifiStatus = 2;
+    s.wifiStatusText = "Bağlı (KuluckaAg)";
+    s.ipAddress[0] = 192; s.ipAddress[1] = 168; s.ipAddress[2] = 1; s.ipAddress[3] = 42;
+    s.wifiModeAP = false;
+    s.ssid = "KuluckaAg";
+    s.signalStrength = -61;
+    s.timestamp = 123456789UL; s.freeHeap = 187432UL; s.uptime = 123456UL;
+    s.lastSave = 42; s.pendingChanges = 3;
+    return s;
+}
+
+#endif // HOST_STATUS_SAMPLE_H
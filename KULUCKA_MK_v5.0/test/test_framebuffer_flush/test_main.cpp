@@ -0,0 +1,199 @@
+/**
+ * @file test_main.cpp
+ * @brief Ekran tamponu gönderim süresi ölçümü ve PSRAM'siz geri dönüş testi (pio test -e native)
+ * @version 1.0
+ */
+
+// Önce: çizimler Adafruit_ST7735 üzerinden doğrudan panele gider; her
+// fillRect/bitmap için adres penceresi (11 bayt) ve pikseller, metin
+// hücrelerinde ise her piksel için ayrı pencere gönderilir ve çağıran
+// SPI bitene kadar bekler. Bu yol, gönderilen bayt sayısından hat süresi
+// olarak hesaplanır (aynı TFT_SPI_FREQUENCY, CPU payı hariç: alt sınır).
+// Sonra: aynı çizimler FrameBuffer'a yapılır, flush() kirli dikdörtgenleri
+// zamanlamalı SPI taklidine (test/host/driver/spi_master.h) kuyruğa alır.
+// Çağıranın beklediği süre ve panelin güncellenme süresi ayrı ölçülür.
+
+#include <unity.h>
+#include <esp_heap_caps.h>
+#include "framebuffer.h"
+
+#define BENCH_UPDATES 200
+#define PANEL_WINDOW_BYTES 11          // CASET+4, RASET+4, RAMWR
+
+// Ana ekranın saniyelik güncellemesinde değişen öğeler (Display::_layoutMainScreen):
+// saat etiketi, sıcaklık ve nem glifleri, motor saniye glifleri
+struct GlyphRun {
+    int16_t x;
+    int16_t y;
+    uint8_t glyphs;
+};
+
+static const GlyphRun MAIN_SCREEN_GLYPHS[] = {
+    { 8, 37, 4 },       // Sıcaklık "37.5"
+    { 89, 37, 4 },      // Nem "58.3"
+    { 25, 108, 2 },     // Motor saniye
+};
+
+#define TIME_LABEL_X 2
+#define TIME_LABEL_Y 5
+#define TIME_LABEL_CHARS 5
+#define GLYPH_WIDTH 12
+#define GLYPH_HEIGHT 16
+
+// Doğrudan çizim: panele gidecek baytları sayar
+class DirectPanel : public Adafruit_GFX {
+public:
+    DirectPanel() : Adafruit_GFX(SCREEN_WIDTH, SCREEN_HEIGHT), bytes(0) {}
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        bytes += PANEL_WINDOW_BYTES + 2;
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+        bytes += PANEL_WINDOW_BYTES + 2UL * w * h;
+    }
+
+    void writeRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels) {
+        bytes += PANEL_WINDOW_BYTES + 2UL * w * h;
+    }
+
+    unsigned long bytes;
+};
+
+// Bir saniyelik ana ekran güncellemesi
+template <typename Target>
+static void drawMainScreenUpdate(Target& target, unsigned frame) {
+    static uint16_t cell[GLYPH_WIDTH * GLYPH_HEIGHT];
+    for (size_t i = 0; i < GLYPH_WIDTH * GLYPH_HEIGHT; i++) {
+        cell[i] = (uint16_t)(i * 31 + frame);
+    }
+
+    // Saat: Adafruit metin hücresi (6x8) arka planla birlikte piksel piksel yazılır
+    for (int16_t c = 0; c < TIME_LABEL_CHARS; c++) {
+        for (int16_t y = 0; y < 8; y++) {
+            for (int16_t x = 0; x < 6; x++) {
+                target.drawPixel(TIME_LABEL_X + c * 6 + x, TIME_LABEL_Y + y, ((x + y + frame) & 1) ? 0xFFFF : 0);
+            }
+        }
+    }
+
+    // Büyük değerler: glif başına tek blok
+    for (size_t r = 0; r < sizeof(MAIN_SCREEN_GLYPHS) / sizeof(MAIN_SCREEN_GLYPHS[0]); r++) {
+        const GlyphRun& run = MAIN_SCREEN_GLYPHS[r];
+        for (uint8_t g = 0; g < run.glyphs; g++) {
+            target.writeRect(run.x + g * GLYPH_WIDTH, run.y, GLYPH_WIDTH, GLYPH_HEIGHT, cell);
+        }
+    }
+}
+
+static double busMicros(unsigned long bytes) {
+    return bytes * 8.0 * 1e6 / TFT_SPI_FREQUENCY;
+}
+
+static bool attachFrame(FrameBuffer& frame) {
+    if (!frame.begin() || !frame.attachSpi(TFT_SCLK, TFT_MOSI, TFT_CS, TFT_DC, TFT_SPI_FREQUENCY)) {
+        return false;
+    }
+    // İlk tam ekran gönderimi ölçüme katılmaz
+    frame.flushBlocking();
+    return !frame.isBusy();
+}
+
+void setUp() {
+    hostHeapCaps().psramAvailable = true;
+    hostHeapCaps().psramBytes = 0;
+    hostHeapCaps().internalBytes = 0;
+}
+
+void tearDown() {}
+
+void test_without_psram_no_internal_framebuffer() {
+    hostHeapCaps().psramAvailable = false;
+
+    FrameBuffer frame;
+    TEST_ASSERT_FALSE(frame.begin());
+    TEST_ASSERT_FALSE(frame.isReady());
+    TEST_ASSERT_FALSE(frame.attachSpi(TFT_SCLK, TFT_MOSI, TFT_CS, TFT_DC, TFT_SPI_FREQUENCY));
+
+    // ~40 KB tampon dahili RAM'e düşmemeli
+    TEST_ASSERT_EQUAL_UINT32(0, hostHeapCaps().internalBytes);
+}
+
+void test_flush_sends_only_dirty_rects() {
+    FrameBuffer frame;
+    TEST_ASSERT_TRUE(attachFrame(frame));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)SCREEN_WIDTH * SCREEN_HEIGHT * 2, hostHeapCaps().psramBytes);
+    TEST_ASSERT_EQUAL_UINT32(2 * DISPLAY_DMA_CHUNK_SIZE, hostHeapCaps().internalBytes);
+
+    hostSpiResetStats();
+    uint32_t pixelsBefore = frame.getFlushedPixels();
+    drawMainScreenUpdate(frame, 1);
+    frame.flushBlocking();
+    TEST_ASSERT_FALSE(frame.isBusy());
+
+    // Gönderilen her piksel kirli bölgelerden gelir ve tam ekrandan çok azdır
+    uint32_t pixels = frame.getFlushedPixels() - pixelsBefore;
+    TEST_ASSERT_TRUE(pixels >= TIME_LABEL_CHARS * 6 * 8 + 10 * GLYPH_WIDTH * GLYPH_HEIGHT);
+    TEST_ASSERT_TRUE(pixels < (uint32_t)SCREEN_WIDTH * SCREEN_HEIGHT / 3);
+    TEST_ASSERT_TRUE(hostSpiDevice().bytes >= pixels * 2);
+}
+
+void test_benchmark_flush_timing() {
+    char message[160];
+
+    // Önce: doğrudan çizim, çağıran hat süresi kadar bekler
+    DirectPanel panel;
+    for (unsigned i = 0; i < BENCH_UPDATES; i++) {
+        drawMainScreenUpdate(panel, i);
+    }
+    double directMicros = busMicros(panel.bytes) / BENCH_UPDATES;
+
+    // Sonra: tampona çizim + flush(), ardından gönderimin bitmesi
+    FrameBuffer frame;
+    TEST_ASSERT_TRUE(attachFrame(frame));
+    hostSpiResetStats();
+
+    unsigned long callerTotal = 0;
+    unsigned long panelTotal = 0;
+    for (unsigned i = 0; i < BENCH_UPDATES; i++) {
+        unsigned long start = micros();
+        drawMainScreenUpdate(frame, i);
+        frame.flush();
+        callerTotal += micros() - start;
+
+        while (frame.isBusy()) {
+            frame.service();
+        }
+        panelTotal += micros() - start;
+    }
+    unsigned long dirtyBytes = hostSpiDevice().bytes / BENCH_UPDATES;
+
+    // Tam ekran gönderimi (ekran geçişlerinde)
+    hostSpiResetStats();
+    unsigned long start = micros();
+    frame.invalidate();
+    frame.flushBlocking();
+    unsigned long fullMicros = micros() - start;
+    unsigned long fullBytes = hostSpiDevice().bytes;
+
+    snprintf(message, sizeof(message), "Dogrudan cizim: %lu bayt/guncelleme, cagiran %.0f us bekler (hat alt siniri)",
+             panel.bytes / BENCH_UPDATES, directMicros);
+    TEST_MESSAGE(message);
+    snprintf(message, sizeof(message), "Tampon+DMA:     %lu bayt/guncelleme, cagiran %.1f us, panel %.0f us sonra guncel",
+             dirtyBytes, (double)callerTotal / BENCH_UPDATES, (double)panelTotal / BENCH_UPDATES);
+    TEST_MESSAGE(message);
+    snprintf(message, sizeof(message), "Tam ekran gonderimi: %lu bayt, %lu us", fullBytes, fullMicros);
+    TEST_MESSAGE(message);
+
+    TEST_ASSERT_TRUE(dirtyBytes < panel.bytes / BENCH_UPDATES);
+    TEST_ASSERT_TRUE((double)callerTotal / BENCH_UPDATES < directMicros);
+    TEST_ASSERT_TRUE((double)panelTotal / BENCH_UPDATES < fullMicros);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_without_psram_no_internal_framebuffer);
+    RUN_TEST(test_flush_sends_only_dirty_rects);
+    RUN_TEST(test_benchmark_flush_timing);
+    return UNITY_END();
+}
@@ -0,0 +1,418 @@
+/**
+ * @file test_main.cpp
+ * @brief AsyncHttpServer yük testi: çok sayıda eş zamanlı ve yavaş istemci (pio test -e native)
+ * @version 1.0
+ */
+
+// Sunucu, cihazdaki gibi tek bir döngüden handleClient() ile ilerletilir;
+// istemciler ayrı iş parçacıklarında gerçek TCP soketleri açar. Her istemci
+// farklı bir loopback adresinden bağlanır, böylece IP başına hız sınırı
+// cihazdaki gibi ayrı ayrı işler. Ölçülen değerler TEST_MESSAGE ile yazılır.
+
+#include <unity.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "async_http_server.h"
+#include "status_sample.h"
+
+#define LOAD_PORT 18080
+#define LOAD_BIG_SIZE (32 * 1024 * 1024)   // Yavaş okuyucunun soket buffer'larına sığmayan gövde
+#define LOAD_MAX_LOOP_MICROS 50000         // Tek bir handleClient() turunun üst sınırı (masaüstü soket
+                                           // buffer'ları MB düzeyinde; tek gönderim birkaç ms sürebilir)
+
+static AsyncHttpServer* server = nullptr;
+static std::thread serverThread;
+static std::atomic<bool> serverRunning(false);
+static std::atomic<unsigned long> maxLoopMicros(0);
+static std::atomic<unsigned long> loopCount(0);
+
+static char statusJson[WEB_RESPONSE_POOL_SIZE];
+static size_t statusLength = 0;
+static uint8_t* bigBody = nullptr;
+
+// Ana döngü: sunucuya yalnızca bu iş parçacığı dokunur
+static void serverLoop() {
+    while (serverRunning) {
+        unsigned long start = micros();
+        server->handleClient();
+        unsigned long elapsed = micros() - start;
+
+        unsigned long current = maxLoopMicros;
+        while (elapsed > current && !maxLoopMicros.compare_exchange_weak(current, elapsed)) {
+        }
+        loopCount++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+static void startServer() {
+    StatusSnapshot sample = makeStatusSample();
+    statusLength = writeStatusJson(sample, statusJson, sizeof(statusJson));
+    bigBody = (uint8_t*)malloc(LOAD_BIG_SIZE);
+    memset(bigBody, 'x', LOAD_BIG_SIZE);
+
+    server = new AsyncHttpServer(LOAD_PORT);
+    server->on("/api/status", HTTP_GET, []() {
+        server->send_P(200, "application/json", statusJson, statusLength);
+    });
+    server->on("/big", HTTP_GET, []() {
+        server->sendStatic(200, "application/octet-stream", bigBody, LOAD_BIG_SIZE);
+    });
+    server->begin();
+
+    maxLoopMicros = 0;
+    loopCount = 0;
+    serverRunning = true;
+    serverThread = std::thread(serverLoop);
+}
+
+static void stopServer() {
+    serverRunning = false;
+    serverThread.join();
+    server->stop();
+    delete server;
+    server = nullptr;
+    free(bigBody);
+    bigBody = nullptr;
+}
+
+// Verilen loopback adresinden sunucuya bağlan (hata: -1)
+static int connectFrom(const char* localAddress, int receiveBuffer = 0) {
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+
+    if (receiveBuffer > 0) {
+        setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+    }
+
+    timeval timeout = { 10, 0 };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    inet_pton(AF_INET, localAddress, &local.sin_addr);
+
+    sockaddr_in remote;
+    memset(&remote, 0, sizeof(remote));
+    remote.sin_family = AF_INET;
+    remote.sin_port = htons(LOAD_PORT);
+    remote.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (::bind(fd, (sockaddr*)&local, sizeof(local)) != 0 ||
+        ::connect(fd, (sockaddr*)&remote, sizeof(remote)) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Sunucu bağlantıyı kapatana kadar oku; okunan bayt (hata: -1)
+static long readUntilClosed(int fd, char* head, size_t headSize) {
+    char chunk[4096];
+    long total = 0;
+    while (true) {
+        ssize_t count = ::recv(fd, chunk, sizeof(chunk), 0);
+        if (count == 0) {
+            return total;
+        }
+        if (count < 0) {
+            return -1;
+        }
+        if ((size_t)total < headSize - 1) {
+            size_t copy = min((size_t)count, headSize - 1 - (size_t)total);
+            memcpy(head + total, chunk, copy);
+            head[total + copy] = '\0';
+        }
+        total += count;
+    }
+}
+
+// Tek bir GET isteği; HTTP durum kodu ya da aktarım hatasında -1
+static int httpGet(const char* localAddress, const char* path, unsigned long* latencyMicros) {
+    unsigned long start = micros();
+    int fd = connectFrom(localAddress);
+    if (fd < 0) {
+        return -1;
+    }
+
+    char request[128];
+    int length = snprintf(request, sizeof(request), "GET %s HTTP/1.1\r\nHost: kulucka\r\n\r\n", path);
+    char head[64] = "";
+    int code = -1;
+    if (::send(fd, request, length, MSG_NOSIGNAL) == length && readUntilClosed(fd, head, sizeof(head)) > 0) {
+        if (sscanf(head, "HTTP/1.%*d %d", &code) != 1) {
+            code = -1;
+        }
+    }
+    ::close(fd);
+
+    if (latencyMicros != nullptr) {
+        *latencyMicros = micros() - start;
+    }
+    return code;
+}
+
+struct LoadResults {
+    std::mutex lock;
+    unsigned long ok = 0;
+    unsigned long limited = 0;      // 429
+    unsigned long busy = 0;         // 503
+    unsigned long other = 0;
+    unsigned long failed = 0;       // Yanıtsız kapanan / sıfırlanan bağlantı
+    std::vector<unsigned long> latencies;
+
+    void add(int code, unsigned long latency) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (code == 200) {
+            ok++;
+            latencies.push_back(latency);
+        } else if (code == 429) {
+            limited++;
+        } else if (code == 503) {
+            busy++;
+        } else if (code < 0) {
+            failed++;
+        } else {
+            other++;
+        }
+    }
+
+    unsigned long percentile(double fraction) {
+        if (latencies.empty()) {
+            return 0;
+        }
+        std::sort(latencies.begin(), latencies.end());
+        return latencies[(size_t)(fraction * (latencies.size() - 1))];
+    }
+};
+
+void setUp() {
+    startServer();
+}
+
+void tearDown() {
+    stopServer();
+}
+
+// Çok sayıda istemci aynı anda, beklemeden istek gönderir. Her bağlantı ya
+// yanıtlanmalı ya da anında 503/429 almalı; hiçbiri yanıtsız kalmamalı.
+void test_many_concurrent_clients() {
+    const int clients = 16;
+    const int requestsPerClient = 40;
+    LoadResults results;
+    std::vector<std::thread> threads;
+
+    unsigned long start = micros();
+    for (int i = 0; i < clients; i++) {
+        threads.push_back(std::thread([i, &results]() {
+            char address[20];
+            snprintf(address, sizeof(address), "127.0.1.%d", i + 1);
+            for (int r = 0; r < requestsPerClient; r++) {
+                unsigned long latency = 0;
+                int code = httpGet(address, "/api/status", &latency);
+                results.add(code, latency);
+            }
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+    unsigned long elapsed = micros() - start;
+
+    char message[200];
+    snprintf(message, sizeof(message),
+             "%d istemci x %d istek, %.2f s: 200=%lu 429=%lu 503=%lu diger=%lu hata=%lu",
+             clients, requestsPerClient, elapsed / 1e6, results.ok, results.limited,
+             results.busy, results.other, results.failed);
+    TEST_MESSAGE(message);
+    snprintf(message, sizeof(message),
+             "200 gecikmesi p50=%lu us p99=%lu us; en uzun dongu turu=%lu us (%lu tur); zirve baglanti=%u, reddedilen=%lu",
+             results.percentile(0.5), results.percentile(0.99), (unsigned long)maxLoopMicros,
+             (unsigned long)loopCount, server->getPeakConnections(),
+             (unsigned long)server->getRejectedConnections());
+    TEST_MESSAGE(message);
+
+    TEST_ASSERT_EQUAL_UINT32(0, results.failed);
+    TEST_ASSERT_EQUAL_UINT32(0, results.other);
+    TEST_ASSERT_TRUE(results.ok > 0);
+    TEST_ASSERT_EQUAL_UINT32(clients * requestsPerClient, results.ok + results.limited + results.busy);
+    TEST_ASSERT_TRUE(server->getPeakConnections() <= WEB_MAX_CLIENTS);
+    TEST_ASSERT_TRUE(maxLoopMicros < LOAD_MAX_LOOP_MICROS);
+}
+
+// Başlıklarını bayt bayt gönderen istemciler ve yanıtı okumayan bir istemci
+// bütün bağlantı yuvalarını tutar. Döngü beklememeli; yeni gelen hızlı istemci
+// başlık süresinin dolmasını beklemeden, başlığı en eski bağlantının yerine
+// kabul edilmeli ve yanıt almalı.
+void test_slow_clients_do_not_block() {
+    const int trickleClients = WEB_MAX_CLIENTS - 1;
+    const unsigned long testMillis = WEB_REQUEST_TIMEOUT + 3000;
+    std::vector<std::thread> threads;
+    std::vector<long> closedAfter(trickleClients, -1);
+    long readerBytes = -1;
+    std::atomic<long> firstOkAfter(-1);
+    std::atomic<unsigned long> pollerBusy(0);
+    std::atomic<unsigned long> pollerOk(0);
+    std::atomic<unsigned long> pollerFailed(0);
+    unsigned long start = millis();
+
+    // Başlığı 250 ms'de bir bayt gönderen, hiç bitirmeyen istemciler
+    for (int i = 0; i < trickleClients; i++) {
+        threads.push_back(std::thread([i, start, testMillis, &closedAfter]() {
+            char address[20];
+            snprintf(address, sizeof(address), "127.0.2.%d", i + 1);
+            int fd = connectFrom(address);
+            if (fd < 0) {
+                return;
+            }
+
+            const char* request = "GET /api/status HTTP/1.1\r\nX-Padding: ";
+            ::send(fd, request, strlen(request), MSG_NOSIGNAL);
+            while (millis() - start < testMillis) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(250));
+                if (::send(fd, "a", 1, MSG_NOSIGNAL) != 1) {
+                    break;
+                }
+                char probe;
+                if (::recv(fd, &probe, 1, MSG_DONTWAIT) >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+                    break;
+                }
+            }
+            closedAfter[i] = (long)(millis() - start);
+            ::close(fd);
+        }));
+    }
+
+    // Büyük yanıt isteyip hiç okumayan istemci (küçük alma buffer'ı)
+    threads.push_back(std::thread([start, testMillis, &readerBytes]() {
+        int fd = connectFrom("127.0.2.100", 4096);
+        if (fd < 0) {
+            return;
+        }
+        const char* request = "GET /big HTTP/1.1\r\n\r\n";
+        ::send(fd, request, strlen(request), MSG_NOSIGNAL);
+        std::this_thread::sleep_for(std::chrono::milliseconds(testMillis));
+
+        char head[64] = "";
+        readerBytes = readUntilClosed(fd, head, sizeof(head));
+        ::close(fd);
+    }));
+
+    // Yuvalar dolduktan sonra 100 ms'de bir durum soran hızlı istemci
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    threads.push_back(std::thread([start, testMillis, &firstOkAfter, &pollerBusy, &pollerOk, &pollerFailed]() {
+        while (millis() - start < testMillis) {
+            int code = httpGet("127.0.3.1", "/api/status", nullptr);
+            if (code == 200) {
+                long expected = -1;
+                firstOkAfter.compare_exchange_strong(expected, (long)(millis() - start));
+                pollerOk++;
+            } else if (code == 503) {
+                pollerBusy++;
+            } else {
+                pollerFailed++;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    }));
+
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    char message[200];
+    for (int i = 0; i < trickleClients; i++) {
+        snprintf(message, sizeof(message), "Yavas baslik istemcisi %d: %ld ms sonra kapatildi", i + 1, closedAfter[i]);
+        TEST_MESSAGE(message);
+    }
+    snprintf(message, sizeof(message), "Okumayan istemci: %ld / %d bayt aldi", readerBytes, LOAD_BIG_SIZE);
+    TEST_MESSAGE(message);
+    snprintf(message, sizeof(message),
+             "Hizli istemci: 200=%lu 503=%lu hata=%lu, ilk 200: %ld ms; zaman asimi=%lu, bosaltilan=%lu; en uzun dongu turu=%lu us",
+             (unsigned long)pollerOk, (unsigned long)pollerBusy, (unsigned long)pollerFailed,
+             (long)firstOkAfter, (unsigned long)server->getTimedOutConnections(),
+             (unsigned long)server->getEvictedConnections(), (unsigned long)maxLoopMicros);
+    TEST_MESSAGE(message);
+
+    for (int i = 0; i < trickleClients; i++) {
+        TEST_ASSERT_TRUE(closedAfter[i] >= 0 && closedAfter[i] <= (long)(WEB_HEADER_TIMEOUT + 1000));
+    }
+    TEST_ASSERT_TRUE(readerBytes < LOAD_BIG_SIZE);
+    TEST_ASSERT_TRUE(firstOkAfter >= 0 && firstOkAfter < (long)WEB_HEADER_TIMEOUT / 2);
+    TEST_ASSERT_TRUE(pollerOk > pollerBusy);
+    TEST_ASSERT_EQUAL_UINT32(0, pollerFailed);
+    TEST_ASSERT_TRUE(server->getEvictedConnections() > 0);
+    TEST_ASSERT_TRUE(server->getTimedOutConnections() + server->getEvictedConnections() >= (uint32_t)WEB_MAX_CLIENTS);
+    TEST_ASSERT_TRUE(maxLoopMicros < LOAD_MAX_LOOP_MICROS);
+}
+
+// İzlenen istemci sayısından fazla adres arasında dönen istemci, her yeni
+// adreste tam kova kazanmamalı: tablo dolunca yeni adresler ortak kovayı paylaşır.
+void test_rotating_addresses_are_limited() {
+    const int addresses = WEB_RATE_LIMIT_CLIENTS * 4;
+    const int requests = WEB_RATE_LIGHT_BURST * (WEB_RATE_LIMIT_CLIENTS + 4);
+    unsigned long ok = 0;
+    unsigned long limited = 0;
+    unsigned long start = millis();
+
+    for (int r = 0; r < requests; r++) {
+        char address[20];
+        snprintf(address, sizeof(address), "127.0.5.%d", r % addresses + 1);
+        int code = httpGet(address, "/api/status", nullptr);
+        if (code == 200) {
+            ok++;
+        } else if (code == 429) {
+            limited++;
+        }
+    }
+    unsigned long elapsed = millis() - start;
+
+    char message[160];
+    snprintf(message, sizeof(message), "%d adres arasinda %d istek, %lu ms: 200=%lu 429=%lu",
+             addresses, requests, elapsed, ok, limited);
+    TEST_MESSAGE(message);
+
+    // İzlenen kayıtlar ve ortak kova en fazla bir tam kova artı geçen süredeki dolum kadar izin verir
+    unsigned long allowed = (unsigned long)WEB_RATE_LIGHT_BURST * (WEB_RATE_LIMIT_CLIENTS + 1) +
+                            (WEB_RATE_LIMIT_CLIENTS + 1) * (elapsed / WEB_RATE_LIGHT_REFILL_MS + 1);
+    TEST_ASSERT_TRUE(limited > 0);
+    TEST_ASSERT_TRUE(ok <= allowed);
+    TEST_ASSERT_EQUAL_UINT32(requests, ok + limited);
+}
+
+// HEAD, GET rotasının başlıklarını (Content-Length dahil) gövdesiz döndürmeli
+void test_head_has_no_body() {
+    int fd = connectFrom("127.0.4.1");
+    TEST_ASSERT_TRUE(fd >= 0);
+
+    const char* request = "HEAD /api/status HTTP/1.1\r\nHost: kulucka\r\n\r\n";
+    TEST_ASSERT_EQUAL_INT((int)strlen(request), (int)::send(fd, request, strlen(request), MSG_NOSIGNAL));
+    char head[1024] = "";
+    long total = readUntilClosed(fd, head, sizeof(head));
+    ::close(fd);
+
+    int code = -1;
+    sscanf(head, "HTTP/1.%*d %d", &code);
+    const char* length = strstr(head, "Content-Length: ");
+    const char* end = strstr(head, "\r\n\r\n");
+    TEST_ASSERT_EQUAL_INT(200, code);
+    TEST_ASSERT_NOT_NULL(length);
+    TEST_ASSERT_NOT_NULL(end);
+    TEST_ASSERT_EQUAL_UINT32(statusLength, strtoul(length + 16, nullptr, 10));
+    TEST_ASSERT_EQUAL_INT((long)(end + 4 - head), total);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_many_concurrent_clients);
+    RUN_TEST(test_slow_clients_do_not_block);
+    RUN_TEST(test_rotating_addresses_are_limited);
+    RUN_TEST(test_head_has_no_body);
+    return UNITY_END();
+}
@@ -0,0 +1,250 @@
+/**
+ * @file test_main.cpp
+ * @brief İkili durum çerçevesi ile /api/status JSON'unun uygunluk testi (pio test -e native)
+ * @version 1.0
+ */
+
+// Çerçeve, bir istemcinin yapacağı gibi yalnızca /api/status/schema çıktısı
+// kullanılarak çözülür ve aynı örnekten üretilen JSON belgesiyle alan alan
+// karşılaştırılır. Şemada olup JSON'da olmayan ya da JSON'da olup çerçeveden
+// geri elde edilemeyen her alan hata sayılır.
+
+#include <unity.h>
+#include <ArduinoJson.h>
+#include <string>
+#include <set>
+#include "status_sample.h"
+
+#define FRAME_BUFFER_SIZE 4096
+
+// İkisi de çerçevede karşılığı olan ama farklı gösterilen JSON alanları
+static const char* const MAPPED_KEYS[] = {
+    "wifiStatus",       // JSON'da metin, çerçevede enums.wifiStatus kodu
+    "wifiMode"          // JSON'da "AP"/"Station", çerçevede wifiModeAP bayrağı
+};
+
+static DynamicJsonDocument schema(8192);
+
+// "a.b.c" yolundaki değeri oluşturarak döndür
+static JsonVariant createPath(JsonObject root, const std::string& path) {
+    JsonObject object = root;
+    size_t start = 0;
+    size_t dot;
+    while ((dot = path.find('.', start)) != std::string::npos) {
+        std::string segment = path.substr(start, dot - start);
+        JsonObject child = object[segment];
+        if (child.isNull()) {
+            child = object.createNestedObject(segment);
+        }
+        object = child;
+        start = dot + 1;
+    }
+    return object[path.substr(start)];
+}
+
+// "a.b.c" yolundaki değeri bul (yoksa boş)
+static JsonVariantConst findPath(JsonVariantConst root, const std::string& path) {
+    JsonVariantConst value = root;
+    size_t start = 0;
+    while (true) {
+        size_t dot = path.find('.', start);
+        std::string segment = path.substr(start, dot == std::string::npos ? std::string::npos : dot - start);
+        value = value[segment];
+        if (dot == std::string::npos || value.isNull()) {
+            return value;
+        }
+        start = dot + 1;
+    }
+}
+
+static void collectLeaves(JsonVariantConst value, const std::string& path, std::set<std::string>& leaves) {
+    if (value.is<JsonObjectConst>()) {
+        for (JsonPairConst pair : value.as<JsonObjectConst>()) {
+            collectLeaves(pair.value(), path.empty() ? pair.key().c_str() : path + "." + pair.key().c_str(), leaves);
+        }
+    } else {
+        leaves.insert(path);
+    }
+}
+
+template <typename T>
+static T readFrame(const uint8_t* frame, unsigned offset) {
+    T value;
+    memcpy(&value, frame + offset, sizeof(value));
+    return value;
+}
+
+// Şemadaki alan listesiyle çerçeveyi belgeye çöz (istemci tarafı)
+static size_t decodeFrame(const uint8_t* frame, size_t length, JsonObject decoded) {
+    uint8_t frameSize = frame[3];
+    JsonArrayConst fields = schema["fields"];
+
+    for (JsonArrayConst field : fields) {
+        std::string name = field[0].as<const char*>();
+        std::string type = field[1].as<const char*>();
+        unsigned offset = field[2];
+        unsigned param = field[3];
+        JsonVariant target = createPath(decoded, name);
+
+        double number = 0;
+        if (type == "u8") number = readFrame<uint8_t>(frame, offset);
+        else if (type == "i8") number = readFrame<int8_t>(frame, offset);
+        else if (type == "u16") number = readFrame<uint16_t>(frame, offset);
+        else if (type == "i16") number = readFrame<int16_t>(frame, offset);
+        else if (type == "u32") number = readFrame<uint32_t>(frame, offset);
+        else if (type == "f32") number = readFrame<float>(frame, offset);
+
+        if (type == "flag") {
+            target.set((readFrame<uint16_t>(frame, offset) & (1 << param)) != 0);
+        } else if (type == "ipv4") {
+            char ip[16];
+            snprintf(ip, sizeof(ip), "%u.%u.%u.%u", frame[offset], frame[offset + 1],
+                     frame[offset + 2], frame[offset + 3]);
+            target.set(std::string(ip));
+        } else if (param > 1) {
+            target.set(number / param);
+        } else {
+            target.set(number);
+        }
+    }
+
+    // Sondaki uzunluk önekli metinler
+    size_t position = frameSize;
+    for (JsonVariantConst name : schema["strings"].as<JsonArrayConst>()) {
+        if (position >= length) {
+            return 0;
+        }
+        uint8_t textLength = frame[position++];
+        if (position + textLength > length) {
+            return 0;
+        }
+        createPath(decoded, name.as<const char*>()).set(std::string((const char*)frame + position, textLength));
+        position += textLength;
+    }
+
+    for (JsonPairConst constant : schema["constants"].as<JsonObjectConst>()) {
+        decoded[std::string(constant.key().c_str())] = constant.value();
+    }
+    return position;
+}
+
+// Çerçeveden çözülen belge JSON yanıtıyla aynı bilgiyi taşıyor mu?
+static void assertFrameMatchesJson(const StatusSnapshot& sample) {
+    static uint8_t frame[FRAME_BUFFER_SIZE];
+    static char json[FRAME_BUFFER_SIZE];
+    char message[160];
+
+    size_t frameLength = writeStatusFrame(sample, 7, frame, sizeof(frame));
+    size_t jsonLength = writeStatusJson(sample, json, sizeof(json));
+    TEST_ASSERT_TRUE(frameLength > 0);
+    TEST_ASSERT_TRUE(jsonLength > 0);
+    TEST_ASSERT_EQUAL_UINT32(statusFrameLength(sample.incubationType, sample.ssid), frameLength);
+    TEST_ASSERT_EQUAL_UINT32(STATUS_FRAME_MAGIC, readFrame<uint16_t>(frame, 0));
+    TEST_ASSERT_EQUAL_UINT32(STATUS_FRAME_VERSION, frame[2]);
+
+    DynamicJsonDocument expected(8192);
+    TEST_ASSERT_TRUE(deserializeJson(expected, json, jsonLength) == DeserializationError::Ok);
+
+    DynamicJsonDocument decoded(8192);
+    JsonObject root = decoded.to<JsonObject>();
+    TEST_ASSERT_EQUAL_UINT32(frameLength, decodeFrame(frame, frameLength, root));
+    TEST_ASSERT_EQUAL_UINT32(7, root["stateVersion"].as<uint32_t>());
+
+    // Çerçeveden çözülen her alan JSON'da aynı değerle bulunmalı
+    std::set<std::string> decodedLeaves;
+    collectLeaves(decoded.as<JsonVariantConst>(), "", decodedLeaves);
+    std::set<std::string> mapped(MAPPED_KEYS, MAPPED_KEYS + sizeof(MAPPED_KEYS) / sizeof(MAPPED_KEYS[0]));
+
+    for (const std::string& path : decodedLeaves) {
+        if (path == "stateVersion" || path == "wifiModeAP" || mapped.count(path)) {
+            continue;
+        }
+        JsonVariantConst want = findPath(expected.as<JsonVariantConst>(), path);
+        JsonVariantConst got = findPath(decoded.as<JsonVariantConst>(), path);
+        snprintf(message, sizeof(message), "Alan uyusmuyor: %s", path.c_str());
+
+        TEST_ASSERT_TRUE_MESSAGE(!want.isNull(), message);
+        if (want.is<bool>()) {
+            TEST_ASSERT_TRUE_MESSAGE(got.is<bool>() && got.as<bool>() == want.as<bool>(), message);
+        } else if (want.is<const char*>()) {
+            TEST_ASSERT_TRUE_MESSAGE(got.is<const char*>() &&
+                                     strcmp(got.as<const char*>(), want.as<const char*>()) == 0, message);
+        } else {
+            // Sabit nokta alanlar 0.01, JSON kayan noktaları 0.001 çözünürlüklüdür
+            TEST_ASSERT_TRUE_MESSAGE(fabs(got.as<double>() - want.as<double>()) <= 0.0051, message);
+        }
+    }
+
+    // JSON'daki her alan çerçeveden geri elde edilebilmeli
+    std::set<std::string> jsonLeaves;
+    collectLeaves(expected.as<JsonVariantConst>(), "", jsonLeaves);
+    for (const std::string& path : jsonLeaves) {
+        snprintf(message, sizeof(message), "Cercevede karsiligi yok: %s", path.c_str());
+        TEST_ASSERT_TRUE_MESSAGE(decodedLeaves.count(path) > 0 || mapped.count(path) > 0, message);
+    }
+
+    // Farklı gösterilen alanlar
+    bool accessPoint = root["wifiModeAP"];
+    TEST_ASSERT_TRUE(strcmp(expected["wifiMode"].as<const char*>(), accessPoint ? "AP" : "Station") == 0);
+    JsonArrayConst wifiStates = schema["enums"]["wifiStatus"];
+    unsigned wifiStatus = root["wifiStatus"].as<unsigned>();
+    TEST_ASSERT_TRUE(wifiStatus < wifiStates.size());
+    TEST_ASSERT_EQUAL_UINT32(sample.wifiStatus, wifiStatus);
+}
+
+void setUp() {
+    static char text[FRAME_BUFFER_SIZE];
+    size_t length = writeStatusFrameSchema(text, sizeof(text));
+    TEST_ASSERT_TRUE(length > 0);
+    TEST_ASSERT_TRUE(deserializeJson(schema, text, length) == DeserializationError::Ok);
+}
+
+void tearDown() {}
+
+void test_schema_matches_frame_layout() {
+    TEST_ASSERT_EQUAL_UINT32(sizeof(StatusFrame), schema["size"].as<unsigned>());
+    TEST_ASSERT_EQUAL_UINT32(STATUS_FRAME_MAGIC, schema["magic"].as<unsigned>());
+    TEST_ASSERT_EQUAL_UINT32(STATUS_FRAME_VERSION, schema["version"].as<unsigned>());
+    TEST_ASSERT_EQUAL_UINT32(STATUS_FRAME_FIELD_COUNT, schema["fields"].size());
+
+    // Her alan çerçevenin içinde kalmalı
+    for (JsonArrayConst field : schema["fields"].as<JsonArrayConst>()) {
+        std::string type = field[1].as<const char*>();
+        unsigned width = (type == "u8" || type == "i8") ? 1 :
+                         (type == "u32" || type == "f32" || type == "ipv4") ? 4 : 2;
+        TEST_ASSERT_TRUE_MESSAGE(field[2].as<unsigned>() + width <= sizeof(StatusFrame), field[0].as<const char*>());
+    }
+}
+
+void test_frame_round_trips_to_json() {
+    assertFrameMatchesJson(makeStatusSample());
+}
+
+void test_frame_round_trips_flipped_state() {
+    // Bayrakların tersi, negatif değerler ve erişim noktası kipi
+    StatusSnapshot sample = makeStatusSample();
+    sample.currentTemp = -3.21f;
+    sample.heaterState = false;
+    sample.humidifierState = true;
+    sample.motorState = true;
+    sample.sensor1Working = false;
+    sample.isIncubationRunning = false;
+    sample.isIncubationCompleted = true;
+    sample.alarmEnabled = false;
+    sample.tempCalibration2 = -4.75f;
+    sample.wifiModeAP = true;
+    sample.wifiStatus = 4;
+    sample.wifiStatusText = "AP Modu (KULUCKA_MK_v5)";
+    sample.ssid = "KULUCKA_MK_v5";
+    sample.signalStrength = -92;
+    sample.incubationType = "Bıldırcın";
+    assertFrameMatchesJson(sample);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_schema_matches_frame_layout);
+    RUN_TEST(test_frame_round_trips_to_json);
+    RUN_TEST(test_frame_round_trips_flipped_state);
+    return UNITY_END();
+}
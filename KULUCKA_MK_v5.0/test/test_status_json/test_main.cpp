@@ -0,0 +1,258 @@
+/**
+ * @file test_main.cpp
+ * @brief /api/status serileştirme karşılaştırması (pio test -e native)
+ * @version 1.0
+ */
+
+// Eski yol: StaticJsonDocument<3072> + serializeJson ile metne çevirme.
+// Yeni yol: WiFiManager'ın kullandığı writeStatusJson() (status_writer.cpp)
+// ile önceden ayrılmış WEB_RESPONSE_POOL_SIZE buffer'a yazma. Her iki yolun
+// heap ayırma sayısı/baytı ve istek başına süresi ölçülür; yeni yolun hiç
+// ayırma yapmadığı ve aynı belgeyi ürettiği doğrulanır.
+
+#include <unity.h>
+#include <ArduinoJson.h>
+#include <new>
+#include <string>
+#include "status_sample.h"
+
+#define BENCH_POOL_SIZE 4096        // config.h WEB_RESPONSE_POOL_SIZE
+#define BENCH_ITERATIONS 20000
+
+// Ölçüm sırasında operator new çağrılarını say
+static bool countAllocations = false;
+static unsigned long allocationCount = 0;
+static unsigned long allocationBytes = 0;
+
+void* operator new(size_t size) {
+    if (countAllocations) {
+        allocationCount++;
+        allocationBytes += size;
+    }
+    void* p = malloc(size ? size : 1);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+static void startCounting() {
+    allocationCount = 0;
+    allocationBytes = 0;
+    countAllocations = true;
+}
+
+static void stopCounting() {
+    countAllocations = false;
+}
+
+// Eski _getStatusJson() gövdesi (cihazda hedef Arduino String idi)
+static void writeStatusSampleDocument(const StatusSnapshot& s, std::string& out) {
+    char ip[16];
+    snprintf(ip, sizeof(ip), "%u.%u.%u.%u", s.ipAddress[0], s.ipAddress[1],
+             s.ipAddress[2], s.ipAddress[3]);
+
+    StaticJsonDocument<3072> doc;
+
+    doc["temperature"] = s.currentTemp;
+    doc["humidity"] = s.currentHumid;
+    doc["heaterState"] = s.heaterState;
+    doc["humidifierState"] = s.humidifierState;
+    doc["motorState"] = s.motorState;
+
+    JsonObject sensors = doc.createNestedObject("sensors");
+    JsonObject sensor1 = sensors.createNestedObject("sensor1");
+    sensor1["temperature"] = s.temp1;
+    sensor1["humidity"] = s.humid1;
+    sensor1["working"] = s.sensor1Working;
+    sensor1["tempCalibration"] = s.tempCalibration1;
+    sensor1["humidCalibration"] = s.humidCalibration1;
+    JsonObject sensor2 = sensors.createNestedObject("sensor2");
+    sensor2["temperature"] = s.temp2;
+    sensor2["humidity"] = s.humid2;
+    sensor2["working"] = s.sensor2Working;
+    sensor2["tempCalibration"] = s.tempCalibration2;
+    sensor2["humidCalibration"] = s.humidCalibration2;
+
+    doc["currentDay"] = s.currentDay;
+    doc["totalDays"] = s.totalDays;
+    doc["incubationType"] = s.incubationType;
+    doc["targetTemp"] = s.targetTemp;
+    doc["targetHumid"] = s.targetHumid;
+    doc["isIncubationRunning"] = s.isIncubationRunning;
+    doc["isIncubationCompleted"] = s.isIncubationCompleted;
+    doc["actualDay"] = s.actualDay;
+    doc["displayDay"] = s.currentDay;
+
+    doc["pidMode"] = s.pidMode;
+    doc["pidKp"] = s.pidKp;
+    doc["pidKi"] = s.pidKi;
+    doc["pidKd"] = s.pidKd;
+
+    JsonObject alarms = doc.createNestedObject("alarms");
+    alarms["enabled"] = s.alarmEnabled;
+    alarms["tempLow"] = s.tempLowAlarm;
+    alarms["tempHigh"] = s.tempHighAlarm;
+    alarms["humidLow"] = s.humidLowAlarm;
+    alarms["humidHigh"] = s.humidHighAlarm;
+
+    doc["motorWaitTime"] = s.motorWaitTime;
+    doc["motorRunTime"] = s.motorRunTime;
+
+    doc["tempCalibration1"] = s.tempCalibration1;
+    doc["tempCalibration2"] = s.tempCalibration2;
+    doc["humidCalibration1"] = s.humidCalibration1;
+    doc["humidCalibration2"] = s.humidCalibration2;
+
+    doc["manualDevTemp"] = s.manualDevTemp;
+    doc["manualHatchTemp"] = s.manualHatchTemp;
+    doc["manualDevHumid"] = s.manualDevHumid;
+    doc["manualHatchHumid"] = s.manualHatchHumid;
+    doc["manualDevDays"] = s.manualDevDays;
+    doc["manualHatchDays"] = s.manualHatchDays;
+
+    // Eski kod getStatusString()/getIPAddress() String'lerini kopyalıyordu
+    doc["wifiStatus"] = std::string(s.wifiStatusText);
+    doc["ipAddress"] = std::string(ip);
+    doc["wifiMode"] = s.wifiModeAP ? "AP" : "Station";
+    doc["ssid"] = std::string(s.ssid);
+    doc["signalStrength"] = s.signalStrength;
+
+    doc["timestamp"] = s.timestamp;
+    doc["freeHeap"] = s.freeHeap;
+    doc["uptime"] = s.uptime;
+    doc["firmwareVersion"] = "5.0";
+
+    JsonObject reliability = doc.createNestedObject("reliability");
+    reliability["lastSave"] = s.lastSave;
+    reliability["pendingChanges"] = s.pendingChanges;
+    reliability["autoSaveEnabled"] = true;
+    reliability["criticalParamsProtected"] = true;
+
+    out = std::string();
+    serializeJson(doc, out);
+}
+
+// İki belge aynı anahtarları ve değerleri taşıyor mu? JsonWriter kayan
+// noktaları 3 ondalıkla yazdığı için sayılar yarım binde birlik payla karşılaştırılır.
+static bool sameValue(JsonVariantConst a, JsonVariantConst b, std::string path) {
+    if (a.is<JsonObjectConst>()) {
+        JsonObjectConst objectA = a.as<JsonObjectConst>();
+        JsonObjectConst objectB = b.as<JsonObjectConst>();
+        if (objectB.isNull() || objectA.size() != objectB.size()) {
+            TEST_MESSAGE(("Nesne farkı: " + path).c_str());
+            return false;
+        }
+        for (JsonPairConst pair : objectA) {
+            const char* key = pair.key().c_str();
+            if (!objectB.containsKey(key)) {
+                TEST_MESSAGE(("Eksik anahtar: " + path + "." + key).c_str());
+                return false;
+            }
+            if (!sameValue(pair.value(), objectB[key], path + "." + key)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (a.is<bool>() || b.is<bool>()) {
+        return a.is<bool>() && b.is<bool>() && a.as<bool>() == b.as<bool>();
+    }
+    if (a.is<const char*>()) {
+        return b.is<const char*>() && strcmp(a.as<const char*>(), b.as<const char*>()) == 0;
+    }
+    if (fabs(a.as<double>() - b.as<double>()) > 0.0005) {
+        TEST_MESSAGE(("Sayı farkı: " + path).c_str());
+        return false;
+    }
+    return true;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_writer_matches_document() {
+    StatusSnapshot sample = makeStatusSample();
+    static char pool[BENCH_POOL_SIZE];
+    std::string reference;
+
+    size_t length = writeStatusJson(sample, pool, sizeof(pool));
+    writeStatusSampleDocument(sample, reference);
+    TEST_ASSERT_TRUE(length > 0);
+
+    DynamicJsonDocument written(4096);
+    DynamicJsonDocument expected(4096);
+    TEST_ASSERT_TRUE(deserializeJson(written, pool, length) == DeserializationError::Ok);
+    TEST_ASSERT_TRUE(deserializeJson(expected, reference) == DeserializationError::Ok);
+    TEST_ASSERT_TRUE(sameValue(expected.as<JsonVariantConst>(), written.as<JsonVariantConst>(), "$"));
+}
+
+void test_writer_overflow_is_reported() {
+    StatusSnapshot sample = makeStatusSample();
+    char small[256];
+    TEST_ASSERT_EQUAL_UINT32(0, writeStatusJson(sample, small, sizeof(small)));
+}
+
+void test_benchmark_status_serialization() {
+    StatusSnapshot sample = makeStatusSample();
+    static char pool[BENCH_POOL_SIZE];
+    std::string text;
+    char message[160];
+    size_t sink = 0;
+
+    // Eski yol
+    startCounting();
+    unsigned long start = micros();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        sample.timestamp++;
+        writeStatusSampleDocument(sample, text);
+        sink += text.length();
+    }
+    unsigned long documentTime = micros() - start;
+    stopCounting();
+    unsigned long documentAllocations = allocationCount;
+    unsigned long documentBytes = allocationBytes;
+
+    // Yeni yol
+    startCounting();
+    start = micros();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        sample.timestamp++;
+        sink += writeStatusJson(sample, pool, sizeof(pool));
+    }
+    unsigned long writerTime = micros() - start;
+    stopCounting();
+    unsigned long writerAllocations = allocationCount;
+
+    snprintf(message, sizeof(message),
+             "JsonDocument+String: %.2f us/istek, %.1f ayirma/istek, %.0f bayt/istek (%u bayt cikti)",
+             (double)documentTime / BENCH_ITERATIONS,
+             (double)documentAllocations / BENCH_ITERATIONS,
+             (double)documentBytes / BENCH_ITERATIONS, (unsigned)text.length());
+    TEST_MESSAGE(message);
+    snprintf(message, sizeof(message),
+             "JsonWriter+havuz:   %.2f us/istek, %lu ayirma toplam (%u bayt cikti)",
+             (double)writerTime / BENCH_ITERATIONS, writerAllocations,
+             (unsigned)strlen(pool));
+    TEST_MESSAGE(message);
+
+    TEST_ASSERT_TRUE(sink > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, writerAllocations);
+    TEST_ASSERT_TRUE(documentAllocations > 0);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_writer_matches_document);
+    RUN_TEST(test_writer_overflow_is_reported);
+    RUN_TEST(test_benchmark_status_serialization);
+    return UNITY_END();
+}